@@ -31,6 +31,7 @@ Arguments:
 -t <name>, --target <name>       Builds only the target <name> instead of all targets.
 -no-examples                     Disables the build of the SDK examples.
 -no-tests                        Disables the build of the SDK tests.
+--benchmarks                     Enables the build of the SDK microbenchmarks.
 --cov                            Generates coverage information.
 -s, --static                     Links all dependencies statically.
 -x, --cross <arch>               Cross compiles for the specified architecture.
@@ -46,6 +47,7 @@ BUILD_TARGET=all
 STATIC_BUILD=OFF
 SDK_BUILD_EXAMPLES=ON
 SDK_BUILD_TESTS=ON
+SDK_BUILD_BENCHMARKS=OFF
 GEN_COVERAGE=OFF
 
 POSITIONAL_ARGS=()
@@ -77,6 +79,10 @@ while [[ $# -gt 0 ]]; do
       SDK_BUILD_TESTS=OFF
       shift
       ;;
+    --benchmarks)
+      SDK_BUILD_BENCHMARKS=ON
+      shift
+      ;;
     -x|--cross)
       HOST_ARCH=$( get_valid_cross_compile_architecture "$2" )
       shift
@@ -109,6 +115,7 @@ echo "Build arch         ${BUILD_ARCH}"
 echo "Host arch          ${HOST_ARCH}"
 echo "Build target       ${BUILD_TARGET}"
 echo "Build SDK tests    ${SDK_BUILD_TESTS}"
+echo "Build benchmarks   ${SDK_BUILD_BENCHMARKS}"
 echo "Build SDK examples ${SDK_BUILD_EXAMPLES}"
 echo "Static build       ${STATIC_BUILD}"
 echo "Coverage           ${GEN_COVERAGE}"
@@ -144,6 +151,7 @@ cmake --no-warn-unused-cli \
   -DSTATIC_BUILD:BOOL=${STATIC_BUILD} \
   -DSDK_BUILD_EXAMPLES=${SDK_BUILD_EXAMPLES} \
   -DSDK_BUILD_TESTS=${SDK_BUILD_TESTS} \
+  -DSDK_BUILD_BENCHMARKS=${SDK_BUILD_BENCHMARKS} \
   -DCMAKE_CXX_FLAGS="${CMAKE_CXX_FLAGS}" \
   -DCMAKE_TOOLCHAIN_FILE=generators/conan_toolchain.cmake \
   -G Ninja \
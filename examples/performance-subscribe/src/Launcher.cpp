@@ -17,12 +17,15 @@
 #include "PerformanceTestApp.h"
 #include "sdk/Logger.h"
 
+#include <fmt/core.h>
 #include <nlohmann/json.hpp>
 
+#include <chrono>
 #include <csignal>
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -62,16 +65,84 @@ std::vector<std::string> readSignalNameFromFiles(const std::string& configFile)
     return signalNames;
 }
 
+void printUsage(const char* appBinaryPath) {
+    fmt::print("Usage: {} [options] [<path-to-json>]\n"
+               "Options:\n"
+               "  --layout=per-signal|single  One subscription per signal (default) or a single\n"
+               "                              subscription of all signals, not necessarily one\n"
+               "                              stream each (see README)\n"
+               "  --warmup=<seconds>          Time before the measurement starts (default: 0)\n"
+               "  --duration=<seconds>        Length of the measurement, the app stops afterwards\n"
+               "                              (default: 0, i.e. until the app is terminated)\n"
+               "  --report=<file>             Write the report to the file as JSON\n"
+               "  --print-values              Print each received value with its time of receipt\n",
+               appBinaryPath);
+}
+
+std::chrono::milliseconds parseSeconds(const std::string& value) {
+    const auto seconds = std::stod(value);
+    if (seconds < 0.0) {
+        throw std::invalid_argument("negative duration");
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::duration<double>(seconds));
+}
+
+/**
+ * @brief Parse the command line into the test configuration, except the signal list.
+ *
+ * @return The path of the signal list, empty if not given.
+ * @throw std::invalid_argument if the command line is invalid.
+ */
+std::string parseCommandLine(int argc, char** argv, example::PerformanceTestConfig& config) {
+    std::string configFile;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        const auto        separator = argument.find('=');
+        const auto        option    = argument.substr(0, separator);
+        const auto value = separator != std::string::npos ? argument.substr(separator + 1) : "";
+
+        if (option == "--layout" && value == "per-signal") {
+            config.m_layout = example::PerformanceTestConfig::Layout::SUBSCRIPTION_PER_SIGNAL;
+        } else if (option == "--layout" && value == "single") {
+            config.m_layout = example::PerformanceTestConfig::Layout::SINGLE_SUBSCRIPTION;
+        } else if (option == "--warmup") {
+            config.m_warmUpDuration = parseSeconds(value);
+        } else if (option == "--duration") {
+            config.m_measurementDuration = parseSeconds(value);
+        } else if (option == "--report" && !value.empty()) {
+            config.m_reportFile = value;
+        } else if (argument == "--print-values") {
+            config.m_printValues = true;
+        } else if (argument.rfind("--", 0) != 0 && configFile.empty()) {
+            configFile = argument;
+        } else {
+            throw std::invalid_argument(fmt::format("invalid argument '{}'", argument));
+        }
+    }
+    return configFile;
+}
+
 } // anonymous namespace
 
 int main(int argc, char** argv) {
     signal(SIGINT, signal_handler);
 
-    const auto configFile =
-        (argc > 1) ? std::filesystem::path(argv[1]).string() : getDefaultConfigFilePath(argv[0]);
-    auto signalList = readSignalNameFromFiles(configFile);
+    example::PerformanceTestConfig config;
+    std::string                    configFile;
+    try {
+        configFile = parseCommandLine(argc, argv, config);
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "Error: {}\n", e.what());
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (configFile.empty()) {
+        configFile = getDefaultConfigFilePath(argv[0]);
+    }
+    config.m_signalList = readSignalNameFromFiles(configFile);
 
-    myApp = std::make_unique<example::PerformanceTestApp>(std::move(signalList));
+    myApp = std::make_unique<example::PerformanceTestApp>(std::move(config));
     myApp->run();
     return 0;
 }
@@ -0,0 +1,283 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "LoadStatistics.h"
+
+#include <fmt/core.h>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace example {
+
+namespace {
+
+constexpr double NANOSECONDS_PER_MILLISECOND = 1e6;
+constexpr double NANOSECONDS_PER_MICROSECOND = 1e3;
+constexpr double BYTES_PER_MEBIBYTE          = 1024.0 * 1024.0;
+
+std::chrono::microseconds toMicroseconds(const timeval& time) {
+    return std::chrono::seconds(time.tv_sec) + std::chrono::microseconds(time.tv_usec);
+}
+
+std::chrono::system_clock::time_point toTimePoint(const velocitas::Timestamp& timestamp) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::seconds(timestamp.seconds) + std::chrono::nanoseconds(timestamp.nanos)));
+}
+
+double toMilliseconds(std::chrono::nanoseconds duration) {
+    return static_cast<double>(duration.count()) / NANOSECONDS_PER_MILLISECOND;
+}
+
+std::string formatLatencies(const velocitas::HistogramSnapshot& latencies) {
+    if (latencies.m_count == 0) {
+        return "-";
+    }
+    const auto toMillis = [&latencies](double quantile) {
+        return static_cast<double>(latencies.getQuantile(quantile)) / NANOSECONDS_PER_MILLISECOND;
+    };
+    return fmt::format("{:.3f} / {:.3f} / {:.3f}", toMillis(0.5), toMillis(0.99), toMillis(0.999));
+}
+
+nlohmann::json getLatencyReport(const velocitas::HistogramSnapshot& latencies) {
+    const auto toMicros = [&latencies](double quantile) {
+        return static_cast<double>(latencies.getQuantile(quantile)) / NANOSECONDS_PER_MICROSECOND;
+    };
+    return {{"p50", toMicros(0.5)}, {"p99", toMicros(0.99)}, {"p999", toMicros(0.999)}};
+}
+
+} // anonymous namespace
+
+ProcessUsage ProcessUsage::get() {
+    ProcessUsage usage;
+    rusage       resourceUsage{};
+    if (getrusage(RUSAGE_SELF, &resourceUsage) == 0) {
+        usage.m_userCpuTime   = toMicroseconds(resourceUsage.ru_utime);
+        usage.m_systemCpuTime = toMicroseconds(resourceUsage.ru_stime);
+        // kibibytes on Linux
+        usage.m_peakResidentBytes = static_cast<uint64_t>(resourceUsage.ru_maxrss) * 1024U;
+    }
+    // Second field of statm: resident set size in pages
+    std::ifstream statm("/proc/self/statm");
+    uint64_t      sizePages     = 0;
+    uint64_t      residentPages = 0;
+    if (statm >> sizePages >> residentPages) {
+        usage.m_residentBytes = residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+    // The peak is accounted lazily by the kernel and may lag behind the current value
+    usage.m_peakResidentBytes = std::max(usage.m_peakResidentBytes, usage.m_residentBytes);
+    return usage;
+}
+
+std::optional<std::chrono::nanoseconds>
+SignalStatistics::onValue(const velocitas::DataPointValue&      value,
+                          std::chrono::steady_clock::time_point receiveTime,
+                          std::chrono::system_clock::time_point receiveWallTime, bool isMeasuring) {
+    std::lock_guard lock(m_mutex);
+    if (m_lastTimestamp && (*m_lastTimestamp == value.getTimestamp())) {
+        return std::nullopt;
+    }
+    m_lastTimestamp = value.getTimestamp();
+
+    const auto lastArrival = m_lastArrival;
+    m_lastArrival          = receiveTime;
+    if (!isMeasuring) {
+        return std::nullopt;
+    }
+
+    ++m_numUpdates;
+    if (lastArrival) {
+        const auto interArrival =
+            static_cast<double>(std::chrono::nanoseconds(receiveTime - *lastArrival).count());
+        ++m_numInterArrivals;
+        const auto delta = interArrival - m_interArrivalMean;
+        m_interArrivalMean += delta / static_cast<double>(m_numInterArrivals);
+        m_interArrivalM2 += delta * (interArrival - m_interArrivalMean);
+    }
+    if (!value.isValid()) {
+        ++m_numFailures;
+        return std::nullopt;
+    }
+    // Clocks of the source and the app which are not in sync may result in negative latencies,
+    // which are recorded as 0
+    const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        receiveWallTime - toTimePoint(value.getTimestamp()));
+    m_latencies.recordDuration(latency);
+    return latency;
+}
+
+uint64_t SignalStatistics::getNumUpdates() const {
+    std::lock_guard lock(m_mutex);
+    return m_numUpdates;
+}
+
+uint64_t SignalStatistics::getNumFailures() const {
+    std::lock_guard lock(m_mutex);
+    return m_numFailures;
+}
+
+std::chrono::nanoseconds SignalStatistics::getMeanInterArrivalTime() const {
+    std::lock_guard lock(m_mutex);
+    return std::chrono::nanoseconds(static_cast<int64_t>(m_interArrivalMean));
+}
+
+std::chrono::nanoseconds SignalStatistics::getInterArrivalJitter() const {
+    std::lock_guard lock(m_mutex);
+    if (m_numInterArrivals < 2) {
+        return std::chrono::nanoseconds(0);
+    }
+    const auto variance = m_interArrivalM2 / static_cast<double>(m_numInterArrivals - 1);
+    return std::chrono::nanoseconds(static_cast<int64_t>(std::sqrt(variance)));
+}
+
+LoadStatistics::LoadStatistics(const std::vector<std::string>& signalPaths) {
+    for (const auto& path : signalPaths) {
+        m_signals.emplace(path, std::make_unique<SignalStatistics>());
+    }
+}
+
+void LoadStatistics::onValue(const std::string& path, const velocitas::DataPointValue& value) {
+    const auto receiveTime     = std::chrono::steady_clock::now();
+    const auto receiveWallTime = std::chrono::system_clock::now();
+
+    auto iter = m_signals.find(path);
+    if (iter == m_signals.end()) {
+        return;
+    }
+    if (auto latency = iter->second->onValue(value, receiveTime, receiveWallTime, m_isMeasuring)) {
+        m_latencies.recordDuration(*latency);
+    }
+}
+
+void LoadStatistics::startMeasurement() {
+    std::lock_guard lock(m_windowMutex);
+    m_startUsage  = ProcessUsage::get();
+    m_startTime   = std::chrono::steady_clock::now();
+    m_endTime     = m_startTime;
+    m_isMeasuring = true;
+}
+
+void LoadStatistics::stopMeasurement() {
+    std::lock_guard lock(m_windowMutex);
+    if (!m_isMeasuring) {
+        return;
+    }
+    m_isMeasuring = false;
+    m_endTime     = std::chrono::steady_clock::now();
+    m_endUsage    = ProcessUsage::get();
+}
+
+std::chrono::duration<double> LoadStatistics::getMeasurementDuration() const {
+    std::lock_guard lock(m_windowMutex);
+    return m_endTime - m_startTime;
+}
+
+void LoadStatistics::printReport() const {
+    const auto duration = getMeasurementDuration();
+    const auto seconds  = std::max(duration.count(), 1e-9);
+
+    size_t pathWidth = std::string("All signals").size();
+    for (const auto& [path, statistics] : m_signals) {
+        pathWidth = std::max(pathWidth, path.size());
+    }
+
+    fmt::print("\nMeasured for {:.1f}s\n", duration.count());
+    fmt::print("{:<{}}  {:>9}  {:>9}  {:>8}  {:>12}  {:>10}  {}\n", "Signal", pathWidth, "Updates",
+               "Rate/s", "Failures", "Interval ms", "Jitter ms", "Latency p50 / p99 / p999 ms");
+    uint64_t totalUpdates = 0;
+    for (const auto& [path, statistics] : m_signals) {
+        const auto numUpdates = statistics->getNumUpdates();
+        totalUpdates += numUpdates;
+        fmt::print("{:<{}}  {:>9}  {:>9.1f}  {:>8}  {:>12.3f}  {:>10.3f}  {}\n", path, pathWidth,
+                   numUpdates, static_cast<double>(numUpdates) / seconds,
+                   statistics->getNumFailures(),
+                   toMilliseconds(statistics->getMeanInterArrivalTime()),
+                   toMilliseconds(statistics->getInterArrivalJitter()),
+                   formatLatencies(statistics->getLatencies()));
+    }
+    fmt::print("{:<{}}  {:>9}  {:>9.1f}  {:>8}  {:>12}  {:>10}  {}\n", "All signals", pathWidth,
+               totalUpdates, static_cast<double>(totalUpdates) / seconds, "", "", "",
+               formatLatencies(m_latencies.getSnapshot()));
+    fmt::print("Subscription replies: {} ({:.1f}/s)\n", m_numReplies.load(),
+               static_cast<double>(m_numReplies.load()) / seconds);
+
+    ProcessUsage startUsage;
+    ProcessUsage endUsage;
+    {
+        std::lock_guard lock(m_windowMutex);
+        startUsage = m_startUsage;
+        endUsage   = m_endUsage;
+    }
+    const std::chrono::duration<double> userCpuTime =
+        endUsage.m_userCpuTime - startUsage.m_userCpuTime;
+    const std::chrono::duration<double> systemCpuTime =
+        endUsage.m_systemCpuTime - startUsage.m_systemCpuTime;
+    fmt::print("CPU: {:.1f}% (user {:.2f}s, system {:.2f}s)\n",
+               100.0 * (userCpuTime + systemCpuTime).count() / seconds, userCpuTime.count(),
+               systemCpuTime.count());
+    fmt::print("RSS: {:.1f} MiB, peak RSS: {:.1f} MiB\n",
+               static_cast<double>(endUsage.m_residentBytes) / BYTES_PER_MEBIBYTE,
+               static_cast<double>(endUsage.m_peakResidentBytes) / BYTES_PER_MEBIBYTE);
+}
+
+nlohmann::json LoadStatistics::getReport() const {
+    const auto duration = getMeasurementDuration();
+    const auto seconds  = std::max(duration.count(), 1e-9);
+
+    nlohmann::json signals      = nlohmann::json::object();
+    uint64_t       totalUpdates = 0;
+    for (const auto& [path, statistics] : m_signals) {
+        const auto numUpdates = statistics->getNumUpdates();
+        totalUpdates += numUpdates;
+        signals[path] = {
+            {"updates", numUpdates},
+            {"rate", static_cast<double>(numUpdates) / seconds},
+            {"failures", statistics->getNumFailures()},
+            {"meanInterArrivalMs", toMilliseconds(statistics->getMeanInterArrivalTime())},
+            {"jitterMs", toMilliseconds(statistics->getInterArrivalJitter())},
+            {"latencyUs", getLatencyReport(statistics->getLatencies())},
+        };
+    }
+
+    ProcessUsage startUsage;
+    ProcessUsage endUsage;
+    {
+        std::lock_guard lock(m_windowMutex);
+        startUsage = m_startUsage;
+        endUsage   = m_endUsage;
+    }
+    const std::chrono::duration<double> cpuTime =
+        (endUsage.m_userCpuTime - startUsage.m_userCpuTime) +
+        (endUsage.m_systemCpuTime - startUsage.m_systemCpuTime);
+    return {
+        {"durationS", duration.count()},
+        {"updates", totalUpdates},
+        {"rate", static_cast<double>(totalUpdates) / seconds},
+        {"replies", m_numReplies.load()},
+        {"latencyUs", getLatencyReport(m_latencies.getSnapshot())},
+        {"cpuPercent", 100.0 * cpuTime.count() / seconds},
+        {"rssBytes", endUsage.m_residentBytes},
+        {"peakRssBytes", endUsage.m_peakResidentBytes},
+        {"signals", signals},
+    };
+}
+
+} // namespace example
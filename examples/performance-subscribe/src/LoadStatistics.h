@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_LOADSTATISTICS_H
+#define VEHICLE_APP_SDK_LOADSTATISTICS_H
+
+#include "sdk/DataPointValue.h"
+#include "sdk/Metrics.h"
+
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace example {
+
+/**
+ * @brief CPU time and memory usage of the process.
+ */
+struct ProcessUsage {
+    std::chrono::microseconds m_userCpuTime{0};
+    std::chrono::microseconds m_systemCpuTime{0};
+    uint64_t                  m_residentBytes{0};
+    uint64_t                  m_peakResidentBytes{0};
+
+    static ProcessUsage get();
+};
+
+/**
+ * @brief Statistics of the updates of a single signal received within the measurement window.
+ *
+ *        A value counts as update if its timestamp differs from the one of the previously received
+ *        value, as a subscription to several signals delivers the unchanged values along with the
+ *        updated ones.
+ */
+class SignalStatistics {
+public:
+    /**
+     * @brief Account a received value.
+     *
+     * @param isMeasuring  Whether the value was received within the measurement window. Values
+     *                     received outside only serve as reference for the next update.
+     * @return The latency of the value if it is a measured update.
+     */
+    std::optional<std::chrono::nanoseconds>
+    onValue(const velocitas::DataPointValue&      value,
+            std::chrono::steady_clock::time_point receiveTime,
+            std::chrono::system_clock::time_point receiveWallTime, bool isMeasuring);
+
+    [[nodiscard]] uint64_t getNumUpdates() const;
+    [[nodiscard]] uint64_t getNumFailures() const;
+
+    /**
+     * @brief Mean and standard deviation (the jitter) of the time between two updates.
+     */
+    [[nodiscard]] std::chrono::nanoseconds getMeanInterArrivalTime() const;
+    [[nodiscard]] std::chrono::nanoseconds getInterArrivalJitter() const;
+
+    /**
+     * @brief Time from the source timestamp of an update until the app received it.
+     */
+    [[nodiscard]] velocitas::HistogramSnapshot getLatencies() const {
+        return m_latencies.getSnapshot();
+    }
+
+private:
+    mutable std::mutex                                   m_mutex;
+    std::optional<velocitas::Timestamp>                  m_lastTimestamp;
+    std::optional<std::chrono::steady_clock::time_point> m_lastArrival;
+    uint64_t                                             m_numUpdates{0};
+    uint64_t                                             m_numFailures{0};
+    // Welford's online algorithm for the mean and variance of the inter-arrival times
+    uint64_t             m_numInterArrivals{0};
+    double               m_interArrivalMean{0.0};
+    double               m_interArrivalM2{0.0};
+    velocitas::Histogram m_latencies;
+};
+
+/**
+ * @brief Statistics of all subscribed signals and of the process within the measurement window,
+ *        which starts with startMeasurement() and ends with stopMeasurement().
+ */
+class LoadStatistics {
+public:
+    explicit LoadStatistics(const std::vector<std::string>& signalPaths);
+
+    /**
+     * @brief Account a received value of one of the signals passed on construction.
+     */
+    void onValue(const std::string& path, const velocitas::DataPointValue& value);
+
+    /**
+     * @brief Account the receipt of a subscription reply.
+     */
+    void onReply() {
+        if (m_isMeasuring) {
+            ++m_numReplies;
+        }
+    }
+
+    void startMeasurement();
+    void stopMeasurement();
+
+    [[nodiscard]] bool isMeasuring() const { return m_isMeasuring; }
+
+    /**
+     * @brief Print the report of the measurement to stdout.
+     */
+    void printReport() const;
+
+    /**
+     * @brief Report of the measurement, the latencies given in microseconds.
+     */
+    [[nodiscard]] nlohmann::json getReport() const;
+
+private:
+    [[nodiscard]] std::chrono::duration<double> getMeasurementDuration() const;
+
+    std::map<std::string, std::unique_ptr<SignalStatistics>> m_signals;
+    velocitas::Histogram                                     m_latencies;
+    std::atomic<bool>                                        m_isMeasuring{false};
+    std::atomic<uint64_t>                                    m_numReplies{0};
+
+    mutable std::mutex                    m_windowMutex;
+    std::chrono::steady_clock::time_point m_startTime;
+    std::chrono::steady_clock::time_point m_endTime;
+    ProcessUsage                          m_startUsage;
+    ProcessUsage                          m_endUsage;
+};
+
+} // namespace example
+
+#endif // VEHICLE_APP_SDK_LOADSTATISTICS_H
@@ -16,13 +16,16 @@
 
 #include "PerformanceTestApp.h"
 #include "sdk/IPubSubClient.h"
+#include "sdk/Job.h"
 #include "sdk/Logger.h"
+#include "sdk/ThreadPool.h"
 #include "sdk/vdb/IVehicleDataBrokerClient.h"
 
 #include <fmt/chrono.h>
 #include <fmt/core.h>
 
 #include <chrono>
+#include <fstream>
 #include <utility>
 
 namespace example {
@@ -41,25 +44,99 @@ template <typename TTimeBase> TTimeBase getTimestamp() {
     return std::chrono::duration_cast<TTimeBase>(timeSinceEpoch);
 }
 
+std::string createQuery(const std::vector<std::string>& signalPaths) {
+    std::string query = "SELECT ";
+    for (const auto& path : signalPaths) {
+        query += path + ",";
+    }
+    query.pop_back();
+    return query;
+}
+
+void runDelayed(std::function<void()> function, std::chrono::milliseconds delay) {
+    velocitas::ThreadPool::getInstance(velocitas::executors::DEFAULT)
+        ->enqueue(velocitas::Job::create(std::move(function), delay));
+}
+
 } // anonymous namespace
 
-PerformanceTestApp::PerformanceTestApp(std::vector<std::string> signalList)
+PerformanceTestApp::PerformanceTestApp(PerformanceTestConfig config)
     : VehicleApp(velocitas::IVehicleDataBrokerClient::createInstance("vehicledatabroker"))
-    , m_signalList{std::move(signalList)} {}
+    , m_config{std::move(config)}
+    , m_statistics{m_config.m_signalList} {}
 
 void PerformanceTestApp::onStart() {
-    velocitas::logger().info("Subscribing to signals ...");
-    for (auto path : m_signalList) {
-        subscribeDataPoints("SELECT " + path)
-            ->onItem([path](const velocitas::DataPointReply& reply) {
-                const auto value     = getValueRepresentation(*reply.getUntyped(path));
-                const auto timestamp = getTimestamp<std::chrono::microseconds>();
-                fmt::print("{:%T} - {} - {}\n", timestamp, path, value);
-            })
-            ->onError([path](const velocitas::Status& status) {
-                velocitas::logger().error("Error on subscription for data point {}: {}", path,
-                                          status.errorMessage());
-            });
+    velocitas::logger().info("Subscribing to {} signals via {} ...", m_config.m_signalList.size(),
+                             m_config.m_layout == PerformanceTestConfig::Layout::SINGLE_SUBSCRIPTION
+                                 ? "a single subscription"
+                                 : "one subscription per signal");
+    if (m_config.m_layout == PerformanceTestConfig::Layout::SINGLE_SUBSCRIPTION) {
+        subscribe(m_config.m_signalList);
+    } else {
+        for (const auto& path : m_config.m_signalList) {
+            subscribe({path});
+        }
+    }
+
+    if (m_config.m_warmUpDuration.count() > 0) {
+        velocitas::logger().info("Warming up for {}ms ...", m_config.m_warmUpDuration.count());
+        runDelayed([this]() { startMeasurement(); }, m_config.m_warmUpDuration);
+    } else {
+        startMeasurement();
+    }
+}
+
+void PerformanceTestApp::onStop() { reportMeasurement(); }
+
+void PerformanceTestApp::subscribe(const std::vector<std::string>& signalPaths) {
+    subscribeDataPoints(createQuery(signalPaths))
+        ->onItem([this, signalPaths](const velocitas::DataPointReply& reply) {
+            m_statistics.onReply();
+            for (const auto& path : signalPaths) {
+                const auto value = reply.getUntyped(path);
+                m_statistics.onValue(path, *value);
+                if (m_config.m_printValues) {
+                    fmt::print("{:%T} - {} - {}\n", getTimestamp<std::chrono::microseconds>(),
+                               path, getValueRepresentation(*value));
+                }
+            }
+        })
+        ->onError([signalPaths](const velocitas::Status& status) {
+            velocitas::logger().error("Error on subscription for data points {}: {}",
+                                      createQuery(signalPaths), status.errorMessage());
+        });
+}
+
+void PerformanceTestApp::startMeasurement() {
+    if (m_isReported) {
+        return;
+    }
+    m_statistics.startMeasurement();
+    if (m_config.m_measurementDuration.count() > 0) {
+        velocitas::logger().info("Measuring for {}ms ...", m_config.m_measurementDuration.count());
+        runDelayed([this]() { stop(); }, m_config.m_measurementDuration);
+    } else {
+        velocitas::logger().info("Measuring until the app is stopped ...");
+    }
+}
+
+void PerformanceTestApp::reportMeasurement() {
+    if (m_isReported.exchange(true)) {
+        return;
+    }
+    if (!m_statistics.isMeasuring()) {
+        velocitas::logger().warn("Stopped before the measurement started, nothing to report");
+        return;
+    }
+    m_statistics.stopMeasurement();
+    m_statistics.printReport();
+
+    if (!m_config.m_reportFile.empty()) {
+        std::ofstream reportFile(m_config.m_reportFile);
+        reportFile << m_statistics.getReport().dump(2) << '\n';
+        if (!reportFile) {
+            velocitas::logger().error("Cannot write report to {}", m_config.m_reportFile);
+        }
     }
 }
 
@@ -17,24 +17,64 @@
 #ifndef VEHICLE_APP_SDK_PERFORMANCETESTAPP_H
 #define VEHICLE_APP_SDK_PERFORMANCETESTAPP_H
 
+#include "LoadStatistics.h"
 #include "sdk/VehicleApp.h"
 
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <vector>
 
 namespace example {
 
 /**
- * @brief
+ * @brief Configuration of a performance test run.
+ */
+struct PerformanceTestConfig {
+    /**
+     * @brief Number of subscriptions the signals are subscribed with. This is not necessarily the
+     *        number of streams to the databroker: on kuksa.val.v2 the SDK multiplexes
+     *        subscriptions made together onto shared streams.
+     */
+    enum class Layout {
+        /// One subscription per signal
+        SUBSCRIPTION_PER_SIGNAL,
+        /// A single subscription of all signals
+        SINGLE_SUBSCRIPTION
+    };
+
+    std::vector<std::string> m_signalList;
+    Layout                   m_layout{Layout::SUBSCRIPTION_PER_SIGNAL};
+    /// Time after subscribing before the measurement starts
+    std::chrono::milliseconds m_warmUpDuration{0};
+    /// Length of the measurement, 0 to measure until the app is stopped
+    std::chrono::milliseconds m_measurementDuration{0};
+    /// File to write the report to as JSON, none if empty
+    std::string m_reportFile;
+    /// Print each received value with the time of its receipt
+    bool m_printValues{false};
+};
+
+/**
+ * @brief Load test subscribing to a list of signals. Measures the update rate, the inter-arrival
+ *        jitter and the latency from the source timestamp until receipt per signal, as well as the
+ *        CPU and memory usage, and reports them when the measurement ends.
  */
 class PerformanceTestApp : public velocitas::VehicleApp {
 public:
-    explicit PerformanceTestApp(std::vector<std::string> signalList);
+    explicit PerformanceTestApp(PerformanceTestConfig config);
 
     void onStart() override;
+    void onStop() override;
 
 private:
-    std::vector<std::string> m_signalList;
+    void subscribe(const std::vector<std::string>& signalPaths);
+    void startMeasurement();
+    void reportMeasurement();
+
+    PerformanceTestConfig m_config;
+    LoadStatistics        m_statistics;
+    std::atomic<bool>     m_isReported{false};
 };
 
 } // namespace example
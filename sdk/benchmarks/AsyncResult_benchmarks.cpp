@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/AsyncResult.h"
+#include "sdk/DataPointReply.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace velocitas;
+
+namespace {
+
+void BM_AsyncResult_insertThenAwait(benchmark::State& state) {
+    for (auto _ : state) {
+        auto result = std::make_shared<AsyncResult<int>>();
+        result->insertResult(42);
+        benchmark::DoNotOptimize(result->await());
+    }
+}
+
+void BM_AsyncResult_onResultThenInsert(benchmark::State& state) {
+    int sum = 0;
+    for (auto _ : state) {
+        auto result = std::make_shared<AsyncResult<int>>();
+        result->onResult([&sum](int value) { sum += value; });
+        result->insertResult(42);
+    }
+    benchmark::DoNotOptimize(sum);
+}
+
+// Completion by another thread, i.e. including the wake up of the awaiting thread
+void BM_AsyncResult_awaitCrossThread(benchmark::State& state) {
+    std::atomic<std::shared_ptr<AsyncResult<int>>*> pending{nullptr};
+    std::atomic_bool                                isRunning{true};
+    std::thread                                     producer([&]() {
+        while (isRunning) {
+            if (auto* pendingResult = pending.exchange(nullptr)) {
+                // like any producer, keep the result alive until the insertion is done
+                auto result = *pendingResult;
+                result->insertResult(42);
+            }
+        }
+    });
+    for (auto _ : state) {
+        auto result = std::make_shared<AsyncResult<int>>();
+        pending     = &result;
+        benchmark::DoNotOptimize(result->await());
+    }
+    isRunning = false;
+    producer.join();
+}
+
+void BM_AsyncResult_mapChain(benchmark::State& state) {
+    const auto chainLength = state.range(0);
+    for (auto _ : state) {
+        auto source = std::make_shared<AsyncResult<int>>();
+        auto mapped = source;
+        for (int64_t i = 0; i < chainLength; ++i) {
+            mapped = mapped->map<int>([](const int& value) { return value + 1; });
+        }
+        source->insertResult(0);
+        benchmark::DoNotOptimize(mapped->await());
+    }
+}
+
+void BM_AsyncResult_mapToString(benchmark::State& state) {
+    for (auto _ : state) {
+        auto source = std::make_shared<AsyncResult<int>>();
+        auto mapped =
+            source->map<std::string>([](const int& value) { return std::to_string(value); });
+        source->insertResult(42);
+        benchmark::DoNotOptimize(mapped->await());
+    }
+}
+
+void BM_AsyncSubscription_insertThenNext(benchmark::State& state) {
+    const auto                 batchSize = state.range(0);
+    AsyncSubscription<int64_t> subscription;
+    for (auto _ : state) {
+        for (int64_t i = 0; i < batchSize; ++i) {
+            subscription.insertNewItem(int64_t{i});
+        }
+        for (int64_t i = 0; i < batchSize; ++i) {
+            benchmark::DoNotOptimize(subscription.next());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+
+void BM_AsyncSubscription_insertWithOnItem(benchmark::State& state) {
+    AsyncSubscription<int64_t> subscription;
+    int64_t                    sum = 0;
+    subscription.onItem([&sum](const int64_t& item) { sum += item; });
+    for (auto _ : state) {
+        subscription.insertNewItem(int64_t{1});
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// How subscriptions hand over updates: a reply sharing the layout of its predecessors
+void BM_AsyncSubscription_insertThenNextReply(benchmark::State& state) {
+    const auto layout = std::make_shared<const DataPointLayout>(
+        std::vector<std::string>{"Vehicle.Speed", "Vehicle.Cabin.Temperature"});
+    DataPointValues_t values;
+    values.emplace_back(TypedDataPointValue<float>(layout->getInternedPath(0), 1.0F));
+    values.emplace_back(TypedDataPointValue<float>(layout->getInternedPath(1), 2.0F));
+    const auto sharedValues = std::make_shared<const DataPointValues_t>(std::move(values));
+
+    AsyncSubscription<DataPointReply> subscription;
+    for (auto _ : state) {
+        subscription.insertNewItem(DataPointReply(layout, sharedValues));
+        benchmark::DoNotOptimize(subscription.next());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_AsyncResult_insertThenAwait);
+BENCHMARK(BM_AsyncResult_onResultThenInsert);
+BENCHMARK(BM_AsyncResult_awaitCrossThread);
+BENCHMARK(BM_AsyncResult_mapChain)->Arg(1)->Arg(4);
+BENCHMARK(BM_AsyncResult_mapToString);
+BENCHMARK(BM_AsyncSubscription_insertThenNext)->Arg(1)->Arg(64);
+BENCHMARK(BM_AsyncSubscription_insertWithOnItem);
+BENCHMARK(BM_AsyncSubscription_insertThenNextReply);
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/DataPointReply.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+std::vector<std::string> createPaths(size_t numSignals) {
+    std::vector<std::string> paths;
+    paths.reserve(numSignals);
+    for (size_t i = 0; i < numSignals; ++i) {
+        paths.emplace_back("Vehicle.Some.Branch.Signal" + std::to_string(i));
+    }
+    return paths;
+}
+
+DataPointValues_t createValues(const DataPointLayout& layout) {
+    DataPointValues_t values;
+    values.reserve(layout.size());
+    int32_t i = 0;
+    for (const auto& path : layout.getPaths()) {
+        values.emplace_back(TypedDataPointValue<int32_t>(path, i++));
+    }
+    return values;
+}
+
+DataPointMap_t createMap(const DataPointLayout& layout, const DataPointValues_t& values) {
+    DataPointMap_t map;
+    for (DataPointLayout::Handle_t slot = 0; slot < layout.size(); ++slot) {
+        map.emplace(layout.getPath(slot), std::make_shared<DataPointValue>(*values[slot]));
+    }
+    return map;
+}
+
+// Baseline: the std::map which used to be the storage of a DataPointReply
+void BM_DataPointMap_construct(benchmark::State& state) {
+    const DataPointLayout layout(createPaths(state.range(0)));
+    const auto            values = createValues(layout);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(createMap(layout, values));
+    }
+}
+
+void BM_DataPointReply_constructFromMap(benchmark::State& state) {
+    const DataPointLayout layout(createPaths(state.range(0)));
+    const auto            values = createValues(layout);
+    for (auto _ : state) {
+        DataPointReply reply(createMap(layout, values));
+        benchmark::DoNotOptimize(reply);
+    }
+}
+
+// How subscriptions create their replies: The layout is shared, the values are copied
+void BM_DataPointReply_constructFromLayout(benchmark::State& state) {
+    const auto layout = std::make_shared<const DataPointLayout>(createPaths(state.range(0)));
+    const auto values = createValues(*layout);
+    for (auto _ : state) {
+        DataPointReply reply(layout, std::make_shared<const DataPointValues_t>(values));
+        benchmark::DoNotOptimize(reply);
+    }
+}
+
+void BM_DataPointMap_lookup(benchmark::State& state) {
+    const DataPointLayout layout(createPaths(state.range(0)));
+    const auto            map = createMap(layout, createValues(layout));
+    for (auto _ : state) {
+        for (const auto& path : layout.getPaths()) {
+            benchmark::DoNotOptimize(map.find(path)->second);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_DataPointReply_lookupByPath(benchmark::State& state) {
+    const auto layout = std::make_shared<const DataPointLayout>(createPaths(state.range(0)));
+    const auto values = std::make_shared<const DataPointValues_t>(createValues(*layout));
+
+    const DataPointReply reply(layout, values);
+    for (auto _ : state) {
+        for (const auto& path : layout->getPaths()) {
+            benchmark::DoNotOptimize(reply.getUntyped(path));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_DataPointReply_lookupByHandle(benchmark::State& state) {
+    const auto layout = std::make_shared<const DataPointLayout>(createPaths(state.range(0)));
+    const auto values = std::make_shared<const DataPointValues_t>(createValues(*layout));
+
+    const DataPointReply reply(layout, values);
+
+    std::vector<DataPointReply::Handle_t> handles;
+    for (const auto& path : layout->getPaths()) {
+        handles.push_back(reply.getHandle(path));
+    }
+    for (auto _ : state) {
+        for (const auto handle : handles) {
+            benchmark::DoNotOptimize(reply.getUntyped(handle));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_DataPointMap_construct)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_DataPointReply_constructFromMap)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_DataPointReply_constructFromLayout)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_DataPointMap_lookup)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_DataPointReply_lookupByPath)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_DataPointReply_lookupByHandle)->Arg(10)->Arg(100)->Arg(1000);
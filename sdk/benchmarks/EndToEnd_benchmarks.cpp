@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/DataPointReply.h"
+#include "sdk/Logger.h"
+#include "sdk/Metrics.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/BrokerClient.h"
+
+#include "FakeDataBroker.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+const std::chrono::seconds MEASUREMENT_DURATION{1};
+const std::chrono::seconds RECONNECT_TIMEOUT{30};
+const size_t               SIGNALS_PER_UPDATE = 10;
+
+const std::string SUBSCRIBE_BY_ID{"kuksa.val.v2.VAL/SubscribeById"}; // NOLINT(runtime/string)
+const std::string LIST_METADATA{"kuksa.val.v2.VAL/ListMetadata"};    // NOLINT(runtime/string)
+
+std::vector<std::string> createSignalPaths(size_t numSignals) {
+    std::vector<std::string> paths;
+    paths.reserve(numSignals);
+    for (size_t i = 0; i < numSignals; ++i) {
+        paths.push_back("Vehicle.Benchmark.Signal" + std::to_string(i));
+    }
+    return paths;
+}
+
+std::vector<FakeSignal> createCatalog(const std::vector<std::string>& paths) {
+    std::vector<FakeSignal> catalog;
+    catalog.reserve(paths.size());
+    for (const auto& path : paths) {
+        catalog.push_back(FakeSignal{path});
+    }
+    return catalog;
+}
+
+std::string createQuery(const std::vector<std::string>& paths) {
+    std::string query = "SELECT ";
+    for (const auto& path : paths) {
+        query += path + ",";
+    }
+    query.pop_back();
+    return query;
+}
+
+std::chrono::system_clock::time_point toTimePoint(const Timestamp& timestamp) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::seconds(timestamp.seconds) + std::chrono::nanoseconds(timestamp.nanos)));
+}
+
+// Time from the generation of the newest value of the reply until its receipt by the app
+void recordLatency(const DataPointReply& reply, Histogram& latencies) {
+    const auto                            receiveTime = std::chrono::system_clock::now();
+    std::chrono::system_clock::time_point newestValueTime{};
+    const auto&                           layout = *reply.getLayout();
+    for (DataPointLayout::Handle_t handle = 0; handle < layout.size(); ++handle) {
+        if (const auto* value = reply.findUntyped(handle); value != nullptr && value->isValid()) {
+            newestValueTime = std::max(newestValueTime, toTimePoint(value->getTimestamp()));
+        }
+    }
+    if (newestValueTime != std::chrono::system_clock::time_point{}) {
+        latencies.recordDuration(receiveTime - newestValueTime);
+    }
+}
+
+void setLatencyCounters(benchmark::State& state, const Histogram& latencies) {
+    const auto snapshot = latencies.getSnapshot();
+    const auto toMicros = [](uint64_t nanos) { return static_cast<double>(nanos) / 1000.0; };
+
+    state.counters["p50_us"]  = toMicros(snapshot.getQuantile(0.5));
+    state.counters["p99_us"]  = toMicros(snapshot.getQuantile(0.99));
+    state.counters["p999_us"] = toMicros(snapshot.getQuantile(0.999));
+}
+
+// Updates of SIGNALS_PER_UPDATE signals generated by the fake databroker at range(0) updates per
+// second, received via a single subscription. Each iteration measures for MEASUREMENT_DURATION.
+// Reports the received replies per second and the latency from the generation of a value until the
+// app gets it. A receive rate below the generated rate means the client (or the fake) could not
+// keep up; the fake drops updates once a stream lags MAX_PENDING_UPDATES behind.
+void BM_EndToEnd_subscribe(benchmark::State& state) {
+    logger().setLevel(LogLevel::ERROR);
+    const auto paths = createSignalPaths(SIGNALS_PER_UPDATE);
+
+    FakeDataBroker broker(createCatalog(paths));
+    broker.start();
+    std::vector<DataPointValue> initialValues;
+    for (const auto& path : paths) {
+        initialValues.push_back(TypedDataPointValue<float>(path, 0.0F));
+    }
+    broker.setValues(initialValues);
+
+    auto client =
+        std::make_unique<kuksa_val_v2::BrokerClient>(broker.getAddress(), "vehicledatabroker");
+    auto subscription = client->subscribe(createQuery(paths));
+    subscription->next();
+
+    Histogram             latencies;
+    std::atomic<uint64_t> numReceived{0};
+    subscription->onItem([&latencies, &numReceived](const DataPointReply& reply) {
+        recordLatency(reply, latencies);
+        ++numReceived;
+    });
+
+    const auto updatesPerSecond = static_cast<double>(state.range(0));
+    uint64_t   numReceivedTotal = 0;
+    for (auto _ : state) {
+        const auto receivedBefore = numReceived.load();
+        const auto start          = std::chrono::steady_clock::now();
+        broker.startUpdates(paths, updatesPerSecond);
+        std::this_thread::sleep_for(MEASUREMENT_DURATION);
+        broker.stopUpdates();
+        state.SetIterationTime(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        numReceivedTotal += numReceived.load() - receivedBefore;
+    }
+
+    state.counters["generated_per_s"] = benchmark::Counter(
+        static_cast<double>(broker.getNumGeneratedUpdates()), benchmark::Counter::kIsRate);
+    state.counters["received_per_s"] =
+        benchmark::Counter(static_cast<double>(numReceivedTotal), benchmark::Counter::kIsRate);
+    state.counters["dropped"] = static_cast<double>(broker.getNumDroppedUpdates());
+    setLatencyCounters(state, latencies);
+
+    // end the stream before the client goes away
+    broker.stop();
+    client.reset();
+}
+
+// Reconnection storm: range(0) subscriptions of distinct signals are disconnected at once by the
+// fake databroker. Each iteration measures the time until all subscriptions delivered valid values
+// again. This includes the SDK's resubscribe delay (initially 100ms) and the re-resolution of the
+// signal ids, whose calls per reconnect are reported as well.
+void BM_EndToEnd_reconnectStorm(benchmark::State& state) {
+    logger().setLevel(LogLevel::ERROR);
+    const auto numSubscriptions = static_cast<size_t>(state.range(0));
+    const auto paths            = createSignalPaths(numSubscriptions);
+
+    FakeDataBroker broker(createCatalog(paths));
+    broker.start();
+    std::vector<DataPointValue> values;
+    for (const auto& path : paths) {
+        values.push_back(TypedDataPointValue<float>(path, 1.0F));
+    }
+    broker.setValues(values);
+
+    auto client =
+        std::make_unique<kuksa_val_v2::BrokerClient>(broker.getAddress(), "vehicledatabroker");
+
+    std::mutex                                          mutex;
+    std::condition_variable                             allReconnected;
+    std::vector<bool>                                   isReconnectPending(numSubscriptions, false);
+    size_t                                              numReconnectsPending = 0;
+    std::vector<AsyncSubscriptionPtr_t<DataPointReply>> subscriptions;
+    for (size_t i = 0; i < numSubscriptions; ++i) {
+        subscriptions.push_back(client->subscribe(createQuery({paths[i]})));
+        subscriptions.back()->next();
+        subscriptions.back()->onItem([&, i, path = paths[i]](const DataPointReply& reply) {
+            if (!reply.getUntyped(path)->isValid()) {
+                return;
+            }
+            std::lock_guard lock(mutex);
+            if (isReconnectPending[i]) {
+                isReconnectPending[i] = false;
+                if (--numReconnectsPending == 0) {
+                    allReconnected.notify_all();
+                }
+            }
+        });
+    }
+
+    const auto subscribeCallsBefore = broker.getNumCalls(SUBSCRIBE_BY_ID);
+    const auto metadataCallsBefore  = broker.getNumCalls(LIST_METADATA);
+    for (auto _ : state) {
+        {
+            std::lock_guard lock(mutex);
+            std::fill(isReconnectPending.begin(), isReconnectPending.end(), true);
+            numReconnectsPending = numSubscriptions;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        broker.disconnectSubscriptions();
+        std::unique_lock lock(mutex);
+        if (!allReconnected.wait_for(lock, RECONNECT_TIMEOUT,
+                                     [&]() { return numReconnectsPending == 0; })) {
+            state.SkipWithError("Subscriptions not re-established in time");
+            break;
+        }
+        state.SetIterationTime(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    const auto iterations = static_cast<double>(std::max<benchmark::IterationCount>(
+        state.iterations(), benchmark::IterationCount{1}));
+    state.counters["subscribe_calls_per_reconnect"] =
+        static_cast<double>(broker.getNumCalls(SUBSCRIBE_BY_ID) - subscribeCallsBefore) /
+        iterations;
+    state.counters["metadata_calls_per_reconnect"] =
+        static_cast<double>(broker.getNumCalls(LIST_METADATA) - metadataCallsBefore) / iterations;
+
+    broker.stop();
+    subscriptions.clear();
+    client.reset();
+}
+
+} // namespace
+
+BENCHMARK(BM_EndToEnd_subscribe)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(50000)
+    ->Iterations(3)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EndToEnd_reconnectStorm)
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(100)
+    ->Iterations(5)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
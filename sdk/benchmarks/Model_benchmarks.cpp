@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/DataPoint.h"
+#include "sdk/Node.h"
+#include "sdk/QueryBuilder.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+// A chain of branches of the passed depth, the last one being the leaf
+std::vector<std::unique_ptr<Node>> createBranchChain(size_t depth) {
+    std::vector<std::unique_ptr<Node>> nodes;
+    Node*                              parent = nullptr;
+    for (size_t i = 0; i < depth; ++i) {
+        nodes.emplace_back(std::make_unique<Node>("Branch" + std::to_string(i), parent));
+        parent = nodes.back().get();
+    }
+    return nodes;
+}
+
+std::vector<std::unique_ptr<DataPointFloat>> createDataPoints(size_t numDataPoints, Node* parent) {
+    std::vector<std::unique_ptr<DataPointFloat>> dataPoints;
+    dataPoints.reserve(numDataPoints);
+    for (size_t i = 0; i < numDataPoints; ++i) {
+        dataPoints.emplace_back(
+            std::make_unique<DataPointFloat>("Signal" + std::to_string(i), parent));
+    }
+    return dataPoints;
+}
+
+void BM_Node_getPath(benchmark::State& state) {
+    const auto  nodes = createBranchChain(state.range(0));
+    const auto& leaf  = *nodes.back();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(leaf.getPath());
+    }
+}
+
+// The path is built (and interned) when the node is constructed
+void BM_Node_construct(benchmark::State& state) {
+    const auto nodes  = createBranchChain(state.range(0));
+    auto*      parent = nodes.back().get();
+    for (auto _ : state) {
+        Node leaf("Leaf", parent);
+        benchmark::DoNotOptimize(leaf.getPath());
+    }
+}
+
+void BM_QueryBuilder_select(benchmark::State& state) {
+    const auto branches   = createBranchChain(3);
+    const auto dataPoints = createDataPoints(state.range(0), branches.back().get());
+
+    std::vector<std::reference_wrapper<DataPoint>> selection;
+    for (const auto& dataPoint : dataPoints) {
+        selection.emplace_back(*dataPoint);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(QueryBuilder::select(selection).build());
+    }
+}
+
+void BM_QueryBuilder_selectWhere(benchmark::State& state) {
+    const auto     branches = createBranchChain(3);
+    DataPointFloat speed("Speed", branches.back().get());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(QueryBuilder::select(speed).where(speed).gt(10.0F).build());
+    }
+}
+
+void BM_parseQuery(benchmark::State& state) {
+    const auto branches   = createBranchChain(3);
+    const auto dataPoints = createDataPoints(state.range(0), branches.back().get());
+
+    std::vector<std::reference_wrapper<DataPoint>> selection;
+    for (const auto& dataPoint : dataPoints) {
+        selection.emplace_back(*dataPoint);
+    }
+    const auto query = QueryBuilder::select(selection).build();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kuksa_val_v2::parseQuery(query));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Node_getPath)->Arg(2)->Arg(8);
+BENCHMARK(BM_Node_construct)->Arg(2)->Arg(8);
+BENCHMARK(BM_QueryBuilder_select)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK(BM_QueryBuilder_selectWhere);
+BENCHMARK(BM_parseQuery)->Arg(1)->Arg(10)->Arg(100);
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Job.h"
+#include "sdk/ThreadPool.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+using namespace velocitas;
+
+namespace {
+
+constexpr int64_t JOBS_PER_ITERATION = 1000;
+
+void waitForExecutedJobs(const std::atomic_int64_t& numExecuted, int64_t expected) {
+    while (numExecuted.load(std::memory_order_acquire) < expected) {
+        std::this_thread::yield();
+    }
+}
+
+// Enqueues a batch of jobs from outside the pool and waits until all of them got executed.
+// range(0) is the number of workers.
+void BM_ThreadPool_immediateJobs(benchmark::State& state) {
+    std::atomic_int64_t numExecuted{0};
+    int64_t             numEnqueued = 0;
+    ThreadPool          pool(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (int64_t i = 0; i < JOBS_PER_ITERATION; ++i) {
+            pool.enqueue(Job::create([&numExecuted]() { ++numExecuted; }));
+        }
+        numEnqueued += JOBS_PER_ITERATION;
+        waitForExecutedJobs(numExecuted, numEnqueued);
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS_PER_ITERATION);
+}
+
+// Jobs enqueueing their follow-up job, i.e. the local queue of a worker
+void BM_ThreadPool_jobsEnqueuedByWorker(benchmark::State& state) {
+    std::atomic_int64_t numExecuted{0};
+    int64_t             numEnqueued = 0;
+    ThreadPool          pool(static_cast<size_t>(state.range(0)));
+
+    std::function<void(int64_t)> enqueueChain = [&](int64_t remaining) {
+        pool.enqueue(Job::create([&, remaining]() {
+            ++numExecuted;
+            if (remaining > 1) {
+                enqueueChain(remaining - 1);
+            }
+        }));
+    };
+    for (auto _ : state) {
+        enqueueChain(JOBS_PER_ITERATION);
+        numEnqueued += JOBS_PER_ITERATION;
+        waitForExecutedJobs(numExecuted, numEnqueued);
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS_PER_ITERATION);
+}
+
+// Cost of enqueueing delayed jobs into the timer queue. The jobs would become due long after the
+// measurement, so only the enqueue path is measured. A fresh pool per batch keeps the timer queue
+// from growing across iterations.
+void BM_ThreadPool_enqueueDelayedJobs(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto pool = std::make_unique<ThreadPool>(static_cast<size_t>(state.range(0)));
+        state.ResumeTiming();
+        for (int64_t i = 0; i < JOBS_PER_ITERATION; ++i) {
+            pool->enqueue(Job::create([]() {}, std::chrono::hours{1}));
+        }
+        state.PauseTiming();
+        pool.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS_PER_ITERATION);
+}
+
+// Delayed jobs becoming due right away, i.e. including the transfer from the timer queue to the
+// workers
+void BM_ThreadPool_shortlyDelayedJobs(benchmark::State& state) {
+    std::atomic_int64_t numExecuted{0};
+    int64_t             numEnqueued = 0;
+    ThreadPool          pool(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (int64_t i = 0; i < JOBS_PER_ITERATION; ++i) {
+            pool.enqueue(
+                Job::create([&numExecuted]() { ++numExecuted; }, std::chrono::milliseconds{1}));
+        }
+        numEnqueued += JOBS_PER_ITERATION;
+        waitForExecutedJobs(numExecuted, numEnqueued);
+    }
+    state.SetItemsProcessed(state.iterations() * JOBS_PER_ITERATION);
+}
+
+} // namespace
+
+BENCHMARK(BM_ThreadPool_immediateJobs)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+BENCHMARK(BM_ThreadPool_jobsEnqueuedByWorker)->Arg(1)->Arg(4)->UseRealTime();
+BENCHMARK(BM_ThreadPool_enqueueDelayedJobs)->Arg(2);
+BENCHMARK(BM_ThreadPool_shortlyDelayedJobs)->Arg(2)->UseRealTime();
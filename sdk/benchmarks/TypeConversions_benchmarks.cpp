@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/DataPointValue.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
+#include "sdk/vdb/grpc/sdv_databroker_v1/TypeConversions.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+const InternedPath PATH{"Vehicle.Some.Branch.Signal"};
+
+template <typename T> T createScalar(size_t index) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return (index % 2) == 0;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return "value" + std::to_string(index);
+    } else {
+        return static_cast<T>(index % 100);
+    }
+}
+
+// Scalars are benchmarked with range(0) == 0, arrays with range(0) elements
+template <typename T> DataPointValue createValue(size_t numElements) {
+    if (numElements == 0) {
+        return TypedDataPointValue<T>(PATH, createScalar<T>(1));
+    }
+    std::vector<T> array;
+    array.reserve(numElements);
+    for (size_t i = 0; i < numElements; ++i) {
+        array.push_back(createScalar<T>(i));
+    }
+    return TypedDataPointValue<std::vector<T>>(PATH, std::move(array));
+}
+
+void setItemsProcessed(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * std::max<int64_t>(state.range(0), 1));
+}
+
+template <typename T> void BM_kuksaValV2_convertToGrpcValue(benchmark::State& state) {
+    const auto value = createValue<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kuksa_val_v2::convertToGrpcValue(value));
+    }
+    setItemsProcessed(state);
+}
+
+template <typename T> void BM_kuksaValV2_convertFromGrpcValue(benchmark::State& state) {
+    const auto grpcValue = kuksa_val_v2::convertToGrpcValue(createValue<T>(state.range(0)));
+    const auto timestamp = Timestamp{1, 2};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kuksa_val_v2::convertFromGrpcValue(PATH, grpcValue, timestamp));
+    }
+    setItemsProcessed(state);
+}
+
+template <typename T> void BM_sdvDatabrokerV1_convertDataPointToInternal(benchmark::State& state) {
+    const auto grpcDataPoint =
+        sdv_databroker_v1::convertToGrpcDataPoint(createValue<T>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            sdv_databroker_v1::convertDataPointToInternal(PATH, grpcDataPoint));
+    }
+    setItemsProcessed(state);
+}
+
+} // namespace
+
+// 0 = scalar, otherwise the number of array elements
+#define CONVERSION_ARGS ->Arg(0)->Arg(1)->Arg(100)->Arg(10000)
+
+#define CONVERSION_BENCHMARKS(type)                                                                \
+    BENCHMARK_TEMPLATE(BM_kuksaValV2_convertToGrpcValue, type) CONVERSION_ARGS;                    \
+    BENCHMARK_TEMPLATE(BM_kuksaValV2_convertFromGrpcValue, type) CONVERSION_ARGS;                  \
+    BENCHMARK_TEMPLATE(BM_sdvDatabrokerV1_convertDataPointToInternal, type) CONVERSION_ARGS
+
+CONVERSION_BENCHMARKS(bool);
+CONVERSION_BENCHMARKS(int8_t);
+CONVERSION_BENCHMARKS(int16_t);
+CONVERSION_BENCHMARKS(int32_t);
+CONVERSION_BENCHMARKS(int64_t);
+CONVERSION_BENCHMARKS(uint8_t);
+CONVERSION_BENCHMARKS(uint16_t);
+CONVERSION_BENCHMARKS(uint32_t);
+CONVERSION_BENCHMARKS(uint64_t);
+CONVERSION_BENCHMARKS(float);
+CONVERSION_BENCHMARKS(double);
+CONVERSION_BENCHMARKS(std::string);
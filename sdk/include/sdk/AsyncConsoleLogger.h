@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_ASYNCCONSOLELOGGER_H
+#define VEHICLE_APP_SDK_ASYNCCONSOLELOGGER_H
+
+#include "sdk/LockFreeRingBuffer.h"
+#include "sdk/Logger.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace velocitas {
+
+/**
+ * @brief Logger implementation writing to the console from a background thread.
+ *
+ * The logging thread only formats the line and hands it over via a lock-free ring buffer, the
+ * writes to the stream (and their flushes) are done by the writer thread. If the buffer is full,
+ * the message is either dropped (reported by the writer later on) or the logging thread waits for
+ * the writer to catch up, depending on the overflow policy.
+ *
+ * Pending messages are written when the logger is destroyed.
+ */
+class AsyncConsoleLogger : public ILogger {
+public:
+    enum class OverflowPolicy {
+        DROP, ///< Drop the message, never blocking the logging thread
+        BLOCK ///< Wait for the writer to free a slot
+    };
+
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+    /**
+     * @brief Construct a new async console logger and start its writer thread.
+     *
+     * @param capacity        Max. number of messages waiting to be written.
+     * @param overflowPolicy  What to do with messages exceeding the capacity.
+     * @param stream          The stream to write to.
+     */
+    explicit AsyncConsoleLogger(size_t         capacity       = DEFAULT_CAPACITY,
+                                OverflowPolicy overflowPolicy = OverflowPolicy::DROP,
+                                std::FILE*     stream         = stdout);
+
+    ~AsyncConsoleLogger() override;
+
+    AsyncConsoleLogger(const AsyncConsoleLogger&)            = delete;
+    AsyncConsoleLogger(AsyncConsoleLogger&&)                 = delete;
+    AsyncConsoleLogger& operator=(const AsyncConsoleLogger&) = delete;
+    AsyncConsoleLogger& operator=(AsyncConsoleLogger&&)      = delete;
+
+    void info(const std::string& msg) override;
+    void warn(const std::string& msg) override;
+    void error(const std::string& msg) override;
+    void debug(const std::string& msg) override;
+
+    /**
+     * @brief Block until all messages logged so far are written to the stream.
+     */
+    void flush();
+
+    /**
+     * @brief Returns the number of messages dropped because of a full buffer.
+     */
+    [[nodiscard]] uint64_t getNumDroppedMessages() const { return m_numDropped; }
+
+private:
+    void push(std::string&& line);
+    void wakeUpWriter();
+    void runWriter();
+
+    LockFreeRingBuffer<std::string> m_buffer;
+    OverflowPolicy                  m_overflowPolicy;
+    std::FILE*                      m_stream;
+    std::atomic_uint64_t            m_numPushed{0};
+    std::atomic_uint64_t            m_numWritten{0};
+    std::atomic_uint64_t            m_numDropped{0};
+    std::atomic_bool                m_isWriterIdle{false};
+    std::atomic_bool                m_isStopping{false};
+    std::mutex                      m_wakeUpMutex;
+    std::condition_variable         m_wakeUpCv;
+    std::thread                     m_writer;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_ASYNCCONSOLELOGGER_H
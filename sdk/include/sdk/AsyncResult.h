@@ -18,13 +18,21 @@
 #define VEHICLE_APP_SDK_ASYNCRESULT_H
 
 #include "sdk/Exceptions.h"
+#include "sdk/InlineFunction.h"
+#include "sdk/RingBuffer.h"
 #include "sdk/Status.h"
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace velocitas {
 
@@ -59,10 +67,35 @@ struct VoidResult {};
 
 enum class CallState { ONGOING, CANCELING, COMPLETED, FAILED };
 
+namespace detail {
+
+/**
+ * @brief Blocks the calling thread as long as the value of the given state equals the expected
+ *        value. May return spuriously, so callers need to re-check the state afterwards.
+ *
+ * @param state          The state to watch.
+ * @param expectedValue  Value the state is expected to have while blocking.
+ */
+void waitWhileEqual(const std::atomic_uint32_t& state, uint32_t expectedValue);
+
+/**
+ * @brief Wakes up all threads blocked in waitWhileEqual() on the given state.
+ *
+ * @param state  The state the threads are waiting on.
+ */
+void wakeAllWaiters(const std::atomic_uint32_t& state);
+
+} // namespace detail
+
 /**
  * @brief Single result of an asynchronous operation which provides
  *        an item of type TResultType.
  *
+ * The result is synchronized via an atomic state only: Whoever of producer (insertResult,
+ * insertError) and consumer (onResult, onError) comes second invokes the callback. Callbacks are
+ * stored within the object itself, so creating a result via std::make_shared is the only
+ * allocation needed.
+ *
  * @tparam TResultType  Result type of the async operation.
  */
 template <typename TResultType> class AsyncResult {
@@ -70,11 +103,7 @@ public:
     using ResultCallback_t = std::function<void(const TResultType&)>;
     using ErrorCallback_t  = std::function<void(Status)>;
 
-    AsyncResult() {
-        // initially lock the mutex until we have written the result.
-        // this will cause await() to block until the result is available.
-        m_mutex.lock();
-    };
+    AsyncResult() = default;
 
     /**
      * @brief Inserts the result and notifies any waiters.
@@ -82,13 +111,14 @@ public:
      * @param result  Result to insert.
      */
     void insertResult(TResultType&& result) {
-        m_callState = CallState::COMPLETED;
-        if (m_callback != nullptr) {
-            m_callback(result);
-        } else {
-            m_result = std::move(result);
+        m_result            = std::move(result);
+        const auto oldState = m_state.fetch_or(RESULT_AVAILABLE, std::memory_order_acq_rel);
+        if ((oldState & RESULT_CALLBACK_SET) != 0) {
+            m_resultCallback(m_result);
+        }
+        if ((oldState & AWAITING) != 0) {
+            detail::wakeAllWaiters(m_state);
         }
-        m_mutex.unlock();
     }
 
     /**
@@ -97,13 +127,14 @@ public:
      * @param error Status containing error information.
      */
     void insertError(Status&& error) {
-        m_callState = CallState::FAILED;
-        if (m_errorCallback != nullptr) {
-            m_errorCallback(error);
-        } else {
-            m_status = error;
+        m_status            = std::move(error);
+        const auto oldState = m_state.fetch_or(ERROR_AVAILABLE, std::memory_order_acq_rel);
+        if ((oldState & ERROR_CALLBACK_SET) != 0) {
+            m_errorCallback(m_status);
+        }
+        if ((oldState & AWAITING) != 0) {
+            detail::wakeAllWaiters(m_state);
         }
-        m_mutex.unlock();
     }
 
     /**
@@ -115,20 +146,22 @@ public:
      * @return TResultType    Result of the async operation once it completes.
      */
     TResultType await() {
-        if (m_callback) {
+        if ((m_state.load(std::memory_order_acquire) & RESULT_CALLBACK_SET) != 0) {
             throw std::runtime_error(
                 "Invalid usage: Either call await() or register an onResult callback!");
         }
 
-        {
-            ScopedBoolInverter           boolInverter{m_awaiting};
-            std::unique_lock<std::mutex> lock(m_mutex);
+        auto state = m_state.fetch_or(AWAITING, std::memory_order_acq_rel) | AWAITING;
+        while ((state & COMPLETED) == 0) {
+            detail::waitWhileEqual(m_state, state);
+            state = m_state.load(std::memory_order_acquire);
+        }
+        m_state.fetch_and(~AWAITING, std::memory_order_acq_rel);
 
-            if (m_status.ok()) {
-                return m_result;
-            }
-            throw AsyncException(m_status.errorMessage());
+        if ((state & RESULT_AVAILABLE) != 0) {
+            return m_result;
         }
+        throw AsyncException(m_status.errorMessage());
     }
 
     /**
@@ -139,15 +172,7 @@ public:
      * @return AsyncResult* This for method chaining.
      */
     AsyncResult* onResult(ResultCallback_t callback) {
-        if (m_awaiting) {
-            throw std::runtime_error(
-                "Invalid usage: Either call await() or register an onResult callback!");
-        }
-        m_callback = callback;
-        if (m_callState == CallState::COMPLETED) {
-            m_callback(m_result);
-        }
-        return this;
+        return onResultInternal(std::move(callback));
     }
 
     /**
@@ -158,11 +183,7 @@ public:
      * @return AsyncResult* This for method chaining.
      */
     AsyncResult* onError(ErrorCallback_t callback) {
-        m_errorCallback = callback;
-        if (m_callState == CallState::FAILED) {
-            m_errorCallback(m_status);
-        }
-        return this;
+        return onErrorInternal(std::move(callback));
     }
 
     /**
@@ -171,7 +192,19 @@ public:
      * @return true
      * @return false
      */
-    [[nodiscard]] bool isInAwaitingState() const { return m_awaiting; }
+    [[nodiscard]] bool isInAwaitingState() const {
+        return (m_state.load(std::memory_order_acquire) & AWAITING) != 0;
+    }
+
+    /**
+     * @brief Return if the operation completed, either successfully or with an error.
+     *
+     * @return true
+     * @return false
+     */
+    [[nodiscard]] bool isCompleted() const {
+        return (m_state.load(std::memory_order_acquire) & COMPLETED) != 0;
+    }
 
     /**
      * @brief Map the result to a different type using the provided mapper function.
@@ -185,44 +218,105 @@ public:
     std::shared_ptr<AsyncResult<TNewType>> map(std::function<TNewType(const TResultType&)> mapper) {
         auto mappedResult = std::make_shared<AsyncResult<TNewType>>();
 
-        onResult([mappedResult, mapper](auto item) { mappedResult->insertResult(mapper(item)); });
+        // The continuations fit into the inline storage of the callbacks, so the mapped result
+        // is the only allocation.
+        onErrorInternal([mappedResult](const Status& status) {
+            mappedResult->insertError(Status(status));
+        });
+        onResultInternal([mappedResult, mapper = std::move(mapper)](const TResultType& item) {
+            mappedResult->insertResult(mapper(item));
+        });
 
-        onError([mappedResult](auto status) { mappedResult->insertError(std::move(status)); });
+        return mappedResult;
+    }
 
-        if (m_mutex.try_lock()) {
-            // result already available?!
-            if (m_status.ok()) {
-                mappedResult->insertResult(mapper(m_result));
-            } else {
-                mappedResult->insertError(std::move(m_status));
-            }
+private:
+    enum StateFlags : uint32_t {
+        RESULT_AVAILABLE    = 1U << 0U,
+        ERROR_AVAILABLE     = 1U << 1U,
+        COMPLETED           = RESULT_AVAILABLE | ERROR_AVAILABLE,
+        RESULT_CALLBACK_SET = 1U << 2U,
+        ERROR_CALLBACK_SET  = 1U << 3U,
+        AWAITING            = 1U << 4U,
+    };
+
+    using InlineResultCallback_t = InlineFunction<void(const TResultType&)>;
+    using InlineErrorCallback_t  = InlineFunction<void(const Status&)>;
+
+    AsyncResult* onResultInternal(InlineResultCallback_t callback) {
+        if (isInAwaitingState()) {
+            throw std::runtime_error(
+                "Invalid usage: Either call await() or register an onResult callback!");
         }
+        m_resultCallback    = std::move(callback);
+        const auto oldState = m_state.fetch_or(RESULT_CALLBACK_SET, std::memory_order_acq_rel);
+        if ((oldState & RESULT_AVAILABLE) != 0) {
+            m_resultCallback(m_result);
+        }
+        return this;
+    }
 
-        return mappedResult;
+    AsyncResult* onErrorInternal(InlineErrorCallback_t callback) {
+        m_errorCallback     = std::move(callback);
+        const auto oldState = m_state.fetch_or(ERROR_CALLBACK_SET, std::memory_order_acq_rel);
+        if ((oldState & ERROR_AVAILABLE) != 0) {
+            m_errorCallback(m_status);
+        }
+        return this;
     }
 
-private:
-    CallState        m_callState{CallState::ONGOING};
-    TResultType      m_result;
-    ResultCallback_t m_callback;
-    ErrorCallback_t  m_errorCallback;
-    std::mutex       m_mutex;
-    bool             m_awaiting{false};
-    Status           m_status{};
+    std::atomic_uint32_t   m_state{0};
+    TResultType            m_result{};
+    Status                 m_status{};
+    InlineResultCallback_t m_resultCallback;
+    InlineErrorCallback_t  m_errorCallback;
 };
 
 template <typename T> using AsyncResultPtr_t = std::shared_ptr<AsyncResult<T>>;
 
+/**
+ * @brief Behaviour of a subscription's item buffer once its capacity is reached.
+ */
+enum class OverflowPolicy {
+    DROP_OLDEST,     ///< Discard the oldest buffered item to make room for the new one.
+    DROP_NEWEST,     ///< Discard the new item.
+    COALESCE_LATEST, ///< Merge the new item into the newest buffered one.
+    BLOCK_PRODUCER,  ///< Block the inserting thread until the consumer made room.
+};
+
+/**
+ * @brief Customization point describing how two subscription items are coalesced.
+ *        The default replaces the buffered item by the newer one. Item types consisting of
+ *        several independent values (e.g. DataPointReply) merge them instead.
+ *
+ * @tparam TItem  Item type of the subscription.
+ */
+template <typename TItem> struct SubscriptionItemTraits {
+    static void coalesce(TItem& bufferedItem, TItem&& newerItem) {
+        bufferedItem = std::move(newerItem);
+    }
+};
+
 /**
  * @brief An asynchronous subscription to a data source which provides
  *        items of type TResultType.
  *
- * @tparam TResultType  Item type of the async subscription.
+ * Items not consumed via a callback are buffered until they are retrieved via next(). By default
+ * the buffer is unbounded, setBufferCapacity() limits it and selects what happens on overflow.
+ *
+ * @tparam TResultType  Item type of the async subscription, needs to be move constructible.
+ *                      setObserver() additionally requires it to be copy constructible.
  */
 template <typename TResultType> class AsyncSubscription {
 public:
     using ItemCallback_t  = std::function<void(const TResultType&)>;
     using ErrorCallback_t = std::function<void(Status)>;
+    using SignalSetChangeHandler_t =
+        std::function<void(const std::vector<std::string>& addedSignalPaths,
+                           const std::vector<std::string>& removedSignalPaths)>;
+
+    /// Buffer capacity meaning "unbounded"
+    static constexpr size_t UNBOUNDED = 0;
 
     AsyncSubscription() noexcept = default;
 
@@ -233,14 +327,13 @@ public:
      */
     TResultType next() {
         std::unique_lock<std::mutex> lock(m_bufferMutex);
-        if (m_bufferedItems.empty()) {
-            m_cv.wait(lock);
-        }
+        m_cv.wait(lock, [this] { return !m_bufferedItems.empty() || !m_status.ok(); });
 
         if (m_status.ok()) {
-            auto temp = m_bufferedItems.back();
-            m_bufferedItems.pop_back();
-            return temp;
+            auto item = m_bufferedItems.pop_front();
+            lock.unlock();
+            m_spaceAvailableCv.notify_one();
+            return item;
         }
         throw AsyncException(m_status.errorMessage());
     }
@@ -270,51 +363,290 @@ public:
         return this;
     }
 
+    /**
+     * @brief Limits the number of items buffered for retrieval via next().
+     *
+     * Data point subscriptions sharing a stream to the databroker (kuksa.val.v2) do not block
+     * the stream with BLOCK_PRODUCER. They wait on a thread of the SDK instead and conflate the
+     * updates arriving meanwhile into the next item.
+     *
+     * @param capacity              Max. number of buffered items, UNBOUNDED for no limit.
+     * @param overflowPolicy        What to do with new items once the capacity is reached.
+     * @return AsyncSubscription*   This subscription for method chaining.
+     */
+    AsyncSubscription*
+    setBufferCapacity(size_t capacity, OverflowPolicy overflowPolicy = OverflowPolicy::DROP_OLDEST) {
+        {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            m_capacity       = capacity;
+            m_overflowPolicy = overflowPolicy;
+        }
+        m_spaceAvailableCv.notify_all();
+        return this;
+    }
+
+    /**
+     * @brief Returns the number of items discarded because of a full buffer.
+     */
+    [[nodiscard]] uint64_t getNumDroppedItems() const { return m_numDroppedItems; }
+
+    /**
+     * @brief Returns the number of items merged into an already buffered item.
+     */
+    [[nodiscard]] uint64_t getNumCoalescedItems() const { return m_numCoalescedItems; }
+
+    /**
+     * @brief Checks if inserting an item would block the inserting thread right now, i.e. the
+     *        buffer is full and the overflow policy is BLOCK_PRODUCER.
+     */
+    [[nodiscard]] bool wouldBlockProducer() const {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        return (m_overflowPolicy == OverflowPolicy::BLOCK_PRODUCER) && isBufferFull() &&
+               !m_cancelled && !m_failed;
+    }
+
     /**
      * @brief Inserts new data into the subscription. Notifies any waiters.
      *
      * @param result  Result to insert.
      */
     void insertNewItem(TResultType&& result) {
-        if (m_callback != nullptr) {
-            m_callback(result);
-        } else {
-            {
-                std::lock_guard<std::mutex> lock(m_bufferMutex);
-                m_bufferedItems.insert(m_bufferedItems.begin(), result);
-            }
-            m_cv.notify_all();
+        // Held until the item is buffered, so setObserver() either replays or observes it
+        std::unique_lock<std::mutex> observerLock(m_observerMutex);
+        if ((m_callback == nullptr) && !waitForSpace(observerLock)) {
+            return;
+        }
+        if (m_itemObserver != nullptr) {
+            m_itemObserver(result);
         }
+        if (m_callback == nullptr) {
+            bufferItem(std::move(result));
+            return;
+        }
+        observerLock.unlock();
+        m_callback(result);
     }
 
     /**
-     * @brief Inserts a new error into the subscription. Notifies any waiters.
+     * @brief Inserts a new error into the subscription. Notifies any waiters, incl. producers
+     *        blocked on a full buffer, which discard their items.
      *
      * @param error Status with error information.
      */
     void insertError(Status&& error) {
-        if (m_errorCallback != nullptr) {
-            m_errorCallback(error);
-        } else {
-            m_status = error;
-            m_cv.notify_all();
+        {
+            std::lock_guard<std::mutex> observerLock(m_observerMutex);
+            if (m_errorObserver != nullptr) {
+                m_errorObserver(error);
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_bufferMutex);
+                m_failed = true;
+                if (m_errorCallback == nullptr) {
+                    m_status = error;
+                }
+            }
+            m_spaceAvailableCv.notify_all();
+            if (m_errorCallback == nullptr) {
+                m_cv.notify_all();
+                return;
+            }
         }
+        m_errorCallback(error);
+    }
+
+    /**
+     * @brief Returns true if the subscription was cancelled, i.e. the consumer is not interested
+     *        in further items.
+     */
+    [[nodiscard]] bool isCancelled() const {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        return m_cancelled;
     }
 
     /**
      * @brief Cancels the subscription.
      *
      */
-    void cancel() { m_cancelled = true; }
+    void cancel() {
+        {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            m_cancelled = true;
+        }
+        m_spaceAvailableCv.notify_all();
+    }
+
+    /**
+     * @brief Adds signals to the subscription without interrupting it. Values known for the other
+     *        signals are kept. Items delivered afterwards refer to the changed set of signals, i.e.
+     *        handles obtained from earlier items need to be resolved again.
+     *
+     * @param signalPaths  Paths of the signals to add, signals already subscribed are ignored.
+     * @throw std::runtime_error if the subscription does not support changing its signals.
+     */
+    void addSignals(const std::vector<std::string>& signalPaths) {
+        getSignalSetChangeHandler()(signalPaths, {});
+    }
+
+    /**
+     * @brief Removes signals from the subscription without interrupting it. Values known for the
+     *        other signals are kept. Items delivered afterwards refer to the changed set of
+     *        signals, i.e. handles obtained from earlier items need to be resolved again.
+     *
+     * @param signalPaths  Paths of the signals to remove, signals not subscribed are ignored.
+     * @throw std::runtime_error if the subscription does not support changing its signals.
+     */
+    void removeSignals(const std::vector<std::string>& signalPaths) {
+        getSignalSetChangeHandler()({}, signalPaths);
+    }
+
+    /**
+     * @brief Sets the handler applying addSignals() and removeSignals() to the data source. Needs
+     *        to be set by the data source before the subscription is handed out.
+     *
+     * @param handler  The handler to invoke.
+     */
+    void setSignalSetChangeHandler(SignalSetChangeHandler_t handler) {
+        m_signalSetChangeHandler = std::move(handler);
+    }
+
+    /**
+     * @brief Sets the max. time the data source may hold back a change before delivering it, e.g.
+     *        the interval of a conflating subscription. Needs to be set by the data source before
+     *        the subscription is handed out.
+     *
+     * @param delay  The max. delay, zero (the default) if every change is delivered right away.
+     */
+    void setMaxDeliveryDelay(std::chrono::milliseconds delay) { m_maxDeliveryDelay = delay; }
+
+    /**
+     * @brief Returns the max. time the data source may hold back a change before delivering it.
+     */
+    [[nodiscard]] std::chrono::milliseconds getMaxDeliveryDelay() const {
+        return m_maxDeliveryDelay;
+    }
+
+    /**
+     * @brief Sets callbacks observing all items and errors before they are delivered to the
+     *        consumer, e.g. to keep track of the latest values. Needs to be set by the data source
+     *        (or a client wrapping it) before the subscription is handed out. The callbacks are
+     *        invoked by the thread inserting the item or error. Items and errors buffered before
+     *        are passed to the callbacks right away, as the data source may already be feeding
+     *        the subscription.
+     *
+     * @param itemObserver   The callback to invoke for each item.
+     * @param errorObserver  The callback to invoke for each error.
+     */
+    void setObserver(ItemCallback_t itemObserver, ErrorCallback_t errorObserver) {
+        std::lock_guard<std::mutex> observerLock(m_observerMutex);
+        m_itemObserver  = std::move(itemObserver);
+        m_errorObserver = std::move(errorObserver);
+
+        std::vector<TResultType> bufferedItems;
+        Status                   status;
+        {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            bufferedItems.reserve(m_bufferedItems.size());
+            for (size_t index = 0; index < m_bufferedItems.size(); ++index) {
+                bufferedItems.push_back(m_bufferedItems[index]);
+            }
+            status = m_status;
+        }
+        if (m_itemObserver != nullptr) {
+            for (const auto& item : bufferedItems) {
+                m_itemObserver(item);
+            }
+        }
+        if (!status.ok() && (m_errorObserver != nullptr)) {
+            m_errorObserver(status);
+        }
+    }
 
 private:
-    std::vector<TResultType> m_bufferedItems;
-    ItemCallback_t           m_callback;
-    ErrorCallback_t          m_errorCallback;
-    std::mutex               m_bufferMutex;
-    bool                     m_cancelled{false};
-    Status                   m_status{};
-    std::condition_variable  m_cv;
+    [[nodiscard]] const SignalSetChangeHandler_t& getSignalSetChangeHandler() const {
+        if (m_signalSetChangeHandler == nullptr) {
+            throw std::runtime_error("Subscription does not support changing its signals!");
+        }
+        return m_signalSetChangeHandler;
+    }
+
+    /**
+     * @brief Blocks while the buffer is full and the overflow policy is BLOCK_PRODUCER. The
+     *        observer lock is released while waiting, so that errors can still be inserted.
+     *
+     * @return false if the item is to be discarded, as the subscription was cancelled or failed.
+     */
+    bool waitForSpace(std::unique_lock<std::mutex>& observerLock) {
+        std::unique_lock<std::mutex> lock(m_bufferMutex);
+        while ((m_overflowPolicy == OverflowPolicy::BLOCK_PRODUCER) && isBufferFull()) {
+            if (m_cancelled || m_failed) {
+                return false;
+            }
+            observerLock.unlock();
+            m_spaceAvailableCv.wait(lock);
+            // re-acquire in the usual order, the observer lock first
+            lock.unlock();
+            observerLock.lock();
+            lock.lock();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Buffers the passed item for retrieval via next(), obeying the buffer capacity.
+     */
+    void bufferItem(TResultType&& result) {
+        {
+            std::unique_lock<std::mutex> lock(m_bufferMutex);
+            if (isBufferFull()) {
+                switch (m_overflowPolicy) {
+                case OverflowPolicy::DROP_OLDEST:
+                    m_bufferedItems.pop_front();
+                    ++m_numDroppedItems;
+                    break;
+                case OverflowPolicy::DROP_NEWEST:
+                    ++m_numDroppedItems;
+                    return;
+                case OverflowPolicy::COALESCE_LATEST:
+                    SubscriptionItemTraits<TResultType>::coalesce(m_bufferedItems.back(),
+                                                                  std::move(result));
+                    ++m_numCoalescedItems;
+                    lock.unlock();
+                    m_cv.notify_all();
+                    return;
+                case OverflowPolicy::BLOCK_PRODUCER:
+                    // waitForSpace() made room, only a capacity reduced meanwhile gets exceeded
+                    break;
+                }
+            }
+            m_bufferedItems.push_back(std::move(result));
+        }
+        m_cv.notify_all();
+    }
+
+    [[nodiscard]] bool isBufferFull() const {
+        return (m_capacity != UNBOUNDED) && (m_bufferedItems.size() >= m_capacity);
+    }
+
+    RingBuffer<TResultType>   m_bufferedItems;
+    size_t                    m_capacity{UNBOUNDED};
+    OverflowPolicy            m_overflowPolicy{OverflowPolicy::DROP_OLDEST};
+    std::atomic_uint64_t      m_numDroppedItems{0};
+    std::atomic_uint64_t      m_numCoalescedItems{0};
+    ItemCallback_t            m_callback;
+    ErrorCallback_t           m_errorCallback;
+    SignalSetChangeHandler_t  m_signalSetChangeHandler;
+    std::chrono::milliseconds m_maxDeliveryDelay{0};
+    // Serializes the observers with the insertion of items and errors
+    std::mutex                m_observerMutex;
+    ItemCallback_t            m_itemObserver;
+    ErrorCallback_t           m_errorObserver;
+    mutable std::mutex        m_bufferMutex;
+    bool                      m_cancelled{false};
+    bool                      m_failed{false};
+    Status                    m_status{};
+    std::condition_variable   m_cv;
+    std::condition_variable   m_spaceAvailableCv;
 };
 
 template <typename T> using AsyncSubscriptionPtr_t = std::shared_ptr<AsyncSubscription<T>>;
@@ -0,0 +1,409 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_COROUTINES_H
+#define VEHICLE_APP_SDK_COROUTINES_H
+
+#if !defined(__cpp_impl_coroutine)
+#error "sdk/Coroutines.h requires a compiler with C++20 coroutine support (e.g. -std=c++20)"
+#endif
+
+#include "sdk/AsyncResult.h"
+#include "sdk/Logger.h"
+#include "sdk/ThreadPool.h"
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace velocitas {
+
+namespace detail {
+
+/**
+ * @brief Resumes the given coroutine on one of the worker threads of the executor.
+ */
+inline void resumeOn(ThreadPool& executor, std::coroutine_handle<> handle) {
+    executor.enqueue(Job::create([handle]() { handle.resume(); }));
+}
+
+/**
+ * @brief Returns the executor the coroutine of the given handle is bound to. Coroutines not
+ *        knowing about executors are resumed on the default executor.
+ */
+template <typename TPromise>
+std::shared_ptr<ThreadPool> getExecutorOf(std::coroutine_handle<TPromise> handle) {
+    if constexpr (requires { handle.promise().getExecutor(); }) {
+        return handle.promise().getExecutor();
+    } else {
+        return ThreadPool::getInstance();
+    }
+}
+
+template <typename T> class TaskPromise;
+
+} // namespace detail
+
+/**
+ * @brief Lazily started coroutine returning a value of type T.
+ *
+ * A task starts executing once it is co_awaited by another coroutine or handed over to spawn().
+ * It inherits the executor of the coroutine awaiting it; all resumptions after awaiting an
+ * AsyncResult or an AsyncSubscriptionStream happen on a worker thread of that executor.
+ *
+ * @tparam T  Type of the value returned via co_return.
+ */
+template <typename T = void> class [[nodiscard]] Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+    explicit Task(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle) {}
+
+    Task(Task&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() { destroy(); }
+
+    /**
+     * @brief Bind the task to the given executor. Only has an effect before the task is started.
+     */
+    void setExecutor(std::shared_ptr<ThreadPool> executor) {
+        m_handle.promise().setExecutor(std::move(executor));
+    }
+
+    /**
+     * @brief Awaiter starting the task and resuming the awaiting coroutine once it completes.
+     */
+    class Awaiter {
+    public:
+        explicit Awaiter(std::coroutine_handle<promise_type> handle)
+            : m_handle(handle) {}
+
+        [[nodiscard]] bool await_ready() const noexcept { return !m_handle || m_handle.done(); }
+
+        template <typename TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> awaiting) noexcept {
+            m_handle.promise().setContinuation(awaiting);
+            m_handle.promise().setExecutor(detail::getExecutorOf(awaiting));
+            return m_handle;
+        }
+
+        T await_resume() { return m_handle.promise().getResult(); }
+
+    private:
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+    Awaiter operator co_await() && noexcept { return Awaiter{m_handle}; }
+
+private:
+    void destroy() {
+        if (m_handle) {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+namespace detail {
+
+class TaskPromiseBase {
+public:
+    struct FinalAwaiter {
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        template <typename TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) noexcept {
+            auto continuation = handle.promise().m_continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter        final_suspend() const noexcept { return {}; }
+    void                unhandled_exception() noexcept { m_exception = std::current_exception(); }
+
+    void setContinuation(std::coroutine_handle<> continuation) { m_continuation = continuation; }
+
+    [[nodiscard]] const std::shared_ptr<ThreadPool>& getExecutor() const { return m_executor; }
+    void setExecutor(std::shared_ptr<ThreadPool> executor) { m_executor = std::move(executor); }
+
+protected:
+    void rethrowIfFailed() const {
+        if (m_exception) {
+            std::rethrow_exception(m_exception);
+        }
+    }
+
+private:
+    std::coroutine_handle<>     m_continuation;
+    std::exception_ptr          m_exception;
+    std::shared_ptr<ThreadPool> m_executor{ThreadPool::getInstance()};
+};
+
+template <typename T> class TaskPromise : public TaskPromiseBase {
+public:
+    Task<T> get_return_object() {
+        return Task<T>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+    }
+
+    template <typename TValue> void return_value(TValue&& value) {
+        m_value.emplace(std::forward<TValue>(value));
+    }
+
+    T getResult() {
+        rethrowIfFailed();
+        return std::move(*m_value);
+    }
+
+private:
+    std::optional<T> m_value;
+};
+
+template <> class TaskPromise<void> : public TaskPromiseBase {
+public:
+    Task<void> get_return_object() {
+        return Task<void>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+    }
+
+    void return_void() const noexcept {}
+
+    void getResult() const { rethrowIfFailed(); }
+};
+
+/**
+ * @brief Eagerly started, self destroying coroutine used to run a spawned task.
+ */
+struct DetachedTask {
+    struct promise_type {
+        promise_type(const Task<void>& /*task*/, std::shared_ptr<ThreadPool> executor)
+            : m_executor(std::move(executor)) {}
+
+        DetachedTask       get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void               return_void() const noexcept {}
+        [[noreturn]] void  unhandled_exception() const noexcept { std::terminate(); }
+
+        [[nodiscard]] const std::shared_ptr<ThreadPool>& getExecutor() const { return m_executor; }
+
+        std::shared_ptr<ThreadPool> m_executor;
+    };
+};
+
+inline DetachedTask runDetached(Task<void> task, std::shared_ptr<ThreadPool> /*executor*/) {
+    try {
+        co_await std::move(task);
+    } catch (const std::exception& e) {
+        logger().error("[Coroutines] Uncaught exception in spawned task: {}", e.what());
+    } catch (...) {
+        logger().error("[Coroutines] Uncaught unknown exception in spawned task");
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Start the given task on a worker thread of the executor without waiting for its
+ *        completion. Exceptions escaping the task are logged.
+ *
+ * @param task      The task to run.
+ * @param executor  The executor to run the task on.
+ */
+inline void spawn(Task<void>                  task,
+                  std::shared_ptr<ThreadPool> executor = ThreadPool::getInstance()) {
+    auto taskPtr = std::make_shared<Task<void>>(std::move(task));
+    executor->enqueue(Job::create([taskPtr, executor]() {
+        detail::runDetached(std::move(*taskPtr), executor);
+    }));
+}
+
+/**
+ * @brief Awaiter suspending the awaiting coroutine until the AsyncResult is completed.
+ *
+ * @tparam T  Result type of the AsyncResult.
+ */
+template <typename T> class AsyncResultAwaiter {
+public:
+    explicit AsyncResultAwaiter(AsyncResultPtr_t<T> result)
+        : m_result(std::move(result)) {}
+
+    [[nodiscard]] bool await_ready() const { return m_result->isCompleted(); }
+
+    template <typename TPromise> void await_suspend(std::coroutine_handle<TPromise> handle) {
+        m_handle   = handle;
+        m_executor = detail::getExecutorOf(handle);
+        // The coroutine (and with it this awaiter) may already be resumed before onResult
+        // returns, hence don't touch any member after registering the first callback. Only
+        // capturing "this" keeps the callbacks within the small buffer of std::function.
+        auto result = m_result;
+        result->onError([this](const Status& status) {
+            m_status = status;
+            detail::resumeOn(*m_executor, m_handle);
+        });
+        result->onResult([this](const T& value) {
+            m_value.emplace(value);
+            detail::resumeOn(*m_executor, m_handle);
+        });
+    }
+
+    T await_resume() {
+        if (m_value) {
+            return std::move(*m_value);
+        }
+        if (m_status) {
+            throw AsyncException(m_status->errorMessage());
+        }
+        // completed before suspending
+        return m_result->await();
+    }
+
+private:
+    AsyncResultPtr_t<T>         m_result;
+    std::optional<T>            m_value;
+    std::optional<Status>       m_status;
+    std::coroutine_handle<>     m_handle;
+    std::shared_ptr<ThreadPool> m_executor;
+};
+
+/**
+ * @brief Makes an AsyncResult awaitable: `auto reply = co_await vdbc->getDatapoints(paths);`
+ *
+ * @throw AsyncException when resumed, if the async operation failed.
+ */
+template <typename T> AsyncResultAwaiter<T> operator co_await(AsyncResultPtr_t<T> result) {
+    return AsyncResultAwaiter<T>(std::move(result));
+}
+
+/**
+ * @brief Pull based, awaitable view of an AsyncSubscription:
+ *
+ *     AsyncSubscriptionStream stream{subscribeDataPoints(query)};
+ *     while (true) {
+ *         auto reply = co_await stream.next();
+ *         ...
+ *     }
+ *
+ * The stream registers the item and error callbacks of the subscription. Items are buffered until
+ * they are requested via next(). Only one coroutine may wait on a stream at a time.
+ *
+ * @tparam T  Item type of the subscription.
+ */
+template <typename T> class AsyncSubscriptionStream {
+public:
+    explicit AsyncSubscriptionStream(AsyncSubscriptionPtr_t<T> subscription)
+        : m_subscription(std::move(subscription))
+        , m_state(std::make_shared<State>()) {
+        m_subscription->onItem([state = m_state](const T& item) {
+            std::unique_lock lock{state->m_mutex};
+            state->m_items.push_back(item);
+            state->resumeWaiter(lock);
+        });
+        m_subscription->onError([state = m_state](const Status& status) {
+            std::unique_lock lock{state->m_mutex};
+            state->m_status = status;
+            state->resumeWaiter(lock);
+        });
+    }
+
+    /**
+     * @brief Returns an awaitable yielding the next item of the subscription.
+     *
+     * @throw AsyncException when resumed, if the subscription failed.
+     */
+    auto next() { return NextItemAwaiter{m_state}; }
+
+private:
+    struct State {
+        [[nodiscard]] bool isReady() const { return !m_items.empty() || m_status.has_value(); }
+
+        void resumeWaiter(std::unique_lock<std::mutex>& lock) {
+            if (m_waiter) {
+                auto waiter   = std::exchange(m_waiter, nullptr);
+                auto executor = std::move(m_waiterExecutor);
+                lock.unlock();
+                detail::resumeOn(*executor, waiter);
+            }
+        }
+
+        std::mutex                  m_mutex;
+        std::deque<T>               m_items;
+        std::optional<Status>       m_status;
+        std::coroutine_handle<>     m_waiter;
+        std::shared_ptr<ThreadPool> m_waiterExecutor;
+    };
+
+    class NextItemAwaiter {
+    public:
+        explicit NextItemAwaiter(std::shared_ptr<State> state)
+            : m_state(std::move(state)) {}
+
+        [[nodiscard]] bool await_ready() const {
+            std::lock_guard lock{m_state->m_mutex};
+            return m_state->isReady();
+        }
+
+        template <typename TPromise> bool await_suspend(std::coroutine_handle<TPromise> handle) {
+            std::lock_guard lock{m_state->m_mutex};
+            if (m_state->isReady()) {
+                return false;
+            }
+            m_state->m_waiter         = handle;
+            m_state->m_waiterExecutor = detail::getExecutorOf(handle);
+            return true;
+        }
+
+        T await_resume() {
+            std::lock_guard lock{m_state->m_mutex};
+            if (!m_state->m_items.empty()) {
+                T item = std::move(m_state->m_items.front());
+                m_state->m_items.pop_front();
+                return item;
+            }
+            throw AsyncException(m_state->m_status->errorMessage());
+        }
+
+    private:
+        std::shared_ptr<State> m_state;
+    };
+
+    AsyncSubscriptionPtr_t<T> m_subscription;
+    std::shared_ptr<State>    m_state;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_COROUTINES_H
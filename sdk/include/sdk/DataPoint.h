@@ -20,6 +20,7 @@
 #include "sdk/AsyncResult.h"
 #include "sdk/DataPointValue.h"
 #include "sdk/Node.h"
+#include "sdk/vdb/ReadPolicy.h"
 
 #include <cassert>
 #include <cstdint>
@@ -96,6 +97,15 @@ public:
     [[nodiscard]] AsyncResultPtr_t<TypedDataPointValue<T>> get() const;
     [[nodiscard]] AsyncResultPtr_t<Status>                 set(T value) const;
 
+    /**
+     * @brief Get the value of the data point, accepting a locally cached value if the passed
+     *        policy allows to. Requires the read cache to be enabled (SDV_VDB_READ_CACHE_MAX_AGE),
+     *        otherwise the value is always read from the data broker.
+     *
+     * @param policy  The freshness required for the value.
+     */
+    [[nodiscard]] AsyncResultPtr_t<TypedDataPointValue<T>> get(const ReadPolicy& policy) const;
+
     [[nodiscard]] std::string toString() const override;
 };
 
@@ -17,32 +17,206 @@
 #ifndef VEHICLE_APP_SDK_DATAPOINTREPLY_H
 #define VEHICLE_APP_SDK_DATAPOINTREPLY_H
 
+#include "sdk/AsyncResult.h"
 #include "sdk/DataPointValue.h"
 #include "sdk/Exceptions.h"
+#include "sdk/PathRegistry.h"
 
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 namespace velocitas {
 
-using DataPointMap_t = std::map<std::string, std::shared_ptr<DataPointValue>>;
+using DataPointMap_t    = std::map<std::string, std::shared_ptr<DataPointValue>>;
+using DataPointValues_t = std::vector<std::optional<DataPointValue>>;
 
 class DataPoint;
 
+/**
+ * @brief Immutable, sorted set of data point paths which defines the slots of a DataPointReply.
+ *        All replies sharing a layout (e.g. all replies of one subscription) address their data
+ *        points via the same handles, hence a handle needs to be resolved just once.
+ *
+ */
+class DataPointLayout final {
+public:
+    using Handle_t = uint32_t;
+
+    static constexpr Handle_t INVALID_HANDLE = std::numeric_limits<Handle_t>::max();
+
+    /**
+     * @brief Construct a new layout.
+     *
+     * @param paths  The paths of the data points, may be unsorted and contain duplicates.
+     */
+    explicit DataPointLayout(std::vector<std::string> paths)
+        : m_paths(std::move(paths)) {
+        std::sort(m_paths.begin(), m_paths.end());
+        m_paths.erase(std::unique(m_paths.begin(), m_paths.end()), m_paths.end());
+        if (m_paths.size() >= INVALID_HANDLE) {
+            throw InvalidValueException("Too many data points for a reply!");
+        }
+
+        auto& registry = PathRegistry::getInstance();
+        m_internedPaths.reserve(m_paths.size());
+        m_handlesById.reserve(m_paths.size());
+        for (Handle_t handle = 0; handle < m_paths.size(); ++handle) {
+            m_internedPaths.push_back(registry.internPath(m_paths[handle]));
+            m_handlesById.emplace_back(m_internedPaths.back().getId(), handle);
+        }
+        std::sort(m_handlesById.begin(), m_handlesById.end());
+    }
+
+    /**
+     * @brief Get the handle of the slot of the passed path.
+     *
+     * @param path      The path of the data point.
+     * @return Handle_t The handle of the data point or INVALID_HANDLE if the path is not part of
+     *                  the layout.
+     */
+    [[nodiscard]] Handle_t findHandle(std::string_view path) const {
+        auto iter = std::lower_bound(m_paths.begin(), m_paths.end(), path);
+        if (iter == m_paths.end() || *iter != path) {
+            return INVALID_HANDLE;
+        }
+        return static_cast<Handle_t>(iter - m_paths.begin());
+    }
+
+    /**
+     * @brief Get the handle of the slot of the passed path id, avoiding any string comparison.
+     *
+     * @param pathId    The id of the data point's path within the PathRegistry.
+     * @return Handle_t The handle of the data point or INVALID_HANDLE if the path is not part of
+     *                  the layout.
+     */
+    [[nodiscard]] Handle_t findHandleById(PathId_t pathId) const {
+        auto iter = std::lower_bound(m_handlesById.begin(), m_handlesById.end(),
+                                     std::make_pair(pathId, Handle_t{0}));
+        if (iter == m_handlesById.end() || iter->first != pathId) {
+            return INVALID_HANDLE;
+        }
+        return iter->second;
+    }
+
+    [[nodiscard]] const std::string& getPath(Handle_t handle) const { return m_paths.at(handle); }
+
+    /**
+     * @brief Get the interned path of the passed handle, e.g. to create data point values without
+     *        copying their path.
+     */
+    [[nodiscard]] InternedPath getInternedPath(Handle_t handle) const {
+        return m_internedPaths.at(handle);
+    }
+
+    [[nodiscard]] const std::vector<std::string>& getPaths() const { return m_paths; }
+    [[nodiscard]] size_t                          size() const { return m_paths.size(); }
+
+private:
+    std::vector<std::string>                   m_paths;
+    std::vector<InternedPath>                  m_internedPaths;
+    std::vector<std::pair<PathId_t, Handle_t>> m_handlesById;
+};
+
 /**
  * @brief Result of an operation which returns multiple data points.
  *        Provides typed access to obtained data points.
  *
+ *        The data point values are stored by value in a contiguous array of slots defined by a
+ *        DataPointLayout. Besides via their path, they can be addressed via a handle which is
+ *        valid for all replies sharing the same layout (see getHandle()).
+ *
  */
 class DataPointReply final {
 public:
+    using Handle_t = DataPointLayout::Handle_t;
+
+    static constexpr Handle_t INVALID_HANDLE = DataPointLayout::INVALID_HANDLE;
+
     DataPointReply() = default;
 
-    DataPointReply(DataPointMap_t&& dataPointsMap)
-        : m_dataPointsMap(std::move(dataPointsMap)) {}
+    DataPointReply(DataPointMap_t&& dataPointsMap) {
+        std::vector<std::string> paths;
+        paths.reserve(dataPointsMap.size());
+        auto values = std::make_shared<DataPointValues_t>();
+        values->reserve(dataPointsMap.size());
+        for (auto& [path, value] : dataPointsMap) {
+            paths.emplace_back(path);
+            if (value) {
+                values->emplace_back(*value);
+            } else {
+                values->emplace_back(std::nullopt);
+            }
+        }
+        // the map is already sorted, hence the order of the slots matches the order of the map
+        m_layout = std::make_shared<const DataPointLayout>(std::move(paths));
+        m_values = std::move(values);
+    }
+
+    /**
+     * @brief Create a reply containing the passed data point values. The layout is made up of the
+     *        paths of the values. If multiple values share the same path, the last one is taken.
+     *
+     * @param dataPointValues  The values of the reply.
+     */
+    explicit DataPointReply(std::vector<DataPointValue>&& dataPointValues) {
+        std::vector<std::string> paths;
+        paths.reserve(dataPointValues.size());
+        for (const auto& value : dataPointValues) {
+            paths.emplace_back(value.getPath());
+        }
+        m_layout    = std::make_shared<const DataPointLayout>(std::move(paths));
+        auto values = std::make_shared<DataPointValues_t>(m_layout->size());
+        for (auto& value : dataPointValues) {
+            (*values)[m_layout->findHandle(value.getPath())] = std::move(value);
+        }
+        m_values = std::move(values);
+    }
+
+    /**
+     * @brief Create a reply referring to an immutable set of data point values. The values are
+     *        shared, not copied.
+     *
+     * @param layout  The layout of the reply.
+     * @param values  One slot per path of the layout, an empty slot denotes a data point not
+     *                contained in the reply.
+     */
+    DataPointReply(std::shared_ptr<const DataPointLayout>   layout,
+                   std::shared_ptr<const DataPointValues_t> values)
+        : m_layout(std::move(layout))
+        , m_values(std::move(values)) {
+        assert(m_layout && m_values && (m_layout->size() == m_values->size()));
+    }
+
+    /**
+     * @brief Get the handle of the passed data point path. The handle is valid for all replies
+     *        sharing the layout of this reply, e.g. all replies of one subscription.
+     *
+     * @param path      The path ("name") of the data point.
+     * @return Handle_t The handle of the data point or INVALID_HANDLE if the path is not part of
+     *                  the reply.
+     */
+    [[nodiscard]] Handle_t getHandle(const std::string& path) const {
+        return m_layout ? m_layout->findHandle(path) : INVALID_HANDLE;
+    }
+
+    /**
+     * @brief Get the layout of the reply.
+     */
+    [[nodiscard]] const std::shared_ptr<const DataPointLayout>& getLayout() const {
+        return m_layout;
+    }
 
     /**
      * @brief Get the desired data point from the reply as an untyped DataPointValue.
@@ -51,11 +225,37 @@ public:
      * @return std::shared_ptr<DataPointValue>  The genric data point value contained in the reply.
      */
     [[nodiscard]] std::shared_ptr<DataPointValue> getUntyped(const std::string& path) const {
-        auto mapEntry = m_dataPointsMap.find(path);
-        if (mapEntry == m_dataPointsMap.end()) {
+        const auto* value = findValue(getHandle(path));
+        if (value == nullptr) {
             throw InvalidValueException(path + " is not contained in reply!");
         }
-        return mapEntry->second;
+        return shareValue(*value);
+    }
+
+    /**
+     * @brief Get the desired data point from the reply as an untyped DataPointValue.
+     *
+     * @param handle The handle of the data point as returned by getHandle().
+     * @return std::shared_ptr<DataPointValue>  The genric data point value contained in the reply.
+     */
+    [[nodiscard]] std::shared_ptr<DataPointValue> getUntyped(Handle_t handle) const {
+        const auto* value = findValue(handle);
+        if (value == nullptr) {
+            throw InvalidValueException(
+                fmt::format("Handle {} is not contained in reply!", handle));
+        }
+        return shareValue(*value);
+    }
+
+    /**
+     * @brief Look up a data point of the reply without throwing if it is missing.
+     *
+     * @param handle The handle of the data point as returned by getHandle().
+     * @return const DataPointValue*  The data point value or nullptr if the reply does not contain
+     *                                a value for the handle. Only valid as long as the reply.
+     */
+    [[nodiscard]] const DataPointValue* findUntyped(Handle_t handle) const {
+        return findValue(handle);
     }
 
     /**
@@ -69,15 +269,28 @@ public:
     [[nodiscard]] std::shared_ptr<TypedDataPointValue<typename TDataPointType::value_type>>
     get(const TDataPointType& dataPoint) const {
         static_assert(std::is_base_of_v<DataPoint, TDataPointType>);
-
-        auto value = getUntyped(dataPoint.getPath());
-        if (value->isValid()) {
-            return std::dynamic_pointer_cast<
-                TypedDataPointValue<typename TDataPointType::value_type>>(value);
+        const auto* value =
+            m_layout ? findValue(m_layout->findHandleById(dataPoint.getPathId())) : nullptr;
+        if (value == nullptr) {
+            throw InvalidValueException(dataPoint.getPath() + " is not contained in reply!");
         }
+        return toTyped<typename TDataPointType::value_type>(*value);
+    }
 
-        return std::make_shared<TypedDataPointValue<typename TDataPointType::value_type>>(
-            value->getPath(), value->getFailure(), value->getTimestamp());
+    /**
+     * @brief Get the desired data point from the reply.
+     *
+     * @tparam TDataPointType   The type of the data point to return.
+     * @param dataPoint         The data point to query from the reply.
+     * @param handle            The handle of the data point as returned by getHandle().
+     * @return std::shared_ptr<TDataPointType>  The data point value contained in the reply.
+     */
+    template <class TDataPointType>
+    [[nodiscard]] std::shared_ptr<TypedDataPointValue<typename TDataPointType::value_type>>
+    get(const TDataPointType& dataPoint, Handle_t handle) const {
+        static_assert(std::is_base_of_v<DataPoint, TDataPointType>);
+        std::ignore = dataPoint;
+        return toTyped<typename TDataPointType::value_type>(*getUntyped(handle));
     }
 
     /**
@@ -86,10 +299,102 @@ public:
      * @return true   Reply is empty.
      * @return false  Reply is not empty.
      */
-    [[nodiscard]] bool empty() const { return m_dataPointsMap.empty(); }
+    [[nodiscard]] bool empty() const {
+        return !m_values || std::none_of(m_values->begin(), m_values->end(),
+                                         [](const auto& value) { return value.has_value(); });
+    }
+
+    /**
+     * @brief Merge the data points of a newer reply into this one. Data points contained in both
+     *        replies take the value of the newer reply.
+     *
+     * @param newerReply  The reply to merge into this one.
+     */
+    void merge(DataPointReply&& newerReply) {
+        if (!m_values) {
+            *this = std::move(newerReply);
+            return;
+        }
+        if (!newerReply.m_values) {
+            return;
+        }
+
+        if (m_layout == newerReply.m_layout) {
+            // Start off the newer values and only copy them if this reply contains values missing
+            // in the newer one. Replies of the same subscription mostly contain the same set of
+            // values, hence merging usually does not copy anything.
+            const auto&                        newerValues = *newerReply.m_values;
+            std::shared_ptr<DataPointValues_t> mergedValues;
+            for (size_t slot = 0; slot < newerValues.size(); ++slot) {
+                if (!newerValues[slot].has_value() && (*m_values)[slot].has_value()) {
+                    if (!mergedValues) {
+                        mergedValues = std::make_shared<DataPointValues_t>(newerValues);
+                    }
+                    (*mergedValues)[slot] = (*m_values)[slot];
+                }
+            }
+            if (mergedValues) {
+                m_values = std::move(mergedValues);
+            } else {
+                m_values = std::move(newerReply.m_values);
+            }
+            return;
+        }
+
+        DataPointMap_t mergedMap;
+        for (const auto* reply : {this, &newerReply}) {
+            for (Handle_t slot = 0; slot < reply->m_values->size(); ++slot) {
+                if (const auto& value = (*reply->m_values)[slot]) {
+                    mergedMap.insert_or_assign(reply->m_layout->getPath(slot),
+                                               std::make_shared<DataPointValue>(*value));
+                }
+            }
+        }
+        *this = DataPointReply(std::move(mergedMap));
+    }
 
 private:
-    DataPointMap_t m_dataPointsMap;
+    [[nodiscard]] const DataPointValue* findValue(Handle_t handle) const {
+        if (!m_values || handle >= m_values->size() || !(*m_values)[handle].has_value()) {
+            return nullptr;
+        }
+        return &*(*m_values)[handle];
+    }
+
+    /**
+     * @brief Hand out a value of the reply without copying it: The returned pointer shares the
+     *        ownership of all values of the reply.
+     */
+    [[nodiscard]] std::shared_ptr<DataPointValue> shareValue(const DataPointValue& value) const {
+        return std::shared_ptr<DataPointValue>(m_values, const_cast<DataPointValue*>(&value));
+    }
+
+    template <typename T>
+    [[nodiscard]] static std::shared_ptr<TypedDataPointValue<T>>
+    toTyped(const DataPointValue& value) {
+        if (value.isValid()) {
+            if (value.getType() != getValueType<T>()) {
+                return nullptr;
+            }
+            return std::make_shared<TypedDataPointValue<T>>(value);
+        }
+        return std::make_shared<TypedDataPointValue<T>>(value.getPath(), value.getFailure(),
+                                                        value.getTimestamp());
+    }
+
+    // Replies are copied around a lot (e.g. when passed to subscription callbacks), hence layout
+    // and values are shared between copies. A nullptr denotes an empty reply.
+    std::shared_ptr<const DataPointLayout>   m_layout;
+    std::shared_ptr<const DataPointValues_t> m_values;
+};
+
+/**
+ * @brief Coalescing subscription replies keeps the latest value of each data point.
+ */
+template <> struct SubscriptionItemTraits<DataPointReply> {
+    static void coalesce(DataPointReply& bufferedItem, DataPointReply&& newerItem) {
+        bufferedItem.merge(std::move(newerItem));
+    }
 };
 
 } // namespace velocitas
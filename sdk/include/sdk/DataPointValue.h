@@ -18,12 +18,14 @@
 #define VEHICLE_APP_SDK_DATAPOINTVALUE_H
 
 #include "sdk/Exceptions.h"
+#include "sdk/PathRegistry.h"
 
 #include <cassert>
 #include <cstdint>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <variant>
 #include <vector>
 
 namespace velocitas {
@@ -41,6 +43,16 @@ inline bool operator==(const Timestamp& lhs, const Timestamp& rhs) {
     return lhs.seconds == rhs.seconds && lhs.nanos == rhs.nanos;
 }
 
+/**
+ * @brief Value of a data point incl. its metadata (path, timestamp, failure state).
+ *
+ *        The value itself is stored in a closed variant (see Value_t) within this class, hence
+ *        data point values can be passed, stored and copied by value. Scalars and short strings
+ *        do not require any heap allocation. The path is interned in the PathRegistry, so copying
+ *        a value does not copy its path. TypedDataPointValue<T> is a typed view on a value of
+ *        type T and does not add any members, i.e. it can be sliced to a DataPointValue without
+ *        losing information.
+ */
 class DataPointValue {
 public:
     enum class Type {
@@ -86,11 +98,27 @@ public:
         INTERNAL_ERROR,
     };
 
-    DataPointValue(Type type, std::string path, Timestamp timestamp,
+    /**
+     * @brief All value types a data point can carry. std::monostate denotes a data point without
+     *        any value.
+     */
+    using Value_t =
+        std::variant<std::monostate, bool, std::vector<bool>, int8_t, std::vector<int8_t>, int16_t,
+                     std::vector<int16_t>, int32_t, std::vector<int32_t>, int64_t,
+                     std::vector<int64_t>, uint8_t, std::vector<uint8_t>, uint16_t,
+                     std::vector<uint16_t>, uint32_t, std::vector<uint32_t>, uint64_t,
+                     std::vector<uint64_t>, float, std::vector<float>, double,
+                     std::vector<double>, std::string, std::vector<std::string>>;
+
+    DataPointValue(Type type, const std::string& path, Timestamp timestamp,
+                   Failure failure = Failure::NONE)
+        : DataPointValue(type, InternedPath(path), timestamp, failure) {}
+
+    DataPointValue(Type type, InternedPath path, Timestamp timestamp,
                    Failure failure = Failure::NONE)
-        : m_path(std::move(path))
+        : m_path(path)
         , m_type{type}
-        , m_timestamp(std::move(timestamp))
+        , m_timestamp(timestamp)
         , m_failure{failure} {}
 
     virtual ~DataPointValue()                        = default;
@@ -99,34 +127,67 @@ public:
     DataPointValue& operator=(const DataPointValue&) = default;
     DataPointValue& operator=(DataPointValue&&)      = default;
 
-    [[nodiscard]] const std::string& getPath() const { return m_path; }
+    [[nodiscard]] const std::string& getPath() const { return m_path.str(); }
+    [[nodiscard]] InternedPath       getInternedPath() const { return m_path; }
     [[nodiscard]] Type               getType() const { return m_type; }
     [[nodiscard]] const Timestamp&   getTimestamp() const { return m_timestamp; }
     [[nodiscard]] bool               isValid() const { return m_failure == Failure::NONE; }
     [[nodiscard]] Failure            getFailure() const { return m_failure; }
     [[nodiscard]] bool               wasUpdated() const { return m_wasUpdated; }
+    [[nodiscard]] const Value_t&     getValueVariant() const { return m_value; }
+
+    /**
+     * @brief Get the value of the data point.
+     *
+     * @tparam T  The type of the value.
+     * @throw InvalidValueException if the data point has no valid value.
+     * @throw InvalidTypeException if the data point carries a value of another type.
+     */
+    template <typename T> [[nodiscard]] const T& getValueAs() const;
 
     void clearUpdateStatus() { m_wasUpdated = false; }
 
     bool operator==(const DataPointValue& other) const {
-        return std::tie(m_path, m_type, m_timestamp, m_failure) ==
-               std::tie(other.m_path, other.m_type, other.m_timestamp, other.m_failure);
+        return std::tie(m_path, m_type, m_timestamp, m_failure, m_value) ==
+               std::tie(other.m_path, other.m_type, other.m_timestamp, other.m_failure,
+                        other.m_value);
     }
 
-    [[nodiscard]] virtual std::string getValueAsString() const {
-        throw InvalidValueException("Base class does not carry values!");
-    }
+    bool operator!=(const DataPointValue& other) const { return !(*this == other); }
+
+    [[nodiscard]] std::string getValueAsString() const;
+
+protected:
+    DataPointValue(Type type, InternedPath path, Value_t value, Timestamp timestamp,
+                   Failure failure)
+        : m_path(path)
+        , m_type{type}
+        , m_timestamp(timestamp)
+        , m_failure{failure}
+        , m_value(std::move(value)) {}
 
 private:
-    std::string m_path;
-    Type        m_type{Type::INVALID};
-    Timestamp   m_timestamp{};
-    Failure     m_failure{Failure::NONE};
-    bool        m_wasUpdated{true};
+    InternedPath m_path;
+    Type         m_type{Type::INVALID};
+    Timestamp    m_timestamp{};
+    Failure      m_failure{Failure::NONE};
+    bool         m_wasUpdated{true};
+    Value_t      m_value{};
 };
 
 std::string toString(DataPointValue::Failure);
 
+template <typename T> const T& DataPointValue::getValueAs() const {
+    if (!isValid()) {
+        throw InvalidValueException(getPath() + " has no valid value: " + toString(m_failure));
+    }
+    const auto* value = std::get_if<T>(&m_value);
+    if (value == nullptr) {
+        throw InvalidTypeException(getPath() + " does not carry a value of the requested type");
+    }
+    return *value;
+}
+
 template <typename T> DataPointValue::Type getValueType() {
     static_assert(std::is_same<T, std::false_type>::value, "Value type not supported!");
     return DataPointValue::Type::INVALID;
@@ -203,83 +264,46 @@ template <> inline DataPointValue::Type getValueType<std::vector<std::string>>()
     return DataPointValue::Type::STRING_ARRAY;
 }
 
+/**
+ * @brief Typed view on a data point value of type T.
+ *
+ * @tparam T  The type of the value.
+ */
 template <typename T> class TypedDataPointValue : public DataPointValue {
 public:
     TypedDataPointValue()
-        : DataPointValue(getValueType<T>(), "", Timestamp{}, Failure::INTERNAL_ERROR){};
+        : DataPointValue(getValueType<T>(), InternedPath(), Value_t{std::in_place_type<T>},
+                         Timestamp{}, Failure::INTERNAL_ERROR){};
 
     TypedDataPointValue(const std::string& path, T value, Timestamp timestamp = Timestamp{})
-        : DataPointValue(getValueType<T>(), path, std::forward<decltype(timestamp)>(timestamp))
-        , m_value(std::move(value)) {}
+        : TypedDataPointValue(InternedPath(path), std::move(value), timestamp) {}
+
+    TypedDataPointValue(InternedPath path, T value, Timestamp timestamp = Timestamp{})
+        : DataPointValue(getValueType<T>(), path, Value_t{std::in_place_type<T>, std::move(value)},
+                         timestamp, Failure::NONE) {}
 
     TypedDataPointValue(const std::string& path, DataPointValue::Failure failure,
                         Timestamp timestamp = Timestamp{})
-        : DataPointValue(getValueType<T>(), path, std::forward<decltype(timestamp)>(timestamp),
-                         failure)
-        , m_value{} {
+        : DataPointValue(getValueType<T>(), InternedPath(path), Value_t{std::in_place_type<T>},
+                         timestamp, failure) {
         assert(failure != Failure::NONE);
     }
 
-    [[nodiscard]] const T& value() const {
-        if (!isValid()) {
-            throw InvalidValueException(getPath() +
-                                        " has no valid value: " + toString(getFailure()));
+    /**
+     * @brief Create a typed view on an untyped data point value.
+     *
+     * @throw InvalidTypeException if the value is not of type T.
+     */
+    explicit TypedDataPointValue(DataPointValue value)
+        : DataPointValue(std::move(value)) {
+        if (getType() != getValueType<T>()) {
+            throw InvalidTypeException(getPath() + " is not of the requested type");
         }
-        return m_value;
-    }
-
-    bool operator==(const TypedDataPointValue& other) const {
-        return DataPointValue::operator==(other) && m_value == other.m_value;
     }
 
-    [[nodiscard]] std::string getValueAsString() const override;
-
-private:
-    T m_value;
+    [[nodiscard]] const T& value() const { return getValueAs<T>(); }
 };
 
-template <typename T> std::string TypedDataPointValue<T>::getValueAsString() const {
-    // Return empty string in case of unspecific data types
-    return "<unknown datatype>";
-}
-
-template <> inline std::string TypedDataPointValue<bool>::getValueAsString() const {
-    return m_value ? "true" : "false";
-}
-template <> inline std::string TypedDataPointValue<int8_t>::getValueAsString() const {
-    return std::to_string(m_value);
-}
-template <> inline std::string TypedDataPointValue<int16_t>::getValueAsString() const {
-    return std::to_string(m_value);
-}
-template <> inline std::string TypedDataPointValue<int32_t>::getValueAsString() const {
-    return std::to_string(m_value);
-}
-template <> inline std::string TypedDataPointValue<int64_t>::getValueAsString() const {
-    return std::to_string(m_value);
-}
-template <> inline std::string TypedDataPointValue<uint8_t>::getValueAsString() const {
-    return std::to_string(m_value);
-}
-template <> inline std::string TypedDataPointValue<uint16_t>::getValueAsString() const {
-    return std::to_string(m_value);
-}
-template <> inline std::string TypedDataPointValue<uint32_t>::getValueAsString() const {
-    return std::to_string(m_value);
-}
-template <> inline std::string TypedDataPointValue<uint64_t>::getValueAsString() const {
-    return std::to_string(m_value);
-}
-template <> inline std::string TypedDataPointValue<float>::getValueAsString() const {
-    return std::to_string(m_value);
-}
-template <> inline std::string TypedDataPointValue<double>::getValueAsString() const {
-    return std::to_string(m_value);
-}
-template <> inline std::string TypedDataPointValue<std::string>::getValueAsString() const {
-    return m_value;
-}
-
 } // namespace velocitas
 
 #endif // VEHICLE_APP_SDK_DATAPOINTVALUE_H
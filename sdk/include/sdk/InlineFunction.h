@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_INLINEFUNCTION_H
+#define VEHICLE_APP_SDK_INLINEFUNCTION_H
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace velocitas {
+
+/**
+ * @brief Move-only function wrapper which stores callables of up to BufferSize bytes within the
+ *        wrapper itself. Bigger callables are moved to the heap.
+ *
+ * In contrast to std::function (which only stores trivially copyable callables of up to two
+ * pointers inline) this allows storing e.g. a lambda capturing a shared_ptr and a std::function
+ * without any allocation.
+ *
+ * @tparam TSignature  Function signature, e.g. void(int)
+ * @tparam BufferSize  Size of the inline storage in bytes.
+ */
+template <typename TSignature, std::size_t BufferSize = 48> class InlineFunction;
+
+template <typename TReturn, typename... TArgs, std::size_t BufferSize>
+class InlineFunction<TReturn(TArgs...), BufferSize> {
+public:
+    InlineFunction() noexcept = default;
+    InlineFunction(std::nullptr_t) noexcept {} // NOLINT
+
+    template <typename TFunction,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<TFunction>, InlineFunction>>>
+    InlineFunction(TFunction&& function) { // NOLINT
+        using Function_t = std::decay_t<TFunction>;
+        if (isEmpty(function)) {
+            return;
+        }
+        if constexpr (isStoredInline<Function_t>()) {
+            new (&m_storage) Function_t(std::forward<TFunction>(function));
+            m_operations = &INLINE_OPERATIONS<Function_t>;
+        } else {
+            *reinterpret_cast<Function_t**>(&m_storage) =
+                new Function_t(std::forward<TFunction>(function));
+            m_operations = &HEAP_OPERATIONS<Function_t>;
+        }
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept { moveFrom(other); }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction&)            = delete;
+    InlineFunction& operator=(const InlineFunction&) = delete;
+
+    ~InlineFunction() { reset(); }
+
+    /**
+     * @brief Invoke the stored callable.
+     *
+     * @throw std::bad_function_call if no callable is stored.
+     */
+    TReturn operator()(TArgs... args) const {
+        if (m_operations == nullptr) {
+            throw std::bad_function_call();
+        }
+        return m_operations->m_invoke(const_cast<Storage_t*>(&m_storage),
+                                      std::forward<TArgs>(args)...);
+    }
+
+    explicit operator bool() const noexcept { return m_operations != nullptr; }
+
+    void reset() noexcept {
+        if (m_operations != nullptr) {
+            m_operations->m_destroy(&m_storage);
+            m_operations = nullptr;
+        }
+    }
+
+private:
+    using Storage_t = std::aligned_storage_t<BufferSize, alignof(std::max_align_t)>;
+
+    struct Operations {
+        TReturn (*m_invoke)(Storage_t*, TArgs&&...);
+        void (*m_move)(Storage_t* destination, Storage_t* source) noexcept;
+        void (*m_destroy)(Storage_t*) noexcept;
+    };
+
+    template <typename TFunction> static constexpr bool isStoredInline() {
+        return (sizeof(TFunction) <= BufferSize) &&
+               (alignof(TFunction) <= alignof(std::max_align_t)) &&
+               std::is_nothrow_move_constructible_v<TFunction>;
+    }
+
+    template <typename TFunction> static bool isEmpty(const TFunction& function) {
+        if constexpr (std::is_pointer_v<TFunction> || std::is_member_pointer_v<TFunction>) {
+            return function == nullptr;
+        } else {
+            return false;
+        }
+    }
+
+    template <typename TSig> static bool isEmpty(const std::function<TSig>& function) {
+        return !function;
+    }
+
+    template <typename TFunction> static TFunction* inlinePtr(Storage_t* storage) {
+        return std::launder(reinterpret_cast<TFunction*>(storage));
+    }
+
+    template <typename TFunction> static TFunction*& heapPtr(Storage_t* storage) {
+        return *reinterpret_cast<TFunction**>(storage);
+    }
+
+    template <typename TFunction>
+    static constexpr Operations INLINE_OPERATIONS{
+        [](Storage_t* storage, TArgs&&... args) -> TReturn {
+            return std::invoke(*inlinePtr<TFunction>(storage), std::forward<TArgs>(args)...);
+        },
+        [](Storage_t* destination, Storage_t* source) noexcept {
+            new (destination) TFunction(std::move(*inlinePtr<TFunction>(source)));
+            inlinePtr<TFunction>(source)->~TFunction();
+        },
+        [](Storage_t* storage) noexcept { inlinePtr<TFunction>(storage)->~TFunction(); }};
+
+    template <typename TFunction>
+    static constexpr Operations HEAP_OPERATIONS{
+        [](Storage_t* storage, TArgs&&... args) -> TReturn {
+            return std::invoke(*heapPtr<TFunction>(storage), std::forward<TArgs>(args)...);
+        },
+        [](Storage_t* destination, Storage_t* source) noexcept {
+            heapPtr<TFunction>(destination) = heapPtr<TFunction>(source);
+        },
+        [](Storage_t* storage) noexcept { delete heapPtr<TFunction>(storage); }};
+
+    void moveFrom(InlineFunction& other) noexcept {
+        if (other.m_operations != nullptr) {
+            other.m_operations->m_move(&m_storage, &other.m_storage);
+            m_operations       = other.m_operations;
+            other.m_operations = nullptr;
+        }
+    }
+
+    Storage_t         m_storage;
+    const Operations* m_operations{nullptr};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_INLINEFUNCTION_H
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_LOCKFREERINGBUFFER_H
+#define VEHICLE_APP_SDK_LOCKFREERINGBUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Bounded FIFO queue which can be pushed to and popped from by any number of threads
+ *        without taking a lock. Pushing to a full queue fails instead of blocking.
+ *
+ *        Each slot carries a sequence number telling whether it is ready to be written or read
+ *        in the current lap, so producers and consumers only contend on their own position
+ *        counter.
+ *
+ * @tparam T  Type of the items, needs to be default constructible and move assignable.
+ */
+template <typename T> class LockFreeRingBuffer {
+public:
+    /**
+     * @brief Construct a new ring buffer.
+     *
+     * @param capacity  Min. number of items the buffer can hold, rounded up to a power of two.
+     */
+    explicit LockFreeRingBuffer(size_t capacity)
+        : m_slots(roundUpToPowerOfTwo(capacity))
+        , m_mask(m_slots.size() - 1) {
+        for (size_t pos = 0; pos < m_slots.size(); ++pos) {
+            m_slots[pos].m_sequence.store(pos, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] size_t capacity() const { return m_slots.size(); }
+
+    /**
+     * @brief Append an item to the queue.
+     *
+     * @param item    The item to append, only moved from if the push succeeds.
+     * @return true   The item was appended.
+     * @return false  The queue is full.
+     */
+    bool tryPush(T&& item) {
+        auto  pos  = m_enqueuePos.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true) {
+            slot                = &m_slots[pos & m_mask];
+            const auto sequence = slot->m_sequence.load(std::memory_order_acquire);
+            const auto diff     = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->m_item = std::move(item);
+        slot->m_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest item from the queue.
+     *
+     * @param item    Receives the removed item.
+     * @return true   An item was removed.
+     * @return false  The queue is empty.
+     */
+    bool tryPop(T& item) {
+        auto  pos  = m_dequeuePos.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true) {
+            slot                = &m_slots[pos & m_mask];
+            const auto sequence = slot->m_sequence.load(std::memory_order_acquire);
+            const auto diff     = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        item = std::move(slot->m_item);
+        // mark the slot as writable in the next lap
+        slot->m_sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct Slot {
+        std::atomic<size_t> m_sequence{0};
+        T                   m_item{};
+    };
+
+    static size_t roundUpToPowerOfTwo(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1U;
+        }
+        return result;
+    }
+
+    std::vector<Slot>                           m_slots;
+    size_t                                      m_mask;
+    alignas(CACHE_LINE_SIZE) std::atomic_size_t m_enqueuePos{0};
+    alignas(CACHE_LINE_SIZE) std::atomic_size_t m_dequeuePos{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_LOCKFREERINGBUFFER_H
@@ -18,8 +18,11 @@
 #define VEHICLE_APP_SDK_LOGGER_H
 
 #include <fmt/core.h>
+
+#include <atomic>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace velocitas {
 
@@ -66,6 +69,18 @@ public:
     virtual void debug(const std::string& msg) = 0;
 };
 
+/**
+ * @brief Severity of a log message, ordered by increasing severity. OFF disables logging.
+ */
+enum class LogLevel { DEBUG = 0, INFO = 1, WARN = 2, ERROR = 3, OFF = 4 };
+
+#ifndef SDV_LOG_COMPILED_MIN_LEVEL
+/// Numeric LogLevel below which all log calls are compiled out, e.g. 1 to strip debug messages
+#define SDV_LOG_COMPILED_MIN_LEVEL 0
+#endif
+
+constexpr LogLevel COMPILED_MIN_LOG_LEVEL = static_cast<LogLevel>(SDV_LOG_COMPILED_MIN_LEVEL);
+
 /**
  * @brief Allows logging of messages with different log levels.
  *
@@ -79,6 +94,10 @@ public:
  *          If args are given then msg is assumed to be a valid format message
  *          following the formatting rules of https://fmt.dev/11.0/, and the args are assumed
  *          to be compatible with the given format message.
+ *
+ *          Messages below the log level (see setLevel(), initially taken from the environment
+ *          variable SDV_LOG_LEVEL) are dropped before formatting them. Messages below
+ *          SDV_LOG_COMPILED_MIN_LEVEL are not even compiled in.
  */
 class Logger {
 public:
@@ -91,13 +110,8 @@ public:
      * @param msg   The raw message or format message.
      * @param args  The format arguments.
      */
-    template <typename... T> void info(const std::string& msg, const T&... args) {
-        const std::size_t nbr = sizeof...(T);
-        if (nbr == 0) {
-            m_impl->info(msg);
-        } else {
-            m_impl->info(fmt::format(msg, args...));
-        }
+    template <typename... T> void info(std::string_view msg, const T&... args) {
+        log<LogLevel::INFO>(msg, args...);
     }
 
     /**
@@ -107,13 +121,8 @@ public:
      * @param msg   The raw message or format message.
      * @param args  The format arguments.
      */
-    template <typename... T> void warn(const std::string& msg, const T&... args) {
-        const std::size_t nbr = sizeof...(T);
-        if (nbr == 0) {
-            m_impl->warn(msg);
-        } else {
-            m_impl->warn(fmt::format(msg, args...));
-        }
+    template <typename... T> void warn(std::string_view msg, const T&... args) {
+        log<LogLevel::WARN>(msg, args...);
     }
 
     /**
@@ -123,13 +132,8 @@ public:
      * @param msg   The raw message or format message.
      * @param args  The format arguments.
      */
-    template <typename... T> void error(const std::string& msg, const T&... args) {
-        const std::size_t nbr = sizeof...(T);
-        if (nbr == 0) {
-            m_impl->error(msg);
-        } else {
-            m_impl->error(fmt::format(msg, args...));
-        }
+    template <typename... T> void error(std::string_view msg, const T&... args) {
+        log<LogLevel::ERROR>(msg, args...);
     }
 
     /**
@@ -139,15 +143,28 @@ public:
      * @param msg   The raw message or format message.
      * @param args  The format arguments.
      */
-    template <typename... T> void debug(const std::string& msg, const T&... args) {
-        const std::size_t nbr = sizeof...(T);
-        if (nbr == 0) {
-            m_impl->debug(msg);
-        } else {
-            m_impl->debug(fmt::format(msg, args...));
-        }
+    template <typename... T> void debug(std::string_view msg, const T&... args) {
+        log<LogLevel::DEBUG>(msg, args...);
+    }
+
+    /**
+     * @brief Check if messages of the passed level are logged, e.g. to skip preparing expensive
+     * arguments.
+     */
+    [[nodiscard]] bool isEnabled(LogLevel level) const {
+        return (level >= COMPILED_MIN_LOG_LEVEL) &&
+               (level >= m_level.load(std::memory_order_relaxed));
     }
 
+    /**
+     * @brief Set the minimum level of messages to log.
+     *
+     * @param level The minimum level, LogLevel::OFF to disable logging.
+     */
+    void setLevel(LogLevel level) { m_level.store(level, std::memory_order_relaxed); }
+
+    [[nodiscard]] LogLevel getLevel() const { return m_level.load(std::memory_order_relaxed); }
+
     /**
      * @brief Set the Logger Implementation object
      *
@@ -156,7 +173,23 @@ public:
     void setLoggerImplementation(std::unique_ptr<ILogger>&& impl) { m_impl = std::move(impl); }
 
 private:
+    template <LogLevel level, typename... T> void log(std::string_view msg, const T&... args) {
+        if constexpr (level >= COMPILED_MIN_LOG_LEVEL) {
+            if (!isEnabled(level)) {
+                return;
+            }
+            if constexpr (sizeof...(T) == 0) {
+                write(level, std::string(msg));
+            } else {
+                write(level, fmt::format(fmt::runtime(msg), args...));
+            }
+        }
+    }
+
+    void write(LogLevel level, const std::string& msg);
+
     std::unique_ptr<ILogger> m_impl;
+    std::atomic<LogLevel>    m_level;
 };
 
 /**
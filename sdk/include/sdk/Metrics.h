@@ -0,0 +1,264 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_METRICS_H
+#define VEHICLE_APP_SDK_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+using MetricLabels_t = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Monotonically increasing count of events.
+ */
+class Counter final {
+public:
+    void increment(uint64_t delta = 1) { m_value.fetch_add(delta, std::memory_order_relaxed); }
+
+    [[nodiscard]] uint64_t get() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic_uint64_t m_value{0};
+};
+
+/**
+ * @brief Current value of a quantity which can go up and down, e.g. a queue depth.
+ */
+class Gauge final {
+public:
+    void set(int64_t value) { m_value.store(value, std::memory_order_relaxed); }
+    void add(int64_t delta) { m_value.fetch_add(delta, std::memory_order_relaxed); }
+
+    [[nodiscard]] int64_t get() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic_int64_t m_value{0};
+};
+
+/**
+ * @brief Copy of the state of a histogram.
+ */
+struct HistogramSnapshot {
+    uint64_t m_count{0};
+    uint64_t m_sum{0};
+    /// Non-empty buckets as (exclusive upper bound, number of values) in ascending order
+    std::vector<std::pair<uint64_t, uint64_t>> m_buckets;
+
+    /**
+     * @brief Estimate the value below which the passed fraction of values falls.
+     *
+     * @param quantile  Fraction of values in the range [0, 1], e.g. 0.99 for the 99th percentile.
+     * @return uint64_t The largest value of the bucket containing the quantile, 0 if empty.
+     */
+    [[nodiscard]] uint64_t getQuantile(double quantile) const;
+};
+
+/**
+ * @brief Distribution of non-negative values (e.g. latencies in nanoseconds) in log-linear
+ *        buckets: Each power of two range is split into SUB_BUCKET_COUNT equally sized buckets,
+ *        hence the relative error of a value's bucket is at most 1 / SUB_BUCKET_COUNT. Recording
+ *        a value takes two relaxed atomic increments (bucket and sum) and no lock.
+ */
+class Histogram final {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS  = 3;
+    static constexpr uint32_t SUB_BUCKET_COUNT = 1U << SUB_BUCKET_BITS;
+    static constexpr size_t   NUM_BUCKETS      = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    /// Export divisor of histograms of durations, see MetricsRegistry::getHistogram()
+    static constexpr double NANOSECONDS_PER_SECOND = 1e9;
+
+    void record(uint64_t value) {
+        m_buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Record a duration in nanoseconds.
+     */
+    void recordDuration(std::chrono::steady_clock::duration duration) {
+        const auto nanoseconds =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        record(nanoseconds > 0 ? static_cast<uint64_t>(nanoseconds) : 0);
+    }
+
+    [[nodiscard]] HistogramSnapshot getSnapshot() const;
+
+    [[nodiscard]] static size_t   getBucketIndex(uint64_t value);
+    [[nodiscard]] static uint64_t getBucketLowerBound(size_t index);
+
+private:
+    std::array<std::atomic_uint64_t, NUM_BUCKETS> m_buckets{};
+    std::atomic_uint64_t                          m_sum{0};
+};
+
+/**
+ * @brief Copy of the state of a single metric.
+ */
+struct MetricSnapshot {
+    enum class Type { COUNTER, GAUGE, HISTOGRAM };
+
+    std::string       m_name;
+    std::string       m_help;
+    MetricLabels_t    m_labels;
+    Type              m_type{Type::COUNTER};
+    /// Value of a counter or gauge
+    int64_t           m_value{0};
+    /// State of a histogram
+    HistogramSnapshot m_histogram;
+    /// Divisor converting histogram values into the exported unit, e.g. 1e9 for ns to s
+    double            m_exportDivisor{1.0};
+};
+
+/**
+ * @brief Process wide registry of the metrics recorded by the SDK (and the app).
+ *
+ * Metrics are identified by their name and labels. Looking one up takes a lock, hence callers
+ * on hot paths should look it up once and keep the returned reference. The registry is never
+ * destroyed, so the references stay valid until the process terminates.
+ *
+ * If the environment variable SDV_METRICS_EXPORT_PATH is set, the registry is exported by a
+ * MetricsExporter created along with the registry.
+ */
+class MetricsRegistry final {
+public:
+    using GaugeCallback_t = std::function<int64_t()>;
+
+    static MetricsRegistry& getInstance();
+
+    MetricsRegistry()  = default;
+    ~MetricsRegistry() = default;
+
+    MetricsRegistry(const MetricsRegistry&)            = delete;
+    MetricsRegistry(MetricsRegistry&&)                 = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(MetricsRegistry&&)      = delete;
+
+    Counter& getCounter(const std::string& name, const std::string& help,
+                        const MetricLabels_t& labels = {});
+
+    Gauge& getGauge(const std::string& name, const std::string& help,
+                    const MetricLabels_t& labels = {});
+
+    /**
+     * @brief Get a histogram, creating it on first access.
+     *
+     * @param exportDivisor  Divisor converting recorded values into the exported unit, only
+     *                       taken on creation. Prometheus expects durations in seconds, hence
+     *                       histograms of durations recorded via Histogram::recordDuration() should
+     *                       pass Histogram::NANOSECONDS_PER_SECOND.
+     */
+    Histogram& getHistogram(const std::string& name, const std::string& help,
+                            const MetricLabels_t& labels = {}, double exportDivisor = 1.0);
+
+    /**
+     * @brief Register a gauge whose value is obtained by invoking the passed callback on each
+     * snapshot, e.g. to export the size of a queue without instrumenting it. The callback is
+     * invoked with the registry locked, hence it must not access the registry itself. Once this
+     * function returned with a nullptr callback, the previous callback is not invoked anymore.
+     *
+     * @param callback  The callback to invoke, nullptr to remove the gauge.
+     */
+    void setGaugeCallback(const std::string& name, const std::string& help,
+                          const MetricLabels_t& labels, GaugeCallback_t callback);
+
+    /**
+     * @brief Take a snapshot of all metrics, sorted by name and labels.
+     */
+    [[nodiscard]] std::vector<MetricSnapshot> getSnapshot() const;
+
+    /**
+     * @brief Render all metrics in the Prometheus text exposition format.
+     */
+    [[nodiscard]] std::string toPrometheusText() const;
+
+private:
+    struct Entry {
+        MetricSnapshot             m_description;
+        std::unique_ptr<Counter>   m_counter;
+        std::unique_ptr<Gauge>     m_gauge;
+        std::unique_ptr<Histogram> m_histogram;
+        GaugeCallback_t            m_gaugeCallback;
+    };
+
+    Entry& getEntry(const std::string& name, const std::string& help, const MetricLabels_t& labels,
+                    MetricSnapshot::Type type);
+
+    mutable std::mutex           m_mutex;
+    std::map<std::string, Entry> m_entries;
+};
+
+/**
+ * @brief Periodically exports the metrics of a registry in the Prometheus text format from a
+ * background thread.
+ *
+ * A target of the form "unix:<socket path>" serves the metrics to each client connecting to that
+ * Unix domain socket (e.g. `socat - UNIX-CONNECT:<socket path>`), any other target denotes a file
+ * which is atomically replaced every interval and once more when the exporter is destroyed.
+ */
+class MetricsExporter final {
+public:
+    static constexpr auto DEFAULT_INTERVAL = std::chrono::milliseconds{5000};
+
+    /**
+     * @brief Create an exporter configured via the environment variables
+     * SDV_METRICS_EXPORT_PATH (the target) and SDV_METRICS_EXPORT_INTERVAL_MS.
+     *
+     * @return std::unique_ptr<MetricsExporter> nullptr if no target is configured.
+     */
+    static std::unique_ptr<MetricsExporter> createFromEnvironment(MetricsRegistry& registry);
+
+    MetricsExporter(MetricsRegistry& registry, std::string target,
+                    std::chrono::milliseconds interval = DEFAULT_INTERVAL);
+
+    ~MetricsExporter();
+
+    MetricsExporter(const MetricsExporter&)            = delete;
+    MetricsExporter(MetricsExporter&&)                 = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(MetricsExporter&&)      = delete;
+
+private:
+    void runFileExport(const std::string& path);
+    void runSocketExport(const std::string& socketPath);
+    bool waitForStop(std::chrono::milliseconds timeout);
+
+    MetricsRegistry*          m_registry;
+    std::string               m_target;
+    std::chrono::milliseconds m_interval;
+    std::mutex                m_stopMutex;
+    std::condition_variable   m_stopCv;
+    bool                      m_isStopping{false};
+    std::thread               m_thread;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_METRICS_H
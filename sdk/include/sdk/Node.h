@@ -17,6 +17,8 @@
 #ifndef VEHICLE_APP_SDK_NODE_H
 #define VEHICLE_APP_SDK_NODE_H
 
+#include "sdk/PathRegistry.h"
+
 #include <string>
 
 namespace velocitas {
@@ -62,10 +64,18 @@ public:
 
     /**
      * @brief Return the fully qualified path of the node down from the root of the tree.
+     *        The path is computed once on construction.
+     *
+     * @return const std::string& Fully qualified path of the node within the tree.
+     */
+    [[nodiscard]] const std::string& getPath() const;
+
+    /**
+     * @brief Return the id of the node's path within the process-wide PathRegistry.
      *
-     * @return std::string Fully qualified path of the node within the tree.
+     * @return PathId_t Id of the fully qualified path of the node.
      */
-    [[nodiscard]] std::string getPath() const;
+    [[nodiscard]] PathId_t getPathId() const;
 
     /**
      * @brief Get the type of the node
@@ -84,6 +94,8 @@ private:
     // TODO: Use std::weak_ptr ?
     Node* const       m_parent;
     const std::string m_name;
+    const std::string m_path;
+    const PathId_t    m_pathId;
 };
 
 } // namespace velocitas
@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_PATHREGISTRY_H
+#define VEHICLE_APP_SDK_PATHREGISTRY_H
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace velocitas {
+
+/** Process-wide unique id of an interned signal path */
+using PathId_t = uint32_t;
+
+/**
+ * @brief Reference to a path interned in the PathRegistry. Copying it does not copy the path, the
+ *        referenced string stays valid for the lifetime of the process.
+ */
+class InternedPath {
+public:
+    /**
+     * @brief Construct a reference to the empty path.
+     */
+    InternedPath();
+
+    /**
+     * @brief Intern the passed path, see PathRegistry::intern().
+     *
+     * @param path  Path to intern.
+     */
+    explicit InternedPath(std::string_view path);
+
+    [[nodiscard]] const std::string& str() const { return *m_path; }
+    [[nodiscard]] PathId_t           getId() const { return m_id; }
+
+    bool operator==(const InternedPath& other) const {
+        // only the empty path may be referenced by different strings
+        return (m_path == other.m_path) || (*m_path == *other.m_path);
+    }
+    bool operator!=(const InternedPath& other) const { return !(*this == other); }
+
+private:
+    friend class PathRegistry;
+
+    InternedPath(const std::string* path, PathId_t pathId)
+        : m_path(path)
+        , m_id(pathId) {}
+
+    const std::string* m_path;
+    PathId_t           m_id;
+};
+
+/**
+ * @brief Process-wide symbol table of signal paths.
+ *
+ * Each distinct path is stored exactly once and gets a stable, dense id assigned. Ids and the
+ * string views handed out stay valid for the lifetime of the process, entries are never removed.
+ *
+ * The class is thread-safe.
+ */
+class PathRegistry {
+public:
+    static constexpr PathId_t INVALID_ID = std::numeric_limits<PathId_t>::max();
+
+    /**
+     * @brief Get the process-wide registry instance.
+     */
+    static PathRegistry& getInstance();
+
+    PathRegistry() = default;
+
+    /**
+     * @brief Return the id of the passed path, adding it to the registry if not yet present.
+     *
+     * @param path  Path to intern.
+     * @return PathId_t  Id of the path.
+     */
+    PathId_t intern(std::string_view path);
+
+    /**
+     * @brief Return a reference to the passed path, adding it to the registry if not yet present.
+     *
+     * @param path  Path to intern.
+     * @return InternedPath  Reference to the interned path.
+     */
+    InternedPath internPath(std::string_view path);
+
+    /**
+     * @brief Return the id of the passed path without adding it to the registry.
+     *
+     * @param path  Path to look up.
+     * @return PathId_t  Id of the path or INVALID_ID if the path was never interned.
+     */
+    [[nodiscard]] PathId_t find(std::string_view path) const;
+
+    /**
+     * @brief Return the path of the passed id.
+     *
+     * @param pathId  Id returned by intern().
+     * @return std::string_view  View of the interned path, an empty view if the id is unknown.
+     */
+    [[nodiscard]] std::string_view getPath(PathId_t pathId) const;
+
+    /**
+     * @brief Return the number of interned paths.
+     */
+    [[nodiscard]] size_t size() const;
+
+    PathRegistry(const PathRegistry&)            = delete;
+    PathRegistry(PathRegistry&&)                 = delete;
+    PathRegistry& operator=(const PathRegistry&) = delete;
+    PathRegistry& operator=(PathRegistry&&)      = delete;
+
+private:
+    InternedPath findPath(std::string_view path) const;
+
+    mutable std::shared_mutex m_mutex;
+    // std::deque never relocates its elements on push_back, so views into it stay valid
+    std::deque<std::string>                        m_paths;
+    std::unordered_map<std::string_view, PathId_t> m_ids;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_PATHREGISTRY_H
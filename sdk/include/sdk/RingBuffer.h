@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_RINGBUFFER_H
+#define VEHICLE_APP_SDK_RINGBUFFER_H
+
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief FIFO queue on top of a contiguous, circular storage. Pushing to and popping from the
+ *        queue is O(1). The storage grows on demand but never shrinks.
+ *
+ *        The class is not thread-safe, synchronization is up to the user.
+ *
+ * @tparam T  Type of the items, needs to be move constructible.
+ */
+template <typename T> class RingBuffer {
+public:
+    explicit RingBuffer(size_t initialCapacity = DEFAULT_INITIAL_CAPACITY)
+        : m_storage(initialCapacity > 0 ? initialCapacity : 1) {}
+
+    [[nodiscard]] bool   empty() const { return m_size == 0; }
+    [[nodiscard]] size_t size() const { return m_size; }
+
+    /**
+     * @brief Append an item at the end of the queue, grows the storage if needed.
+     */
+    void push_back(T&& item) {
+        if (m_size == m_storage.size()) {
+            grow();
+        }
+        m_storage[(m_head + m_size) % m_storage.size()].emplace(std::move(item));
+        ++m_size;
+    }
+
+    /**
+     * @brief Remove the first item of the queue and return it.
+     */
+    T pop_front() {
+        assert(!empty());
+        T item = std::move(*m_storage[m_head]);
+        m_storage[m_head].reset(); // release any resources held by the moved-from item
+        m_head = (m_head + 1) % m_storage.size();
+        --m_size;
+        return item;
+    }
+
+    /**
+     * @brief Access the item at the passed position of the queue, 0 being the first item.
+     */
+    const T& operator[](size_t index) const {
+        assert(index < m_size);
+        return *m_storage[(m_head + index) % m_storage.size()];
+    }
+
+    T& front() {
+        assert(!empty());
+        return *m_storage[m_head];
+    }
+
+    T& back() {
+        assert(!empty());
+        return *m_storage[(m_head + m_size - 1) % m_storage.size()];
+    }
+
+    void clear() {
+        while (!empty()) {
+            pop_front();
+        }
+    }
+
+private:
+    static constexpr size_t DEFAULT_INITIAL_CAPACITY = 16;
+
+    void grow() {
+        std::vector<std::optional<T>> newStorage(m_storage.size() * 2);
+        for (size_t i = 0; i < m_size; ++i) {
+            newStorage[i].emplace(std::move(*m_storage[(m_head + i) % m_storage.size()]));
+        }
+        m_storage = std::move(newStorage);
+        m_head    = 0;
+    }
+
+    // Slots not holding an item are empty, hence T does not need to be default constructible
+    std::vector<std::optional<T>> m_storage;
+    size_t                        m_head{0};
+    size_t                        m_size{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_RINGBUFFER_H
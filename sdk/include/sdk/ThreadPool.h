@@ -25,29 +25,73 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <string>
 #include <thread>
 #include <vector>
 
 namespace velocitas {
 
+class Counter;
+class Histogram;
+
+/**
+ * @brief Names of the executors (thread pools) used by the SDK itself.
+ */
+namespace executors {
+/// Executes application jobs and everything not asking for a specific executor.
+constexpr char const* DEFAULT = "default";
+/// Executes SDK maintenance work like resubscriptions and metadata lookups.
+constexpr char const* SDK_INTERNAL = "sdk.internal";
+/// Dispatches messages received via the pub/sub middleware to the subscribers.
+constexpr char const* PUBSUB = "pubsub";
+} // namespace executors
+
+/**
+ * @brief Configuration of the worker threads of a thread pool.
+ */
+struct ThreadPoolConfig {
+    enum class SchedulingPolicy { DEFAULT, FIFO, ROUND_ROBIN, BATCH, IDLE };
+
+    size_t           m_numWorkerThreads{2};
+    std::vector<int> m_cpuAffinity; ///< CPUs the workers may run on, empty means all CPUs
+    SchedulingPolicy m_schedulingPolicy{SchedulingPolicy::DEFAULT};
+    int              m_schedulingPriority{0}; ///< only evaluated for FIFO and ROUND_ROBIN
+    std::string      m_name; ///< label of the pool's metrics, unnamed pools are not instrumented
+};
+
 /**
  * @brief Manages a pool of threads which are capable of executing jobs asynchronously.
  *
+ * Each worker owns a local job queue. Jobs enqueued by a worker are put into its own queue,
+ * jobs enqueued from outside the pool are distributed round robin across the workers. Idle
+ * workers steal jobs from the queues of their siblings. Jobs which are not due yet are kept in a
+ * separate timer queue and are only handed over to the workers once they become due.
  */
 class ThreadPool final {
 public:
     ThreadPool();
     explicit ThreadPool(size_t numWorkerThreads);
+    explicit ThreadPool(ThreadPoolConfig config);
 
     ~ThreadPool();
 
     /**
-     * @brief Get the Instance object.
+     * @brief Get the Instance object of the default executor.
      *
      * @return std::shared_ptr<ThreadPool>
      */
     static std::shared_ptr<ThreadPool> getInstance();
 
+    /**
+     * @brief Get the executor registered under the given name. The executor is created on first
+     * access, configured according to the executor configuration file (see README).
+     *
+     * @param executorName  Name of the executor, see namespace velocitas::executors for the
+     *                      executors used by the SDK.
+     * @return std::shared_ptr<ThreadPool>
+     */
+    static std::shared_ptr<ThreadPool> getInstance(const std::string& executorName);
+
     [[nodiscard]] size_t getNumWorkerThreads() const;
 
     /**
@@ -63,18 +107,36 @@ public:
     ThreadPool& operator=(ThreadPool&&)      = delete;
 
 private:
-    JobPtr_t getNextExecutableJob();
-    void     waitForPotentiallyExecutableJob() const;
-    void     threadLoop();
+    struct WorkerQueue;
+
+    void     pushDueJob(JobPtr_t job);
+    void     pushTimedJob(JobPtr_t job);
+    JobPtr_t getNextExecutableJob(size_t workerIndex);
+    bool     isTimedJobDue() const;
+    bool     transferDueTimedJobs();
+    void     waitForPotentiallyExecutableJob();
+    void     applyThreadConfig() const;
+    void     threadLoop(size_t workerIndex);
 
-    using QueueType =
+    using TimerQueueType =
         std::priority_queue<JobPtr_t, std::deque<JobPtr_t>, decltype(lowerJobPriority)*>;
 
-    mutable std::mutex              m_queueMutex;
-    mutable std::condition_variable m_cv;
-    QueueType                       m_jobs;
-    std::vector<std::thread>        m_workerThreads;
-    std::atomic_bool                m_isRunning{true};
+    ThreadPoolConfig                          m_config;
+    std::vector<std::unique_ptr<WorkerQueue>> m_workerQueues;
+    std::atomic_size_t                        m_numQueuedJobs{0};
+    std::atomic_size_t                        m_numIdleWorkers{0};
+    std::atomic_size_t                        m_nextQueueIndex{0};
+
+    std::mutex               m_idleMutex;
+    std::condition_variable  m_idleCv;
+    TimerQueueType           m_timedJobs;
+    size_t                   m_timedJobsVersion{0};
+    std::atomic<Clock::rep>  m_nextTimedJobDue;
+    std::vector<std::thread> m_workerThreads;
+    std::atomic_bool         m_isRunning{true};
+
+    Counter*   m_numEnqueuedJobs{nullptr};
+    Histogram* m_jobDuration{nullptr};
 };
 
 } // namespace velocitas
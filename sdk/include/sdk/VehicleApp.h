@@ -19,6 +19,8 @@
 
 #include "sdk/AsyncResult.h"
 #include "sdk/DataPointReply.h"
+#include "sdk/vdb/PreparedSignalSet.h"
+#include "sdk/vdb/ReadPolicy.h"
 
 #include <condition_variable>
 #include <functional>
@@ -105,6 +107,38 @@ protected:
     AsyncResultPtr_t<DataPointReply>
     getDataPoints(const std::vector<std::reference_wrapper<DataPoint>>& dataPoints);
 
+    /**
+     * @brief Get values for all provided data points, accepting locally cached values if the
+     * passed policy allows to. Requires the read cache to be enabled (SDV_VDB_READ_CACHE_MAX_AGE),
+     * otherwise all values are read from the data broker.
+     *
+     * @param dataPoints    Vector of data points to obtain values for.
+     * @param policy        The freshness required for the values.
+     * @return The reply containing the data point values for all requested data points.
+     */
+    AsyncResultPtr_t<DataPointReply>
+    getDataPoints(const std::vector<std::reference_wrapper<DataPoint>>& dataPoints,
+                  const ReadPolicy&                                     policy);
+
+    /**
+     * @brief Prepare a set of data points for repeated get and subscribe calls. Depending on the
+     * data broker API the signals are resolved just once instead of on every call.
+     *
+     * @param dataPoints    Vector of data points to prepare.
+     * @return The prepared set of data points.
+     */
+    PreparedSignalSetPtr_t
+    prepareDataPoints(const std::vector<std::reference_wrapper<DataPoint>>& dataPoints);
+
+    /**
+     * @brief Get values for all data points of a prepared set from the data broker.
+     *
+     * @param dataPoints    The prepared set as returned by prepareDataPoints().
+     * @return The reply containing the data point values for all data points of the set.
+     */
+    AsyncResultPtr_t<DataPointReply>
+    getPreparedDataPoints(const PreparedSignalSetPtr_t& dataPoints);
+
     /**
      * @brief Get the value a certain data point from the data broker.
      *
@@ -129,6 +163,15 @@ protected:
      */
     AsyncSubscriptionPtr_t<DataPointReply> subscribeDataPoints(const std::string& queryString);
 
+    /**
+     * @brief Subscribes to all data points of a prepared set.
+     *
+     * @param dataPoints    The prepared set as returned by prepareDataPoints().
+     * @return The subscription to the data points.
+     */
+    AsyncSubscriptionPtr_t<DataPointReply>
+    subscribePreparedDataPoints(const PreparedSignalSetPtr_t& dataPoints);
+
     /**
      * @brief Get the Vehicle Data Broker Client object.
      *
@@ -20,10 +20,16 @@
 #include <grpcpp/client_context.h>
 
 #include <functional>
+#include <memory>
+
+namespace grpc {
+class Channel;
+} // namespace grpc
 
 namespace velocitas {
 
 class GrpcCall;
+class ThreadPool;
 
 class AsyncGrpcFacade {
 public:
@@ -32,10 +38,33 @@ public:
     void setContextModifier(ContextModifierFunction function);
 
 protected:
+    /**
+     * @param channel  The channel the calls of the facade are made on.
+     */
+    explicit AsyncGrpcFacade(std::shared_ptr<grpc::Channel> channel);
+
+    /**
+     * @brief Hands the channel over to the SDK's internal thread pool, which releases it once no
+     *        call refers to it anymore.
+     *
+     * Calls keep their channel alive and are typically released by their callbacks, i.e. on a
+     * thread of gRPC's callback completion queue. If such a release destroys the channel, gRPC
+     * 1.51 shuts the queue down on one of its own threads and frees it twice.
+     */
+    ~AsyncGrpcFacade();
+
+    AsyncGrpcFacade(const AsyncGrpcFacade&)            = delete;
+    AsyncGrpcFacade(AsyncGrpcFacade&&)                 = delete;
+    AsyncGrpcFacade& operator=(const AsyncGrpcFacade&) = delete;
+    AsyncGrpcFacade& operator=(AsyncGrpcFacade&&)      = delete;
+
     void applyContextModifier(GrpcCall& call); // NOLINT
 
 private:
-    ContextModifierFunction m_contextModifierFunction;
+    std::shared_ptr<grpc::Channel> m_channel;
+    // Not owned, as the jobs of the pool might hold the last reference to the facade
+    std::weak_ptr<ThreadPool> m_channelReleaseExecutor;
+    ContextModifierFunction   m_contextModifierFunction;
 };
 
 } // namespace velocitas
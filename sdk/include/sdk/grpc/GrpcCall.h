@@ -18,54 +18,121 @@
 #define VEHICLE_APP_SDK_GRPCCALL_H
 
 #include "sdk/Logger.h"
+#include "sdk/Metrics.h"
 
+#include <atomic>
+#include <chrono>
 #include <fmt/core.h>
 #include <functional>
+#include <google/protobuf/arena.h>
 #include <grpcpp/client_context.h>
 #include <grpcpp/impl/codegen/client_callback.h>
+#include <string>
+#include <vector>
 
 namespace velocitas {
 
+/**
+ * @brief Return the size of the arena blocks the messages of GRPC calls are allocated in.
+ *
+ * Configurable via environment variable SDV_GRPC_ARENA_BLOCK_SIZE, defaults to 8 KiB.
+ */
+size_t getGrpcArenaBlockSize();
+
+/**
+ * @brief Create the options for the arena of a GRPC call.
+ *
+ * @param initialBlock  Optional buffer used as first block of the arena. It is kept when the arena
+ * gets reset, hence messages fitting into it are allocated without touching the heap.
+ */
+google::protobuf::ArenaOptions createGrpcArenaOptions(std::vector<char>* initialBlock = nullptr);
+
 /**
  * @brief Base class for implementing GRPC calls.
  *
  */
 class GrpcCall {
 public:
-    grpc::ClientContext m_context;
-    bool                m_isComplete{false};
+    grpc::ClientContext                   m_context;
+    // Set on the thread completing the call, read by the threads owning it
+    std::atomic<bool>                     m_isComplete{false};
+    std::chrono::steady_clock::time_point m_startTime{std::chrono::steady_clock::now()};
+};
+
+/**
+ * @brief Metrics of the calls of a single GRPC method: The duration from creating the call until
+ * its completion (sdv_grpc_call_duration_seconds) and the number of calls which failed
+ * (sdv_grpc_call_failures_total), both labelled by the method.
+ */
+class GrpcCallMetrics {
+public:
+    /**
+     * @param method  Full name of the method, e.g. "kuksa.val.v2.VAL/GetValues".
+     */
+    explicit GrpcCallMetrics(const std::string& method);
+
+    void recordCompletion(const GrpcCall& call, const grpc::Status& status) const;
+
+private:
+    Histogram* m_duration;
+    Counter*   m_failures;
 };
 
 /**
  * @brief A GRPC call where a request is followed up by a single response.
  *
+ * The response and a request built via getRequest() are allocated on an arena owned by the call.
+ *
  * @tparam TRequestType   The data type of the request.
  * @tparam TResponseType  The data type of the (success) response.
  */
 template <class TRequestType, class TResponseType> class GrpcSingleResponseCall : public GrpcCall {
 public:
-    GrpcSingleResponseCall() = default;
+    GrpcSingleResponseCall()
+        : m_arena(createGrpcArenaOptions())
+        , m_request(google::protobuf::Arena::CreateMessage<TRequestType>(&m_arena))
+        , m_response(google::protobuf::Arena::CreateMessage<TResponseType>(&m_arena)) {}
+
     explicit GrpcSingleResponseCall(TRequestType request)
-        : m_request(std::move(request)) {}
-    TRequestType  m_request;
-    TResponseType m_response;
+        : m_arena(createGrpcArenaOptions())
+        , m_passedRequest(std::move(request))
+        , m_request(&m_passedRequest)
+        , m_response(google::protobuf::Arena::CreateMessage<TResponseType>(&m_arena)) {}
+
+    TRequestType&  getRequest() { return *m_request; }
+    TResponseType& getResponse() { return *m_response; }
+
+private:
+    google::protobuf::Arena m_arena;
+    // A passed request is kept off the arena, as moving it onto the arena would copy it
+    TRequestType            m_passedRequest;
+    TRequestType*           m_request;
+    TResponseType*          m_response;
 };
 
 /**
  * @brief A GRPC call where a request is followed up by multiple streamed responses.
  *
+ * Each response is allocated on an arena owned by the call, which is reset after the response
+ * was handled. The arena's first block is reused for all responses.
+ *
  * @tparam TRequestType   The data type of the request.
  * @tparam TResponseType  The data type of a single response.
  */
 template <class TRequestType, class TResponseType>
 class GrpcStreamingResponseCall : public GrpcCall, private grpc::ClientReadReactor<TResponseType> {
 public:
-    GrpcStreamingResponseCall() = default;
+    GrpcStreamingResponseCall()
+        : GrpcStreamingResponseCall(TRequestType{}) {}
+
     explicit GrpcStreamingResponseCall(TRequestType request)
-        : m_request(std::move(request)) {}
+        : m_request(std::move(request))
+        , m_arenaBlock(getGrpcArenaBlockSize())
+        , m_arena(createGrpcArenaOptions(&m_arenaBlock))
+        , m_response(google::protobuf::Arena::CreateMessage<TResponseType>(&m_arena)) {}
 
     GrpcStreamingResponseCall& startCall() {
-        this->StartRead(&m_response);
+        this->StartRead(m_response);
         this->StartCall();
         return *this;
     }
@@ -88,23 +155,31 @@ private:
     void OnReadDone(bool isOk) override {
         if (isOk) {
             try {
-                m_onResponseHandler(m_response);
+                m_onResponseHandler(*m_response);
             } catch (const std::exception& e) {
                 velocitas::logger().error(
                     "GrpcCall: Exception occurred during response handler notification: {}",
                     e.what());
             }
-            this->StartRead(&m_response);
+            // Handlers must not keep references to the response beyond their notification
+            m_arena.Reset();
+            m_response = google::protobuf::Arena::CreateMessage<TResponseType>(&m_arena);
+            this->StartRead(m_response);
         }
     }
 
     void OnDone(const grpc::Status& status) override {
-        m_onFinishHandler(status);
+        // Handlers may keep the call alive, releasing them frees it once the call is done
+        auto onFinishHandler = std::move(m_onFinishHandler);
+        m_onResponseHandler  = nullptr;
+        onFinishHandler(status);
         m_isComplete = true;
     }
 
     TRequestType                              m_request;
-    TResponseType                             m_response;
+    std::vector<char>                         m_arenaBlock;
+    google::protobuf::Arena                   m_arena;
+    TResponseType*                            m_response;
     std::function<void(const TResponseType&)> m_onResponseHandler;
     std::function<void(const grpc::Status&)>  m_onFinishHandler;
 };
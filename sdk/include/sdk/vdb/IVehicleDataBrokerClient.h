@@ -19,6 +19,8 @@
 
 #include "sdk/AsyncResult.h"
 #include "sdk/DataPointReply.h"
+#include "sdk/vdb/PreparedSignalSet.h"
+#include "sdk/vdb/ReadPolicy.h"
 
 #include <map>
 #include <memory>
@@ -55,6 +57,20 @@ public:
     virtual AsyncResultPtr_t<DataPointReply>
     getDatapoints(const std::vector<std::string>& datapoints) = 0;
 
+    /**
+     * @brief Returns data points for a list of data point paths, using values known locally if
+     * the passed policy allows to.
+     *
+     * The default implementation does not know any values locally and always queries the VDB.
+     *
+     * @param datapoints The list of data point paths to query.
+     * @param policy     The freshness required for the values.
+     *
+     * @return The AsyncResult containing the values of all requested data points
+     */
+    virtual AsyncResultPtr_t<DataPointReply>
+    getDatapoints(const std::vector<std::string>& datapoints, const ReadPolicy& policy);
+
     /**
      * @brief Set datapoint values in the VDB.
      *
@@ -73,6 +89,65 @@ public:
      */
     virtual AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) = 0;
 
+    /**
+     * @brief Prepare a set of signals for repeated get, set and subscribe calls. Clients may
+     * resolve the signals once (e.g. to numeric ids), so that calls using the prepared set avoid
+     * the per-call processing of the signal paths.
+     *
+     * The default implementation does not resolve anything and just forwards calls using the
+     * prepared set to their path based counterparts.
+     *
+     * @param signalPaths The paths of the signals to prepare.
+     *
+     * @return PreparedSignalSetPtr_t The prepared signal set, only to be used with this client.
+     */
+    virtual PreparedSignalSetPtr_t prepareSignalSet(const std::vector<std::string>& signalPaths);
+
+    /**
+     * @brief Returns data points for all signals of a prepared signal set from the VDB.
+     *
+     * @param signalSet The prepared signal set as returned by prepareSignalSet().
+     *
+     * @return The AsyncResult containing the values of all signals of the set. All replies share
+     * the layout of the set.
+     */
+    virtual AsyncResultPtr_t<DataPointReply>
+    getPreparedDatapoints(const PreparedSignalSetPtr_t& signalSet);
+
+    /**
+     * @brief Set datapoint values in the VDB. All data points need to be part of the passed
+     * prepared signal set.
+     *
+     * @param signalSet  The prepared signal set as returned by prepareSignalSet().
+     * @param datapoints The data point values to set.
+     *
+     * @return AsyncResultPtr_t<SetErrorMap_t> A map which contains [key, error] entries
+     * if a data point could not be set.
+     */
+    virtual AsyncResultPtr_t<SetErrorMap_t>
+    setPreparedDatapoints(const PreparedSignalSetPtr_t&                       signalSet,
+                          const std::vector<std::unique_ptr<DataPointValue>>& datapoints);
+
+    /**
+     * @brief Subscribe to updates of all signals of a prepared signal set. Clients resolving the
+     * set deliver all replies in the layout of the set.
+     *
+     * The default implementation subscribes to a query selecting all signals of the set, its
+     * replies do not share the layout of the set.
+     *
+     * @param signalSet The prepared signal set as returned by prepareSignalSet().
+     *
+     * @return The subscription to the data points.
+     */
+    virtual AsyncSubscriptionPtr_t<DataPointReply>
+    subscribePrepared(const PreparedSignalSetPtr_t& signalSet);
+
+    /**
+     * @brief Send all writes the client holds back right away, e.g. at the end of a control loop
+     * cycle. Clients not holding back any writes (like the default implementation) do nothing.
+     */
+    virtual void flush();
+
     /**
      * @brief Create an instance of the IVehicleDataBrokerClient.
      *
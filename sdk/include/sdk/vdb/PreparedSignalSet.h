@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_PREPAREDSIGNALSET_H
+#define VEHICLE_APP_SDK_VDB_PREPAREDSIGNALSET_H
+
+#include "sdk/DataPointReply.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief A set of signals prepared once via IVehicleDataBrokerClient::prepareSignalSet() for
+ *        repeated get, set and subscribe calls.
+ *
+ *        Clients may derive from this class to attach broker specific data to the set, e.g.
+ *        already resolved signal ids, so that repeated calls skip resolving the signals.
+ *        All replies of getPreparedDatapoints() share the DataPointLayout of the set, hence
+ *        handles resolved via DataPointReply::getHandle() stay valid across all of them. The same
+ *        holds for subscribePrepared() of clients resolving the set.
+ */
+class PreparedSignalSet {
+public:
+    /**
+     * @brief Construct a new prepared signal set.
+     *
+     * @param signalPaths  Paths of the signals, may be unsorted and contain duplicates.
+     */
+    explicit PreparedSignalSet(std::vector<std::string> signalPaths)
+        : m_layout(std::make_shared<const DataPointLayout>(std::move(signalPaths))) {}
+
+    virtual ~PreparedSignalSet() = default;
+
+    /**
+     * @brief Get the sorted and de-duplicated paths of the signals of this set.
+     */
+    [[nodiscard]] const std::vector<std::string>& getSignalPaths() const {
+        return m_layout->getPaths();
+    }
+
+    /**
+     * @brief Get the layout of all replies obtained for this set.
+     */
+    [[nodiscard]] const std::shared_ptr<const DataPointLayout>& getLayout() const {
+        return m_layout;
+    }
+
+    PreparedSignalSet(const PreparedSignalSet&)            = delete;
+    PreparedSignalSet(PreparedSignalSet&&)                 = delete;
+    PreparedSignalSet& operator=(const PreparedSignalSet&) = delete;
+    PreparedSignalSet& operator=(PreparedSignalSet&&)      = delete;
+
+private:
+    std::shared_ptr<const DataPointLayout> m_layout;
+};
+
+using PreparedSignalSetPtr_t = std::shared_ptr<PreparedSignalSet>;
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_PREPAREDSIGNALSET_H
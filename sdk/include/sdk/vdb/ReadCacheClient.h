@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_READCACHECLIENT_H
+#define VEHICLE_APP_SDK_VDB_READCACHECLIENT_H
+
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Client keeping the last known value of each signal read or subscribed via it, so that
+ *        reads can be served in-process if their ReadPolicy allows to.
+ *
+ * The cache is filled from the replies of get requests and from the items of all subscriptions
+ * created via the client. As long as a subscription is active (i.e. neither cancelled nor failed),
+ * the values of its signals are considered to have an age of its max. delivery delay (see
+ * AsyncSubscription::getMaxDeliveryDelay()), e.g. zero if it does not conflate updates. This does
+ * not apply to subscriptions of queries containing a WHERE clause, as these only deliver values
+ * matching the condition.
+ *
+ * Reads using the ReadPolicy::fresh() policy are always forwarded to the wrapped client. Other
+ * reads only request the signals without an acceptable cached value; reads with the
+ * ReadPolicy::cacheOnly() policy never send any request and report signals without a cached value
+ * as not available. Reads using prepared signal sets apply the default policy; if any signal of
+ * the set lacks an acceptable value, the whole set is requested.
+ *
+ * The client needs to be created via std::make_shared.
+ */
+class ReadCacheClient : public IVehicleDataBrokerClient,
+                        public std::enable_shared_from_this<ReadCacheClient> {
+public:
+    /**
+     * @brief Construct a new read cache client.
+     *
+     * @param client         The client to forward the calls to.
+     * @param defaultPolicy  The policy to apply to reads not passing a policy.
+     */
+    ReadCacheClient(std::shared_ptr<IVehicleDataBrokerClient> client, ReadPolicy defaultPolicy);
+
+    ~ReadCacheClient() override = default;
+
+    AsyncResultPtr_t<DataPointReply>
+    getDatapoints(const std::vector<std::string>& datapoints) override;
+
+    AsyncResultPtr_t<DataPointReply> getDatapoints(const std::vector<std::string>& datapoints,
+                                                   const ReadPolicy&               policy) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) override;
+
+    PreparedSignalSetPtr_t prepareSignalSet(const std::vector<std::string>& signalPaths) override;
+
+    AsyncResultPtr_t<DataPointReply>
+    getPreparedDatapoints(const PreparedSignalSetPtr_t& signalSet) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setPreparedDatapoints(const PreparedSignalSetPtr_t&                       signalSet,
+                          const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply>
+    subscribePrepared(const PreparedSignalSetPtr_t& signalSet) override;
+
+    void flush() override;
+
+    /**
+     * @brief Returns the number of signals read which were served from the cache.
+     */
+    [[nodiscard]] uint64_t getNumHits() const { return m_numHits; }
+
+    /**
+     * @brief Returns the number of signals read which were not served from the cache, incl. the
+     * ones read with the ReadPolicy::fresh() policy.
+     */
+    [[nodiscard]] uint64_t getNumMisses() const { return m_numMisses; }
+
+    ReadCacheClient(const ReadCacheClient&)            = delete;
+    ReadCacheClient(ReadCacheClient&&)                 = delete;
+    ReadCacheClient& operator=(const ReadCacheClient&) = delete;
+    ReadCacheClient& operator=(ReadCacheClient&&)      = delete;
+
+private:
+    using Clock_t = std::chrono::steady_clock;
+
+    class Source;
+
+    struct Entry {
+        DataPointValue          m_value;
+        Clock_t::time_point     m_updateTime;
+        // The subscription keeping the value up to date, if any
+        std::shared_ptr<Source> m_source;
+    };
+
+    AsyncSubscriptionPtr_t<DataPointReply>
+    observe(AsyncSubscriptionPtr_t<DataPointReply> subscription, bool isComplete);
+
+    /**
+     * @brief Fill the slots of the passed layout with the acceptable cached values.
+     *
+     * @return The slots without an acceptable value.
+     */
+    std::vector<DataPointLayout::Handle_t> lookUp(const DataPointLayout& layout,
+                                                  const ReadPolicy&      policy,
+                                                  DataPointValues_t&     values) const;
+
+    /**
+     * @brief Create the reply of a read served without a request, reporting the missing slots as
+     *        not available.
+     */
+    static AsyncResultPtr_t<DataPointReply>
+    createLocalReply(std::shared_ptr<const DataPointLayout>        layout,
+                     std::shared_ptr<DataPointValues_t>            values,
+                     const std::vector<DataPointLayout::Handle_t>& missingSlots);
+
+    void storeReply(const DataPointReply& reply, const std::shared_ptr<Source>& source);
+
+    [[nodiscard]] bool isAcceptable(const Entry& entry, const ReadPolicy& policy,
+                                    Clock_t::time_point now) const;
+
+    std::shared_ptr<IVehicleDataBrokerClient> m_client;
+    ReadPolicy                                m_defaultPolicy;
+    mutable std::shared_mutex                 m_mutex;
+    std::unordered_map<PathId_t, Entry>       m_entries;
+    std::atomic_uint64_t                      m_numHits{0};
+    std::atomic_uint64_t                      m_numMisses{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_READCACHECLIENT_H
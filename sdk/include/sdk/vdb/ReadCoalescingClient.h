@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_READCOALESCINGCLIENT_H
+#define VEHICLE_APP_SDK_VDB_READCOALESCINGCLIENT_H
+
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Client merging concurrent reads of its callers into few get requests to the wrapped
+ *        client (single-flight).
+ *
+ * A read of a signal which is already being read by an earlier call does not cause another request
+ * but is served by the reply of the earlier one. Only the signals not in flight yet are requested.
+ * Optionally, these are collected for a batching window (counted from the first signal collected)
+ * or until flush() is called, so that reads issued within the window share a single request.
+ * Each caller gets a reply containing exactly the signals it asked for.
+ *
+ * All other calls incl. reads passing a ReadPolicy (which the wrapped client may serve locally)
+ * and the ones using prepared signal sets are forwarded as is.
+ *
+ * The client needs to be created via std::make_shared.
+ */
+class ReadCoalescingClient : public IVehicleDataBrokerClient,
+                             public std::enable_shared_from_this<ReadCoalescingClient> {
+public:
+    /**
+     * @brief Construct a new read coalescing client.
+     *
+     * @param client  The client to forward the calls to.
+     * @param window  Time to collect signals to read before requesting them, std::nullopt to
+     * request them right away.
+     */
+    ReadCoalescingClient(std::shared_ptr<IVehicleDataBrokerClient> client,
+                         std::optional<std::chrono::milliseconds>  window);
+
+    ~ReadCoalescingClient() override;
+
+    AsyncResultPtr_t<DataPointReply>
+    getDatapoints(const std::vector<std::string>& datapoints) override;
+
+    AsyncResultPtr_t<DataPointReply> getDatapoints(const std::vector<std::string>& datapoints,
+                                                   const ReadPolicy&               policy) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) override;
+
+    PreparedSignalSetPtr_t prepareSignalSet(const std::vector<std::string>& signalPaths) override;
+
+    AsyncResultPtr_t<DataPointReply>
+    getPreparedDatapoints(const PreparedSignalSetPtr_t& signalSet) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setPreparedDatapoints(const PreparedSignalSetPtr_t&                       signalSet,
+                          const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply>
+    subscribePrepared(const PreparedSignalSetPtr_t& signalSet) override;
+
+    /**
+     * @brief Request the signals collected for the current batching window right away and flush
+     * the wrapped client.
+     */
+    void flush() override;
+
+    ReadCoalescingClient(const ReadCoalescingClient&)            = delete;
+    ReadCoalescingClient(ReadCoalescingClient&&)                 = delete;
+    ReadCoalescingClient& operator=(const ReadCoalescingClient&) = delete;
+    ReadCoalescingClient& operator=(ReadCoalescingClient&&)      = delete;
+
+private:
+    class Read;
+    class Waiter;
+
+    void sendRead(const std::shared_ptr<Read>& read);
+    void scheduleBatchedRead(const std::shared_ptr<Read>& read);
+    void finishRead(const std::shared_ptr<Read>& read);
+
+    std::shared_ptr<IVehicleDataBrokerClient>           m_client;
+    std::optional<std::chrono::milliseconds>            m_window;
+    std::mutex                                          m_mutex;
+    // The read in flight (or still collecting signals) for each signal being read
+    std::unordered_map<PathId_t, std::shared_ptr<Read>> m_readsByPath;
+    // The read collecting signals during the current batching window
+    std::shared_ptr<Read>                               m_batchedRead;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_READCOALESCINGCLIENT_H
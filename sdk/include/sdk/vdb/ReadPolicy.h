@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_READPOLICY_H
+#define VEHICLE_APP_SDK_VDB_READPOLICY_H
+
+#include <chrono>
+
+namespace velocitas {
+
+/**
+ * @brief Freshness required by a read of data points, deciding whether a value known locally
+ *        (e.g. from a subscription) may be returned instead of asking the data broker.
+ *
+ * Values kept up to date by an active subscription are considered to have an age of zero.
+ */
+class ReadPolicy final {
+public:
+    enum class Mode {
+        FRESH,      ///< Always read from the data broker
+        MAX_AGE,    ///< Use a local value not older than the max. age, read others from the broker
+        CACHE_ONLY, ///< Only use local values, report the others as not available
+    };
+
+    /**
+     * @brief Always read the values from the data broker.
+     */
+    static ReadPolicy fresh() { return ReadPolicy(Mode::FRESH, std::chrono::milliseconds{0}); }
+
+    /**
+     * @brief Accept local values received at most the passed time ago.
+     *
+     * @param maxAge  The max. age of a local value to return.
+     */
+    static ReadPolicy maxAge(std::chrono::milliseconds maxAge) {
+        return ReadPolicy(Mode::MAX_AGE, maxAge);
+    }
+
+    /**
+     * @brief Only return local values regardless of their age, without asking the data broker.
+     */
+    static ReadPolicy cacheOnly() {
+        return ReadPolicy(Mode::CACHE_ONLY, std::chrono::milliseconds::max());
+    }
+
+    [[nodiscard]] Mode                      getMode() const { return m_mode; }
+    [[nodiscard]] std::chrono::milliseconds getMaxAge() const { return m_maxAge; }
+
+private:
+    ReadPolicy(Mode mode, std::chrono::milliseconds maxAge)
+        : m_mode(mode)
+        , m_maxAge(maxAge) {}
+
+    Mode                      m_mode;
+    std::chrono::milliseconds m_maxAge;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_READPOLICY_H
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_WRITECOALESCINGCLIENT_H
+#define VEHICLE_APP_SDK_VDB_WRITECOALESCINGCLIENT_H
+
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Client merging the writes of its callers into few set requests to the wrapped client.
+ *
+ * Values passed to setDatapoints() are held back until the coalescing window elapsed (counted
+ * from the first write held back) or until flush() is called. They are then sent via a single
+ * setDatapoints() call of the wrapped client. If a signal was written several times, only the
+ * last value is sent (last writer wins). Each caller gets the errors of its own signals reported,
+ * i.e. a caller whose value got superseded gets the outcome of the value finally sent.
+ *
+ * Writes using prepared signal sets are not held back. If a write of one of their signals is held
+ * back, all held back writes are sent before, so that the prepared write is not overtaken.
+ *
+ * All other calls incl. reads passing a ReadPolicy and the ones using prepared signal sets are
+ * forwarded as is.
+ *
+ * The client needs to be created via std::make_shared.
+ */
+class WriteCoalescingClient : public IVehicleDataBrokerClient,
+                              public std::enable_shared_from_this<WriteCoalescingClient> {
+public:
+    /**
+     * @brief Construct a new write coalescing client.
+     *
+     * @param client  The client to forward the calls to.
+     * @param window  Time to hold back writes before sending them, std::nullopt to only send them
+     * on flush().
+     */
+    WriteCoalescingClient(std::shared_ptr<IVehicleDataBrokerClient> client,
+                          std::optional<std::chrono::milliseconds>  window);
+
+    ~WriteCoalescingClient() override;
+
+    AsyncResultPtr_t<DataPointReply>
+    getDatapoints(const std::vector<std::string>& datapoints) override;
+
+    AsyncResultPtr_t<DataPointReply> getDatapoints(const std::vector<std::string>& datapoints,
+                                                   const ReadPolicy&               policy) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) override;
+
+    PreparedSignalSetPtr_t prepareSignalSet(const std::vector<std::string>& signalPaths) override;
+
+    AsyncResultPtr_t<DataPointReply>
+    getPreparedDatapoints(const PreparedSignalSetPtr_t& signalSet) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setPreparedDatapoints(const PreparedSignalSetPtr_t&                       signalSet,
+                          const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply>
+    subscribePrepared(const PreparedSignalSetPtr_t& signalSet) override;
+
+    /**
+     * @brief Send all writes held back right away and flush the wrapped client.
+     */
+    void flush() override;
+
+    WriteCoalescingClient(const WriteCoalescingClient&)            = delete;
+    WriteCoalescingClient(WriteCoalescingClient&&)                 = delete;
+    WriteCoalescingClient& operator=(const WriteCoalescingClient&) = delete;
+    WriteCoalescingClient& operator=(WriteCoalescingClient&&)      = delete;
+
+private:
+    struct PendingWrite {
+        AsyncResultPtr_t<SetErrorMap_t> m_result;
+        std::vector<InternedPath>       m_paths;
+    };
+
+    void scheduleFlush(uint64_t batchNumber);
+
+    [[nodiscard]] bool
+    isAnyWritePending(const std::vector<std::unique_ptr<DataPointValue>>& datapoints);
+
+    std::shared_ptr<IVehicleDataBrokerClient>    m_client;
+    std::optional<std::chrono::milliseconds>     m_window;
+    std::mutex                                   m_mutex;
+    std::vector<std::unique_ptr<DataPointValue>> m_pendingValues;
+    std::unordered_map<PathId_t, size_t>         m_pendingValueIndexByPath;
+    std::vector<PendingWrite>                    m_pendingWrites;
+    // Number of the batch currently collecting writes, incremented on each flush
+    uint64_t                                     m_batchNumber{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_WRITECOALESCINGCLIENT_H
@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/AsyncConsoleLogger.h"
+
+#include "ConsoleLogFormat.h"
+
+#include <fmt/core.h>
+
+#include <chrono>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+// Upper bound of the delay of a message if the writer missed the wake up
+constexpr auto WRITER_IDLE_TIMEOUT = std::chrono::milliseconds{50};
+} // namespace
+
+AsyncConsoleLogger::AsyncConsoleLogger(size_t capacity, OverflowPolicy overflowPolicy,
+                                       std::FILE* stream)
+    : m_buffer(capacity)
+    , m_overflowPolicy(overflowPolicy)
+    , m_stream(stream)
+    , m_writer([this]() { runWriter(); }) {}
+
+AsyncConsoleLogger::~AsyncConsoleLogger() {
+    m_isStopping = true;
+    {
+        std::lock_guard lock(m_wakeUpMutex);
+        m_wakeUpCv.notify_one();
+    }
+    m_writer.join();
+}
+
+void AsyncConsoleLogger::info(const std::string& msg) {
+    push(formatConsoleLogLine(LogLevel::INFO, msg));
+}
+
+void AsyncConsoleLogger::warn(const std::string& msg) {
+    push(formatConsoleLogLine(LogLevel::WARN, msg));
+}
+
+void AsyncConsoleLogger::error(const std::string& msg) {
+    push(formatConsoleLogLine(LogLevel::ERROR, msg));
+}
+
+void AsyncConsoleLogger::debug(const std::string& msg) {
+    push(formatConsoleLogLine(LogLevel::DEBUG, msg));
+}
+
+void AsyncConsoleLogger::flush() {
+    const auto numPushed = m_numPushed.load();
+    while (m_numWritten < numPushed) {
+        wakeUpWriter();
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+}
+
+void AsyncConsoleLogger::push(std::string&& line) {
+    while (!m_buffer.tryPush(std::move(line))) {
+        if (m_overflowPolicy == OverflowPolicy::DROP) {
+            ++m_numDropped;
+            return;
+        }
+        wakeUpWriter();
+        std::this_thread::yield();
+    }
+    ++m_numPushed;
+    if (m_isWriterIdle) {
+        wakeUpWriter();
+    }
+}
+
+void AsyncConsoleLogger::wakeUpWriter() {
+    // Notifying without the mutex can miss the writer going to sleep, which is bounded by the
+    // idle timeout, but never blocks the logging thread
+    m_wakeUpCv.notify_one();
+}
+
+void AsyncConsoleLogger::runWriter() {
+    std::string line;
+    uint64_t    numReportedDrops = 0;
+    while (true) {
+        bool hasWritten = false;
+        while (m_buffer.tryPop(line)) {
+            std::fwrite(line.data(), 1, line.size(), m_stream);
+            ++m_numWritten;
+            hasWritten = true;
+        }
+        if (const auto numDropped = m_numDropped.load(); numDropped != numReportedDrops) {
+            line = formatConsoleLogLine(
+                LogLevel::WARN, fmt::format("{} log messages dropped because of a full buffer",
+                                            numDropped - numReportedDrops));
+            std::fwrite(line.data(), 1, line.size(), m_stream);
+            numReportedDrops = numDropped;
+            hasWritten       = true;
+        }
+        if (hasWritten) {
+            std::fflush(m_stream);
+            continue;
+        }
+        if (m_isStopping) {
+            return;
+        }
+
+        std::unique_lock lock(m_wakeUpMutex);
+        m_isWriterIdle = true;
+        m_wakeUpCv.wait_for(lock, WRITER_IDLE_TIMEOUT,
+                            [this]() { return m_isStopping || (m_numWritten != m_numPushed); });
+        m_isWriterIdle = false;
+    }
+}
+
+} // namespace velocitas
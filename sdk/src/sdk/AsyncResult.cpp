@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/AsyncResult.h"
+
+#ifdef __linux__
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <array>
+#include <functional>
+#endif
+
+namespace velocitas::detail {
+
+static_assert(sizeof(std::atomic_uint32_t) == sizeof(uint32_t) &&
+                  std::atomic_uint32_t::is_always_lock_free,
+              "Waiting on the state requires a plain 32 bit atomic");
+
+#ifdef __linux__
+
+void waitWhileEqual(const std::atomic_uint32_t& state, uint32_t expectedValue) {
+    ::syscall(SYS_futex, &state, FUTEX_WAIT_PRIVATE, expectedValue, nullptr, nullptr, 0);
+}
+
+void wakeAllWaiters(const std::atomic_uint32_t& state) {
+    ::syscall(SYS_futex, &state, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
+
+#else
+
+namespace {
+/**
+ * @brief Small table of condition variables shared by all waiters, selected by the address of
+ *        the state being waited on.
+ */
+struct WaiterBucket {
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+};
+
+WaiterBucket& getBucket(const std::atomic_uint32_t& state) {
+    static std::array<WaiterBucket, 64> buckets;
+    return buckets[std::hash<const void*>{}(&state) % buckets.size()];
+}
+} // namespace
+
+void waitWhileEqual(const std::atomic_uint32_t& state, uint32_t expectedValue) {
+    auto&            bucket = getBucket(state);
+    std::unique_lock lock{bucket.m_mutex};
+    bucket.m_cv.wait(lock, [&state, expectedValue] { return state.load() != expectedValue; });
+}
+
+void wakeAllWaiters(const std::atomic_uint32_t& state) {
+    auto& bucket = getBucket(state);
+    { std::lock_guard lock{bucket.m_mutex}; }
+    bucket.m_cv.notify_all();
+}
+
+#endif
+
+} // namespace velocitas::detail
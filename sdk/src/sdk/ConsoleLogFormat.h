@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_CONSOLELOGFORMAT_H
+#define VEHICLE_APP_SDK_CONSOLELOGFORMAT_H
+
+#include "sdk/Logger.h"
+
+#include <fmt/chrono.h>
+#include <fmt/color.h>
+
+#include <chrono>
+#include <string>
+
+namespace velocitas {
+
+/**
+ * @brief Format a log message as a (colored) line of the console log, stamped with the current
+ *        time.
+ *
+ * @param level The level of the message.
+ * @param msg   The message to log.
+ * @return std::string The line incl. the terminating newline.
+ */
+inline std::string formatConsoleLogLine(LogLevel level, const std::string& msg) {
+    const char* label = "DEBUG";
+    auto        color = fmt::color::brown;
+    switch (level) {
+    case LogLevel::INFO:
+        label = "INFO ";
+        color = fmt::color::white;
+        break;
+    case LogLevel::WARN:
+        label = "WARN ";
+        color = fmt::color::yellow;
+        break;
+    case LogLevel::ERROR:
+        label = "ERROR";
+        color = fmt::color::red;
+        break;
+    default:
+        break;
+    }
+    return fmt::format(fmt::fg(color), "{}, {} : {}\n", std::chrono::system_clock::now(), label,
+                       msg);
+}
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_CONSOLELOGFORMAT_H
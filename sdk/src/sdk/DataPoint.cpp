@@ -34,6 +34,15 @@ template <typename T> AsyncResultPtr_t<TypedDataPointValue<T>> TypedDataPoint<T>
             [this](const DataPointReply& dataPointValues) { return *dataPointValues.get(*this); });
 }
 
+template <typename T>
+AsyncResultPtr_t<TypedDataPointValue<T>> TypedDataPoint<T>::get(const ReadPolicy& policy) const {
+    return VehicleModelContext::getInstance()
+        .getVdbc()
+        ->getDatapoints({getPath()}, policy)
+        ->map<TypedDataPointValue<T>>(
+            [this](const DataPointReply& dataPointValues) { return *dataPointValues.get(*this); });
+}
+
 template <typename T> AsyncResultPtr_t<Status> TypedDataPoint<T>::set(T value) const {
     std::vector<std::unique_ptr<DataPointValue>> vec;
     vec.reserve(1);
@@ -22,6 +22,7 @@
 
 #include <cassert>
 #include <string>
+#include <type_traits>
 
 namespace velocitas {
 
@@ -49,4 +50,24 @@ std::string toString(const DataPointValue::Failure failure) {
     }
 }
 
+std::string DataPointValue::getValueAsString() const {
+    return std::visit(
+        [](const auto& value) -> std::string {
+            using Value_t = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<Value_t, std::monostate>) {
+                throw InvalidValueException("Data point does not carry a value!");
+            } else if constexpr (std::is_same_v<Value_t, bool>) {
+                return value ? "true" : "false";
+            } else if constexpr (std::is_arithmetic_v<Value_t>) {
+                return std::to_string(value);
+            } else if constexpr (std::is_same_v<Value_t, std::string>) {
+                return value;
+            } else {
+                // Return empty string in case of unspecific data types
+                return "<unknown datatype>";
+            }
+        },
+        m_value);
+}
+
 } // namespace velocitas
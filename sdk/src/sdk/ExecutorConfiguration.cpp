@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ExecutorConfiguration.h"
+
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+
+#include <fstream>
+#include <map>
+#include <nlohmann/json.hpp>
+
+namespace velocitas {
+
+namespace {
+constexpr char const* ENV_VAR_EXECUTOR_CONFIG = "SDV_EXECUTOR_CONFIG_PATH";
+
+constexpr char const* JSON_EXECUTORS_KEY           = "executors";
+constexpr char const* JSON_NUM_WORKER_THREADS_KEY  = "numWorkerThreads";
+constexpr char const* JSON_CPU_AFFINITY_KEY        = "cpuAffinity";
+constexpr char const* JSON_SCHEDULING_POLICY_KEY   = "schedulingPolicy";
+constexpr char const* JSON_SCHEDULING_PRIORITY_KEY = "schedulingPriority";
+
+ThreadPoolConfig getBuiltInConfig(const std::string& executorName) {
+    ThreadPoolConfig config;
+    if ((executorName == executors::SDK_INTERNAL) || (executorName == executors::PUBSUB)) {
+        config.m_numWorkerThreads = 1;
+    }
+    return config;
+}
+
+ThreadPoolConfig::SchedulingPolicy parseSchedulingPolicy(const std::string& policyName) {
+    static const std::map<std::string, ThreadPoolConfig::SchedulingPolicy> POLICIES{
+        {"default", ThreadPoolConfig::SchedulingPolicy::DEFAULT},
+        {"fifo", ThreadPoolConfig::SchedulingPolicy::FIFO},
+        {"rr", ThreadPoolConfig::SchedulingPolicy::ROUND_ROBIN},
+        {"batch", ThreadPoolConfig::SchedulingPolicy::BATCH},
+        {"idle", ThreadPoolConfig::SchedulingPolicy::IDLE},
+    };
+
+    const auto iter = POLICIES.find(StringUtils::toLower(policyName));
+    if (iter == POLICIES.end()) {
+        logger().warn("Ignoring unknown scheduling policy {}.", policyName);
+        return ThreadPoolConfig::SchedulingPolicy::DEFAULT;
+    }
+    return iter->second;
+}
+
+void applyJsonConfig(const nlohmann::json& executorConfig, ThreadPoolConfig& config) {
+    if (executorConfig.contains(JSON_NUM_WORKER_THREADS_KEY)) {
+        const auto numWorkerThreads = executorConfig[JSON_NUM_WORKER_THREADS_KEY].get<int>();
+        if (numWorkerThreads > 0) {
+            config.m_numWorkerThreads = static_cast<size_t>(numWorkerThreads);
+        } else {
+            logger().warn("Ignoring invalid number of worker threads {}.", numWorkerThreads);
+        }
+    }
+    if (executorConfig.contains(JSON_CPU_AFFINITY_KEY)) {
+        config.m_cpuAffinity = executorConfig[JSON_CPU_AFFINITY_KEY].get<std::vector<int>>();
+    }
+    if (executorConfig.contains(JSON_SCHEDULING_POLICY_KEY)) {
+        config.m_schedulingPolicy =
+            parseSchedulingPolicy(executorConfig[JSON_SCHEDULING_POLICY_KEY].get<std::string>());
+    }
+    if (executorConfig.contains(JSON_SCHEDULING_PRIORITY_KEY)) {
+        config.m_schedulingPriority = executorConfig[JSON_SCHEDULING_PRIORITY_KEY].get<int>();
+    }
+}
+} // namespace
+
+ThreadPoolConfig getExecutorConfig(const std::string& executorName) {
+    ThreadPoolConfig config = getBuiltInConfig(executorName);
+
+    std::string configFilepath = getEnvVar(ENV_VAR_EXECUTOR_CONFIG);
+    if (!configFilepath.empty()) {
+        auto ifs = std::ifstream(configFilepath);
+        if (ifs.is_open()) {
+            try {
+                const auto  jsonConfig = nlohmann::json::parse(ifs);
+                const auto& executors  = jsonConfig.at(JSON_EXECUTORS_KEY);
+                if (executors.contains(executorName)) {
+                    logger().info("Reading configuration of executor '{}' from file {}.",
+                                  executorName, configFilepath);
+                    applyJsonConfig(executors[executorName], config);
+                }
+            } catch (const nlohmann::json::exception& ex) {
+                logger().warn("Error reading executor configuration file {}: {}", configFilepath,
+                              ex.what());
+            }
+        } else {
+            logger().warn("Cannot open executor configuration file {}.", configFilepath);
+        }
+    }
+
+    return config;
+}
+
+} // namespace velocitas
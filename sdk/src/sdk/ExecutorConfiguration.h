@@ -0,0 +1,37 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_EXECUTORCONFIGURATION_H
+#define VEHICLE_APP_SDK_EXECUTORCONFIGURATION_H
+
+#include "sdk/ThreadPool.h"
+
+#include <string>
+
+namespace velocitas {
+
+/**
+ * @brief Get the configuration of the named executor. Built-in defaults are overridden by the
+ * entries of the JSON file referenced by environment variable SDV_EXECUTOR_CONFIG_PATH.
+ *
+ * @param executorName  Name of the executor
+ * @return ThreadPoolConfig
+ */
+ThreadPoolConfig getExecutorConfig(const std::string& executorName);
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_EXECUTORCONFIGURATION_H
@@ -16,35 +16,118 @@
 
 #include "sdk/Logger.h"
 
-#include <chrono>
+#include "ConsoleLogFormat.h"
+#include "sdk/AsyncConsoleLogger.h"
+#include "sdk/Utils.h"
+
 #include <cstdio>
-#include <fmt/chrono.h>
-#include <fmt/color.h>
+#include <fmt/core.h>
+#include <stdexcept>
+#include <string>
 
 namespace velocitas {
 
+namespace {
+constexpr char const* LOG_LEVEL_ENV_VAR             = "SDV_LOG_LEVEL";
+constexpr char const* ASYNC_BUFFER_SIZE_ENV_VAR     = "SDV_LOG_ASYNC_BUFFER_SIZE";
+constexpr char const* ASYNC_OVERFLOW_POLICY_ENV_VAR = "SDV_LOG_ASYNC_OVERFLOW_POLICY";
+
+// The logger cannot log its own configuration errors
+void reportConfigurationError(const std::string& envVar) {
+    fmt::print(stderr, "Invalid value of env var {}, using the default!\n", envVar);
+}
+
+LogLevel determineLogLevel() {
+    const auto levelStr = StringUtils::toLower(getEnvVar(LOG_LEVEL_ENV_VAR));
+    if (levelStr.empty() || (levelStr == "debug")) {
+        return LogLevel::DEBUG;
+    }
+    if (levelStr == "info") {
+        return LogLevel::INFO;
+    }
+    if (levelStr == "warn") {
+        return LogLevel::WARN;
+    }
+    if (levelStr == "error") {
+        return LogLevel::ERROR;
+    }
+    if (levelStr == "off") {
+        return LogLevel::OFF;
+    }
+    reportConfigurationError(LOG_LEVEL_ENV_VAR);
+    return LogLevel::DEBUG;
+}
+} // namespace
+
 /**
  * @brief Logger implementation for logging to the console.
  *
  */
 class ConsoleLogger : public ILogger {
 public:
-    void info(const std::string& msg) override { log("INFO ", fmt::color::white, msg); }
+    void info(const std::string& msg) override { log(LogLevel::INFO, msg); }
 
-    void warn(const std::string& msg) override { log("WARN ", fmt::color::yellow, msg); }
+    void warn(const std::string& msg) override { log(LogLevel::WARN, msg); }
 
-    void error(const std::string& msg) override { log("ERROR", fmt::color::red, msg); }
+    void error(const std::string& msg) override { log(LogLevel::ERROR, msg); }
 
-    void debug(const std::string& msg) override { log("DEBUG", fmt::color::brown, msg); }
+    void debug(const std::string& msg) override { log(LogLevel::DEBUG, msg); }
 
 private:
-    void log(const std::string& level, fmt::color color, const std::string& msg) {
-        fmt::print(fmt::fg(color), "{}, {} : {}\n", std::chrono::system_clock::now(), level, msg);
+    static void log(LogLevel level, const std::string& msg) {
+        const auto line = formatConsoleLogLine(level, msg);
+        std::fwrite(line.data(), 1, line.size(), stdout);
         std::fflush(stdout);
     }
 };
 
+namespace {
+std::unique_ptr<ILogger> createDefaultLoggerImplementation() {
+    size_t bufferSize = 0;
+    try {
+        const auto bufferSizeStr = getEnvVar(ASYNC_BUFFER_SIZE_ENV_VAR);
+        if (!bufferSizeStr.empty()) {
+            bufferSize = std::stoul(bufferSizeStr);
+        }
+    } catch (const std::logic_error&) {
+        reportConfigurationError(ASYNC_BUFFER_SIZE_ENV_VAR);
+    }
+    if (bufferSize == 0) {
+        return std::make_unique<ConsoleLogger>();
+    }
+
+    auto       overflowPolicy    = AsyncConsoleLogger::OverflowPolicy::DROP;
+    const auto overflowPolicyStr = StringUtils::toLower(getEnvVar(ASYNC_OVERFLOW_POLICY_ENV_VAR));
+    if (overflowPolicyStr == "block") {
+        overflowPolicy = AsyncConsoleLogger::OverflowPolicy::BLOCK;
+    } else if (!overflowPolicyStr.empty() && (overflowPolicyStr != "drop")) {
+        reportConfigurationError(ASYNC_OVERFLOW_POLICY_ENV_VAR);
+    }
+    return std::make_unique<AsyncConsoleLogger>(bufferSize, overflowPolicy);
+}
+} // namespace
+
 Logger::Logger()
-    : m_impl(std::make_unique<ConsoleLogger>()) {}
+    : m_impl(createDefaultLoggerImplementation())
+    , m_level(determineLogLevel()) {}
+
+void Logger::write(LogLevel level, const std::string& msg) {
+    switch (level) {
+    case LogLevel::DEBUG:
+        m_impl->debug(msg);
+        break;
+    case LogLevel::INFO:
+        m_impl->info(msg);
+        break;
+    case LogLevel::WARN:
+        m_impl->warn(msg);
+        break;
+    case LogLevel::ERROR:
+        m_impl->error(msg);
+        break;
+    case LogLevel::OFF:
+        break;
+    }
+}
 
 } // namespace velocitas
@@ -0,0 +1,407 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Metrics.h"
+
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace velocitas {
+
+namespace {
+constexpr char const* EXPORT_PATH_ENV_VAR     = "SDV_METRICS_EXPORT_PATH";
+constexpr char const* EXPORT_INTERVAL_ENV_VAR = "SDV_METRICS_EXPORT_INTERVAL_MS";
+constexpr char const* SOCKET_TARGET_PREFIX    = "unix:";
+
+// Max. delay of noticing the exporter being stopped while waiting for socket clients
+constexpr int SOCKET_POLL_TIMEOUT_MS = 100;
+
+// Separates name and labels in the registry keys. It sorts before any character allowed in a
+// metric name, so all metrics of the same name are adjacent.
+constexpr char KEY_SEPARATOR = '\x01';
+
+std::string escapeLabelValue(const std::string& value) {
+    std::string result;
+    result.reserve(value.size());
+    for (const auto character : value) {
+        switch (character) {
+        case '\\':
+            result += "\\\\";
+            break;
+        case '"':
+            result += "\\\"";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        default:
+            result += character;
+        }
+    }
+    return result;
+}
+
+std::string formatLabels(const MetricLabels_t& labels, const std::string& extraLabel = "") {
+    if (labels.empty() && extraLabel.empty()) {
+        return {};
+    }
+    std::string result = "{";
+    for (const auto& [name, value] : labels) {
+        if (result.size() > 1) {
+            result += ',';
+        }
+        result += fmt::format("{}=\"{}\"", name, escapeLabelValue(value));
+    }
+    if (!extraLabel.empty()) {
+        if (result.size() > 1) {
+            result += ',';
+        }
+        result += extraLabel;
+    }
+    result += '}';
+    return result;
+}
+
+std::string makeKey(const std::string& name, const MetricLabels_t& labels) {
+    return name + KEY_SEPARATOR + formatLabels(labels);
+}
+
+char const* getTypeName(MetricSnapshot::Type type) {
+    switch (type) {
+    case MetricSnapshot::Type::COUNTER:
+        return "counter";
+    case MetricSnapshot::Type::GAUGE:
+        return "gauge";
+    case MetricSnapshot::Type::HISTOGRAM:
+        return "histogram";
+    }
+    return "untyped";
+}
+
+void appendHistogram(std::string& text, const MetricSnapshot& metric) {
+    const auto& histogram = metric.m_histogram;
+    uint64_t    cumulativeCount{0};
+    for (const auto& [upperBound, count] : histogram.m_buckets) {
+        cumulativeCount += count;
+        // Values are integers, so the largest value of a bucket is its inclusive bound ("le")
+        const auto largestValue = static_cast<double>(upperBound - 1) / metric.m_exportDivisor;
+        text += fmt::format("{}_bucket{} {}\n", metric.m_name,
+                            formatLabels(metric.m_labels, fmt::format("le=\"{}\"", largestValue)),
+                            cumulativeCount);
+    }
+    text += fmt::format("{}_bucket{} {}\n", metric.m_name,
+                        formatLabels(metric.m_labels, "le=\"+Inf\""), histogram.m_count);
+    text += fmt::format("{}_sum{} {}\n", metric.m_name, formatLabels(metric.m_labels),
+                        static_cast<double>(histogram.m_sum) / metric.m_exportDivisor);
+    text += fmt::format("{}_count{} {}\n", metric.m_name, formatLabels(metric.m_labels),
+                        histogram.m_count);
+}
+} // namespace
+
+uint64_t HistogramSnapshot::getQuantile(double quantile) const {
+    if (m_count == 0) {
+        return 0;
+    }
+    const auto rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(std::clamp(quantile, 0.0, 1.0) * m_count)));
+    uint64_t cumulativeCount{0};
+    for (const auto& [upperBound, count] : m_buckets) {
+        cumulativeCount += count;
+        if (cumulativeCount >= rank) {
+            return upperBound - 1;
+        }
+    }
+    return m_buckets.back().first - 1;
+}
+
+size_t Histogram::getBucketIndex(uint64_t value) {
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+    const auto mostSignificantBit = static_cast<uint32_t>(63 - __builtin_clzll(value));
+    const auto shift              = mostSignificantBit - SUB_BUCKET_BITS;
+    const auto subBucket          = (value >> shift) & (SUB_BUCKET_COUNT - 1);
+    return static_cast<size_t>((shift + 1) * SUB_BUCKET_COUNT + subBucket);
+}
+
+uint64_t Histogram::getBucketLowerBound(size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    const auto shift     = index / SUB_BUCKET_COUNT - 1;
+    const auto subBucket = index % SUB_BUCKET_COUNT;
+    return (SUB_BUCKET_COUNT + subBucket) << shift;
+}
+
+HistogramSnapshot Histogram::getSnapshot() const {
+    HistogramSnapshot snapshot;
+    // Buckets are read one by one while values may be recorded concurrently. The count is summed
+    // up from the buckets read, so it always matches them. The sum is loaded separately and may
+    // include values recorded during the pass, i.e. the mean is an approximation.
+    for (size_t index = 0; index < NUM_BUCKETS; ++index) {
+        const auto count = m_buckets[index].load(std::memory_order_relaxed);
+        if (count > 0) {
+            const auto upperBound = (index + 1 < NUM_BUCKETS)
+                                        ? getBucketLowerBound(index + 1)
+                                        : std::numeric_limits<uint64_t>::max();
+            snapshot.m_buckets.emplace_back(upperBound, count);
+            snapshot.m_count += count;
+        }
+    }
+    snapshot.m_sum = m_sum.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+MetricsRegistry& MetricsRegistry::getInstance() {
+    // Never destroyed: Metrics are recorded by threads and static objects until the very end
+    static auto* const instance = new MetricsRegistry();
+    static const auto  exporter = MetricsExporter::createFromEnvironment(*instance);
+    return *instance;
+}
+
+MetricsRegistry::Entry& MetricsRegistry::getEntry(const std::string&    name,
+                                                  const std::string&    help,
+                                                  const MetricLabels_t& labels,
+                                                  MetricSnapshot::Type  type) {
+    auto [iter, isNew] = m_entries.try_emplace(makeKey(name, labels));
+    auto& entry        = iter->second;
+    if (isNew) {
+        entry.m_description.m_name   = name;
+        entry.m_description.m_help   = help;
+        entry.m_description.m_labels = labels;
+        entry.m_description.m_type   = type;
+    } else if (entry.m_description.m_type != type) {
+        throw std::invalid_argument(
+            fmt::format("Metric '{}' is already registered as {}", name,
+                        getTypeName(entry.m_description.m_type)));
+    }
+    return entry;
+}
+
+Counter& MetricsRegistry::getCounter(const std::string& name, const std::string& help,
+                                     const MetricLabels_t& labels) {
+    std::lock_guard lock{m_mutex};
+    auto&           entry = getEntry(name, help, labels, MetricSnapshot::Type::COUNTER);
+    if (!entry.m_counter) {
+        entry.m_counter = std::make_unique<Counter>();
+    }
+    return *entry.m_counter;
+}
+
+Gauge& MetricsRegistry::getGauge(const std::string& name, const std::string& help,
+                                 const MetricLabels_t& labels) {
+    std::lock_guard lock{m_mutex};
+    auto&           entry = getEntry(name, help, labels, MetricSnapshot::Type::GAUGE);
+    if (!entry.m_gauge) {
+        entry.m_gauge = std::make_unique<Gauge>();
+    }
+    return *entry.m_gauge;
+}
+
+Histogram& MetricsRegistry::getHistogram(const std::string& name, const std::string& help,
+                                         const MetricLabels_t& labels, double exportDivisor) {
+    std::lock_guard lock{m_mutex};
+    auto&           entry = getEntry(name, help, labels, MetricSnapshot::Type::HISTOGRAM);
+    if (!entry.m_histogram) {
+        entry.m_histogram                   = std::make_unique<Histogram>();
+        entry.m_description.m_exportDivisor = exportDivisor;
+    }
+    return *entry.m_histogram;
+}
+
+void MetricsRegistry::setGaugeCallback(const std::string& name, const std::string& help,
+                                       const MetricLabels_t& labels, GaugeCallback_t callback) {
+    std::lock_guard lock{m_mutex};
+    if (!callback) {
+        m_entries.erase(makeKey(name, labels));
+        return;
+    }
+    getEntry(name, help, labels, MetricSnapshot::Type::GAUGE).m_gaugeCallback =
+        std::move(callback);
+}
+
+std::vector<MetricSnapshot> MetricsRegistry::getSnapshot() const {
+    std::vector<MetricSnapshot> snapshot;
+    std::lock_guard             lock{m_mutex};
+    snapshot.reserve(m_entries.size());
+    for (const auto& [key, entry] : m_entries) {
+        auto& metric = snapshot.emplace_back(entry.m_description);
+        if (entry.m_counter) {
+            metric.m_value = static_cast<int64_t>(entry.m_counter->get());
+        } else if (entry.m_gaugeCallback) {
+            metric.m_value = entry.m_gaugeCallback();
+        } else if (entry.m_gauge) {
+            metric.m_value = entry.m_gauge->get();
+        } else if (entry.m_histogram) {
+            metric.m_histogram = entry.m_histogram->getSnapshot();
+        }
+    }
+    return snapshot;
+}
+
+std::string MetricsRegistry::toPrometheusText() const {
+    std::string text;
+    std::string previousName;
+    for (const auto& metric : getSnapshot()) {
+        if (metric.m_name != previousName) {
+            text += fmt::format("# HELP {} {}\n# TYPE {} {}\n", metric.m_name, metric.m_help,
+                                metric.m_name, getTypeName(metric.m_type));
+            previousName = metric.m_name;
+        }
+        if (metric.m_type == MetricSnapshot::Type::HISTOGRAM) {
+            appendHistogram(text, metric);
+        } else {
+            text += fmt::format("{}{} {}\n", metric.m_name, formatLabels(metric.m_labels),
+                                metric.m_value);
+        }
+    }
+    return text;
+}
+
+std::unique_ptr<MetricsExporter> MetricsExporter::createFromEnvironment(MetricsRegistry& registry) {
+    auto target = getEnvVar(EXPORT_PATH_ENV_VAR);
+    if (target.empty()) {
+        return nullptr;
+    }
+
+    auto interval = DEFAULT_INTERVAL;
+    try {
+        const auto intervalStr = getEnvVar(EXPORT_INTERVAL_ENV_VAR);
+        if (!intervalStr.empty()) {
+            interval = std::chrono::milliseconds{std::max(std::stoi(intervalStr), 1)};
+        }
+    } catch (...) {
+        logger().error("Invalid value of env var {}, using the default!", EXPORT_INTERVAL_ENV_VAR);
+    }
+    return std::make_unique<MetricsExporter>(registry, std::move(target), interval);
+}
+
+MetricsExporter::MetricsExporter(MetricsRegistry& registry, std::string target,
+                                 std::chrono::milliseconds interval)
+    : m_registry(&registry)
+    , m_target(std::move(target))
+    , m_interval(interval) {
+    const auto prefixLength = std::strlen(SOCKET_TARGET_PREFIX);
+    if (m_target.compare(0, prefixLength, SOCKET_TARGET_PREFIX) == 0) {
+        m_thread = std::thread([this, path = m_target.substr(prefixLength)]() {
+            runSocketExport(path);
+        });
+    } else {
+        m_thread = std::thread([this]() { runFileExport(m_target); });
+    }
+}
+
+MetricsExporter::~MetricsExporter() {
+    {
+        std::lock_guard lock{m_stopMutex};
+        m_isStopping = true;
+    }
+    m_stopCv.notify_all();
+    m_thread.join();
+}
+
+bool MetricsExporter::waitForStop(std::chrono::milliseconds timeout) {
+    std::unique_lock lock{m_stopMutex};
+    return m_stopCv.wait_for(lock, timeout, [this]() { return m_isStopping; });
+}
+
+void MetricsExporter::runFileExport(const std::string& path) {
+    const auto tempPath      = path + ".tmp";
+    bool       hasLoggedFail = false;
+    bool       isStopping    = false;
+    while (!isStopping) {
+        isStopping = waitForStop(m_interval);
+
+        // Written to a temporary file first, so readers never observe a partially written file
+        const auto text = m_registry->toPrometheusText();
+        auto*      file = std::fopen(tempPath.c_str(), "w");
+        const bool isWritten =
+            (file != nullptr) && (std::fwrite(text.data(), 1, text.size(), file) == text.size());
+        const bool isClosed = (file != nullptr) && (std::fclose(file) == 0);
+        if (isWritten && isClosed && (std::rename(tempPath.c_str(), path.c_str()) == 0)) {
+            hasLoggedFail = false;
+        } else if (!hasLoggedFail) {
+            logger().error("[MetricsExporter] Cannot write metrics to '{}': {}", path,
+                           std::strerror(errno));
+            hasLoggedFail = true;
+        }
+    }
+}
+
+void MetricsExporter::runSocketExport(const std::string& socketPath) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path)) {
+        logger().error("[MetricsExporter] Socket path '{}' is too long", socketPath);
+        return;
+    }
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    const int serverSocket = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    ::unlink(socketPath.c_str());
+    if ((serverSocket < 0) ||
+        (::bind(serverSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) ||
+        (::listen(serverSocket, SOMAXCONN) != 0)) {
+        logger().error("[MetricsExporter] Cannot listen on socket '{}': {}", socketPath,
+                       std::strerror(errno));
+        if (serverSocket >= 0) {
+            ::close(serverSocket);
+        }
+        return;
+    }
+
+    pollfd pollFd{serverSocket, POLLIN, 0};
+    while (!waitForStop(std::chrono::milliseconds{0})) {
+        if (::poll(&pollFd, 1, SOCKET_POLL_TIMEOUT_MS) <= 0) {
+            continue;
+        }
+        const int clientSocket = ::accept4(serverSocket, nullptr, nullptr, SOCK_CLOEXEC);
+        if (clientSocket < 0) {
+            continue;
+        }
+        const auto text    = m_registry->toPrometheusText();
+        size_t     written = 0;
+        while (written < text.size()) {
+            const auto result =
+                ::send(clientSocket, text.data() + written, text.size() - written, MSG_NOSIGNAL);
+            if (result <= 0) {
+                break;
+            }
+            written += static_cast<size_t>(result);
+        }
+        ::close(clientSocket);
+    }
+
+    ::close(serverSocket);
+    ::unlink(socketPath.c_str());
+}
+
+} // namespace velocitas
@@ -15,30 +15,37 @@
  */
 
 #include "sdk/Node.h"
-#include "sdk/Utils.h"
-
-#include <vector>
 
 namespace velocitas {
 
+namespace {
+
+std::string buildPath(const std::string& name, const Node* parent) {
+    if (parent == nullptr) {
+        return name;
+    }
+    const auto& parentPath = parent->getPath();
+
+    std::string path;
+    path.reserve(parentPath.size() + 1 + name.size());
+    path.append(parentPath).append(".").append(name);
+    return path;
+}
+
+} // namespace
+
 Node::Node(std::string name, Node* parent)
-    : m_name(std::move(name))
-    , m_parent(parent) {}
+    : m_parent(parent)
+    , m_name(std::move(name))
+    , m_path(buildPath(m_name, m_parent))
+    , m_pathId(PathRegistry::getInstance().intern(m_path)) {}
 
 const Node* Node::getParent() const { return m_parent; }
 
 const std::string& Node::getName() const { return m_name; }
 
-std::string Node::getPath() const {
-    std::vector<std::string> path;
-    path.push_back(m_name);
-    auto* node = m_parent;
-    while (node != nullptr) {
-        path.insert(path.begin(), node->m_name);
-        node = node->m_parent;
-    }
+const std::string& Node::getPath() const { return m_path; }
 
-    return StringUtils::join(path, ".");
-}
+PathId_t Node::getPathId() const { return m_pathId; }
 
 } // namespace velocitas
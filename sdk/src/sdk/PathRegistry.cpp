@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/PathRegistry.h"
+
+#include <mutex>
+
+namespace velocitas {
+
+namespace {
+
+// Function local, so that empty paths can be created during static initialization of other units
+const std::string& getEmptyPath() {
+    static const std::string emptyPath;
+    return emptyPath;
+}
+
+} // namespace
+
+InternedPath::InternedPath()
+    : m_path(&getEmptyPath())
+    , m_id(PathRegistry::INVALID_ID) {}
+
+InternedPath::InternedPath(std::string_view path)
+    : InternedPath(PathRegistry::getInstance().internPath(path)) {}
+
+PathRegistry& PathRegistry::getInstance() {
+    static PathRegistry instance;
+    return instance;
+}
+
+PathId_t PathRegistry::intern(std::string_view path) { return internPath(path).getId(); }
+
+InternedPath PathRegistry::internPath(std::string_view path) {
+    if (auto interned = findPath(path); interned.getId() != INVALID_ID) {
+        return interned;
+    }
+
+    std::unique_lock lock(m_mutex);
+    // Re-check, another thread might have interned the path in between
+    if (auto iter = m_ids.find(path); iter != m_ids.end()) {
+        return {&m_paths[iter->second], iter->second};
+    }
+    const auto  pathId   = static_cast<PathId_t>(m_paths.size());
+    const auto& interned = m_paths.emplace_back(path);
+    m_ids.emplace(interned, pathId);
+    return {&interned, pathId};
+}
+
+InternedPath PathRegistry::findPath(std::string_view path) const {
+    std::shared_lock lock(m_mutex);
+    if (auto iter = m_ids.find(path); iter != m_ids.end()) {
+        return {&m_paths[iter->second], iter->second};
+    }
+    return {};
+}
+
+PathId_t PathRegistry::find(std::string_view path) const {
+    std::shared_lock lock(m_mutex);
+    if (auto iter = m_ids.find(path); iter != m_ids.end()) {
+        return iter->second;
+    }
+    return INVALID_ID;
+}
+
+std::string_view PathRegistry::getPath(PathId_t pathId) const {
+    std::shared_lock lock(m_mutex);
+    if (pathId < m_paths.size()) {
+        return m_paths[pathId];
+    }
+    return {};
+}
+
+size_t PathRegistry::size() const {
+    std::shared_lock lock(m_mutex);
+    return m_paths.size();
+}
+
+} // namespace velocitas
@@ -15,39 +15,122 @@
  */
 
 #include "sdk/ThreadPool.h"
+#include "ExecutorConfiguration.h"
 #include "sdk/Logger.h"
+#include "sdk/Metrics.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <map>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace velocitas {
 
-ThreadPool::ThreadPool(size_t numWorkerThreads)
-    : m_jobs(&lowerJobPriority)
-    , m_workerThreads{numWorkerThreads} {
+namespace {
+constexpr auto NO_TIMED_JOB_DUE = Timepoint::max().time_since_epoch().count();
+
+thread_local const ThreadPool* currentPool{nullptr};
+thread_local size_t            currentWorkerIndex{0};
+
+constexpr char const* QUEUED_JOBS_METRIC = "sdv_threadpool_queued_jobs";
+constexpr char const* QUEUED_JOBS_HELP   = "Number of due jobs waiting for a worker";
+} // namespace
+
+/**
+ * @brief Job queue owned by a single worker. Other workers only access it for stealing jobs.
+ */
+struct ThreadPool::WorkerQueue {
+    std::mutex           m_mutex;
+    std::deque<JobPtr_t> m_jobs;
+};
+
+ThreadPool::ThreadPool(ThreadPoolConfig config)
+    : m_config(std::move(config))
+    , m_timedJobs(&lowerJobPriority)
+    , m_nextTimedJobDue{NO_TIMED_JOB_DUE} {
+    const auto numWorkerThreads = m_config.m_numWorkerThreads;
+    const auto numQueues        = std::max<size_t>(numWorkerThreads, 1);
+    m_workerQueues.reserve(numQueues);
+    for (size_t i = 0; i < numQueues; ++i) {
+        m_workerQueues.emplace_back(std::make_unique<WorkerQueue>());
+    }
+
+    if (!m_config.m_name.empty()) {
+        auto&                metrics = MetricsRegistry::getInstance();
+        const MetricLabels_t labels{{"executor", m_config.m_name}};
+        m_numEnqueuedJobs = &metrics.getCounter("sdv_threadpool_enqueued_jobs_total",
+                                                "Number of jobs enqueued", labels);
+        m_jobDuration =
+            &metrics.getHistogram("sdv_threadpool_job_duration_seconds", "Execution time of jobs",
+                                  labels, Histogram::NANOSECONDS_PER_SECOND);
+        metrics.setGaugeCallback(QUEUED_JOBS_METRIC, QUEUED_JOBS_HELP, labels, [this]() {
+            return static_cast<int64_t>(m_numQueuedJobs.load());
+        });
+    }
+
+    m_workerThreads.reserve(numWorkerThreads);
     for (size_t i = 0; i < numWorkerThreads; ++i) {
-        m_workerThreads[i] = std::thread([this]() { threadLoop(); });
+        m_workerThreads.emplace_back([this, i]() { threadLoop(i); });
     }
 }
 
+ThreadPool::ThreadPool(size_t numWorkerThreads)
+    : ThreadPool(ThreadPoolConfig{numWorkerThreads, {}, ThreadPoolConfig::SchedulingPolicy::DEFAULT,
+                                  0, {}}) {}
+
 ThreadPool::ThreadPool()
-    : ThreadPool(2) {}
+    : ThreadPool(ThreadPoolConfig{}) {}
 
 ThreadPool::~ThreadPool() {
+    if (!m_config.m_name.empty()) {
+        MetricsRegistry::getInstance().setGaugeCallback(
+            QUEUED_JOBS_METRIC, QUEUED_JOBS_HELP, {{"executor", m_config.m_name}}, nullptr);
+    }
     {
-        std::lock_guard lock{m_queueMutex};
+        std::lock_guard lock{m_idleMutex};
         m_isRunning = false;
-        // empty the job queue (std::priority_queue does not offer a clear function)
-        QueueType().swap(m_jobs);
+        // empty the timer queue (std::priority_queue does not offer a clear function)
+        TimerQueueType(&lowerJobPriority).swap(m_timedJobs);
     }
-    m_cv.notify_all();
+    for (auto& queue : m_workerQueues) {
+        std::lock_guard lock{queue->m_mutex};
+        queue->m_jobs.clear();
+    }
+    m_idleCv.notify_all();
 
     for (auto& thread : m_workerThreads) {
-        thread.join();
+        if (thread.get_id() == std::this_thread::get_id()) {
+            // The last reference to the pool was released by one of its own jobs. This worker
+            // leaves its loop without touching the pool anymore (see threadLoop).
+            currentPool = nullptr;
+            thread.detach();
+        } else {
+            thread.join();
+        }
     }
 }
 
 std::shared_ptr<ThreadPool> ThreadPool::getInstance() {
-    static std::shared_ptr<ThreadPool> instance{std::make_shared<ThreadPool>()};
+    static std::shared_ptr<ThreadPool> instance{getInstance(executors::DEFAULT)};
+    return instance;
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::getInstance(const std::string& executorName) {
+    static std::mutex                                         registryMutex;
+    static std::map<std::string, std::shared_ptr<ThreadPool>> registry;
+
+    std::lock_guard lock{registryMutex};
+    auto&           instance = registry[executorName];
+    if (!instance) {
+        auto config   = getExecutorConfig(executorName);
+        config.m_name = executorName;
+        instance      = std::make_shared<ThreadPool>(std::move(config));
+    }
     return instance;
 }
 
@@ -55,37 +138,117 @@ size_t ThreadPool::getNumWorkerThreads() const { return m_workerThreads.size();
 
 void ThreadPool::enqueue(JobPtr_t job) {
     if (job) {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
-        m_jobs.push(std::move(job));
-        m_cv.notify_one();
+        if (m_numEnqueuedJobs != nullptr) {
+            m_numEnqueuedJobs->increment();
+        }
+        if (job->isDue()) {
+            pushDueJob(std::move(job));
+        } else {
+            pushTimedJob(std::move(job));
+        }
     } else {
         logger().error("[ThreadPool::enqueue] Ignoring nullptr Job!");
         assert(job);
     }
 }
 
-JobPtr_t ThreadPool::getNextExecutableJob() {
-    JobPtr_t                    job;
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-    if (!m_jobs.empty() && m_jobs.top()->isDue()) {
-        job = m_jobs.top();
-        m_jobs.pop();
+void ThreadPool::pushDueJob(JobPtr_t job) {
+    // Workers keep their own jobs local, everybody else distributes round robin
+    const auto queueIndex = (currentPool == this)
+                                ? currentWorkerIndex
+                                : m_nextQueueIndex++ % m_workerQueues.size();
+
+    // The counter is incremented before the job becomes visible to never let it underflow. A
+    // worker observing the gap just retries.
+    ++m_numQueuedJobs;
+    {
+        auto&           queue = *m_workerQueues[queueIndex];
+        std::lock_guard lock{queue.m_mutex};
+        queue.m_jobs.push_back(std::move(job));
+    }
+
+    if (m_numIdleWorkers > 0) {
+        // Synchronizes with a worker which is about to go idle, so the notification can't get lost
+        { std::lock_guard lock{m_idleMutex}; }
+        m_idleCv.notify_one();
+    }
+}
+
+void ThreadPool::pushTimedJob(JobPtr_t job) {
+    {
+        std::lock_guard lock{m_idleMutex};
+        m_timedJobs.push(std::move(job));
+        ++m_timedJobsVersion;
+        m_nextTimedJobDue = m_timedJobs.top()->getTimepointToExecute().time_since_epoch().count();
+    }
+    m_idleCv.notify_one();
+}
+
+JobPtr_t ThreadPool::getNextExecutableJob(size_t workerIndex) {
+    // Own queue first, then try to steal from the siblings. Stealing never blocks on a queue
+    // which is currently in use by someone else.
+    const auto numQueues = m_workerQueues.size();
+    for (size_t offset = 0; offset < numQueues; ++offset) {
+        auto&            queue = *m_workerQueues[(workerIndex + offset) % numQueues];
+        std::unique_lock lock{queue.m_mutex, std::defer_lock};
+        if (offset == 0) {
+            lock.lock();
+        } else if (!lock.try_lock()) {
+            continue;
+        }
+
+        if (!queue.m_jobs.empty()) {
+            JobPtr_t job = std::move(queue.m_jobs.front());
+            queue.m_jobs.pop_front();
+            --m_numQueuedJobs;
+            return job;
+        }
+    }
+    return {};
+}
+
+bool ThreadPool::isTimedJobDue() const {
+    const auto nextTimedJobDue = m_nextTimedJobDue.load(std::memory_order_relaxed);
+    return (nextTimedJobDue != NO_TIMED_JOB_DUE) &&
+           (nextTimedJobDue <= Clock::now().time_since_epoch().count());
+}
+
+bool ThreadPool::transferDueTimedJobs() {
+    std::vector<JobPtr_t> dueJobs;
+    {
+        std::lock_guard lock{m_idleMutex};
+        while (!m_timedJobs.empty() && m_timedJobs.top()->isDue()) {
+            dueJobs.push_back(m_timedJobs.top());
+            m_timedJobs.pop();
+        }
+        m_nextTimedJobDue =
+            m_timedJobs.empty()
+                ? NO_TIMED_JOB_DUE
+                : m_timedJobs.top()->getTimepointToExecute().time_since_epoch().count();
+    }
+    for (auto& job : dueJobs) {
+        pushDueJob(std::move(job));
     }
-    return job;
+    return !dueJobs.empty();
 }
 
-void ThreadPool::waitForPotentiallyExecutableJob() const {
-    std::unique_lock<std::mutex> lock(m_queueMutex);
-    if (m_jobs.empty()) {
-        m_cv.wait(lock, [this] { return !m_jobs.empty() || !m_isRunning; });
+void ThreadPool::waitForPotentiallyExecutableJob() {
+    std::unique_lock lock{m_idleMutex};
+    ++m_numIdleWorkers;
+    auto isWakeupRequired = [this, timedJobsVersion = m_timedJobsVersion] {
+        return m_numQueuedJobs > 0 || !m_isRunning || m_timedJobsVersion != timedJobsVersion;
+    };
+    if (m_timedJobs.empty()) {
+        m_idleCv.wait(lock, isWakeupRequired);
     } else {
-        auto timepointToExecuteNextJob = m_jobs.top()->getTimepointToExecute();
-        m_cv.wait_until(lock, timepointToExecuteNextJob);
+        auto timepointToExecuteNextJob = m_timedJobs.top()->getTimepointToExecute();
+        m_idleCv.wait_until(lock, timepointToExecuteNextJob, isWakeupRequired);
     }
+    --m_numIdleWorkers;
 }
 
 namespace {
-void executeJob(JobPtr_t job) {
+void executeJob(const JobPtr_t& job) {
     try {
         job->execute();
     } catch (const std::exception& e) {
@@ -97,14 +260,84 @@ void executeJob(JobPtr_t job) {
 }
 } // namespace
 
-void ThreadPool::threadLoop() {
+void ThreadPool::applyThreadConfig() const {
+#ifdef __linux__
+    if (!m_config.m_cpuAffinity.empty()) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (const auto cpu : m_config.m_cpuAffinity) {
+            CPU_SET(cpu, &cpuSet);
+        }
+        const auto result = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+        if (result != 0) {
+            logger().warn("[ThreadPool] Cannot set CPU affinity of worker thread: {}",
+                          std::strerror(result));
+        }
+    }
+
+    if (m_config.m_schedulingPolicy != ThreadPoolConfig::SchedulingPolicy::DEFAULT) {
+        int         policy = SCHED_OTHER;
+        sched_param param{};
+        switch (m_config.m_schedulingPolicy) {
+        case ThreadPoolConfig::SchedulingPolicy::FIFO:
+            policy               = SCHED_FIFO;
+            param.sched_priority = m_config.m_schedulingPriority;
+            break;
+        case ThreadPoolConfig::SchedulingPolicy::ROUND_ROBIN:
+            policy               = SCHED_RR;
+            param.sched_priority = m_config.m_schedulingPriority;
+            break;
+        case ThreadPoolConfig::SchedulingPolicy::BATCH:
+            policy = SCHED_BATCH;
+            break;
+        case ThreadPoolConfig::SchedulingPolicy::IDLE:
+            policy = SCHED_IDLE;
+            break;
+        default:
+            break;
+        }
+        const auto result = pthread_setschedparam(pthread_self(), policy, &param);
+        if (result != 0) {
+            logger().warn("[ThreadPool] Cannot set scheduling policy of worker thread: {}",
+                          std::strerror(result));
+        }
+    }
+#else
+    if (!m_config.m_cpuAffinity.empty() ||
+        (m_config.m_schedulingPolicy != ThreadPoolConfig::SchedulingPolicy::DEFAULT)) {
+        logger().warn("[ThreadPool] CPU affinity and scheduling policy are not supported on this "
+                      "platform!");
+    }
+#endif
+}
+
+void ThreadPool::threadLoop(size_t workerIndex) {
+    currentPool        = this;
+    currentWorkerIndex = workerIndex;
+    applyThreadConfig();
+
     while (m_isRunning) {
-        JobPtr_t job = getNextExecutableJob();
+        if (isTimedJobDue()) {
+            transferDueTimedJobs();
+        }
+
+        JobPtr_t job = getNextExecutableJob(workerIndex);
         if (job) {
+            const auto startTime = (m_jobDuration != nullptr) ? Clock::now() : Timepoint{};
             executeJob(job);
+            if (currentPool != this) {
+                return;
+            }
+            if (m_jobDuration != nullptr) {
+                m_jobDuration->recordDuration(Clock::now() - startTime);
+            }
             if (job->shallRecur()) {
                 enqueue(job);
             }
+            job.reset();
+            if (currentPool != this) {
+                return;
+            }
         } else {
             waitForPotentiallyExecutableJob();
         }
@@ -93,6 +93,32 @@ VehicleApp::getDataPoints(const std::vector<std::reference_wrapper<DataPoint>>&
     return m_vdbClient->getDatapoints(dataPointPaths);
 }
 
+AsyncResultPtr_t<DataPointReply>
+VehicleApp::getDataPoints(const std::vector<std::reference_wrapper<DataPoint>>& dataPoints,
+                          const ReadPolicy&                                     policy) {
+    std::vector<std::string> dataPointPaths;
+    dataPointPaths.reserve(dataPoints.size());
+    for (const auto& dataPoint : dataPoints) {
+        dataPointPaths.emplace_back(dataPoint.get().getPath());
+    }
+    return m_vdbClient->getDatapoints(dataPointPaths, policy);
+}
+
+PreparedSignalSetPtr_t
+VehicleApp::prepareDataPoints(const std::vector<std::reference_wrapper<DataPoint>>& dataPoints) {
+    std::vector<std::string> dataPointPaths;
+    dataPointPaths.reserve(dataPoints.size());
+    for (const auto& dataPoint : dataPoints) {
+        dataPointPaths.emplace_back(dataPoint.get().getPath());
+    }
+    return m_vdbClient->prepareSignalSet(dataPointPaths);
+}
+
+AsyncResultPtr_t<DataPointReply>
+VehicleApp::getPreparedDataPoints(const PreparedSignalSetPtr_t& dataPoints) {
+    return m_vdbClient->getPreparedDatapoints(dataPoints);
+}
+
 AsyncResultPtr_t<DataPointReply>
 VehicleApp::getDataPoint_internal(const DataPoint& dataPoint) const {
     std::vector<std::string> dataPointPaths;
@@ -105,6 +131,11 @@ AsyncSubscriptionPtr_t<DataPointReply> VehicleApp::subscribeDataPoints(const std
     return m_vdbClient->subscribe(query);
 }
 
+AsyncSubscriptionPtr_t<DataPointReply>
+VehicleApp::subscribePreparedDataPoints(const PreparedSignalSetPtr_t& dataPoints) {
+    return m_vdbClient->subscribePrepared(dataPoints);
+}
+
 void VehicleApp::publishToTopic(const std::string& topic, const std::string& data) {
     if (m_pubSubClient) {
         m_pubSubClient->publishOnTopic(topic, data);
@@ -17,8 +17,49 @@
 #include "sdk/grpc/AsyncGrpcFacade.h"
 #include "sdk/grpc/GrpcCall.h"
 
+#include "sdk/Job.h"
+#include "sdk/ThreadPool.h"
+
+#include <grpcpp/channel.h>
+
 namespace velocitas {
 
+namespace {
+
+constexpr std::chrono::milliseconds CHANNEL_RELEASE_CHECK_INTERVAL{100};
+
+/**
+ * @brief Release the passed channel on a thread of the passed executor as soon as it is the only
+ *        reference left, i.e. all calls made on the channel are released.
+ */
+void releaseWhenUnused(const std::weak_ptr<ThreadPool>& executor,
+                       std::shared_ptr<grpc::Channel>   channel) {
+    const auto threadPool = executor.lock();
+    if (!threadPool) {
+        // The executor is being destroyed along with its jobs, i.e. the process exits
+        return;
+    }
+    threadPool->enqueue(Job::create(
+        [executor, channel = std::move(channel)]() mutable {
+            if (channel.use_count() > 1) {
+                releaseWhenUnused(executor, std::move(channel));
+            } else {
+                channel.reset();
+            }
+        },
+        CHANNEL_RELEASE_CHECK_INTERVAL));
+}
+
+} // namespace
+
+AsyncGrpcFacade::AsyncGrpcFacade(std::shared_ptr<grpc::Channel> channel)
+    : m_channel{std::move(channel)}
+    , m_channelReleaseExecutor{ThreadPool::getInstance(executors::SDK_INTERNAL)} {}
+
+AsyncGrpcFacade::~AsyncGrpcFacade() {
+    releaseWhenUnused(m_channelReleaseExecutor, std::move(m_channel));
+}
+
 void AsyncGrpcFacade::setContextModifier(ContextModifierFunction function) {
     m_contextModifierFunction = function;
 }
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/grpc/GrpcCall.h"
+
+#include "sdk/Utils.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace velocitas {
+
+namespace {
+
+constexpr size_t DEFAULT_ARENA_BLOCK_SIZE{8192};
+// Arenas need some space for their own bookkeeping in each block
+constexpr size_t MIN_ARENA_BLOCK_SIZE{256};
+
+size_t determineGrpcArenaBlockSize() {
+    try {
+        auto blockSizeStr = getEnvVar("SDV_GRPC_ARENA_BLOCK_SIZE");
+        if (!blockSizeStr.empty()) {
+            auto blockSize = std::stoi(blockSizeStr);
+            if (blockSize < static_cast<int>(MIN_ARENA_BLOCK_SIZE)) {
+                throw std::out_of_range("block size too small");
+            }
+            return static_cast<size_t>(blockSize);
+        }
+    } catch (...) {
+        logger().error("Invalid GRPC arena block size specified via env var! Using default ({}).",
+                       DEFAULT_ARENA_BLOCK_SIZE);
+    }
+    return DEFAULT_ARENA_BLOCK_SIZE;
+}
+
+} // namespace
+
+size_t getGrpcArenaBlockSize() {
+    static size_t blockSize = determineGrpcArenaBlockSize();
+    return blockSize;
+}
+
+GrpcCallMetrics::GrpcCallMetrics(const std::string& method)
+    : m_duration(&MetricsRegistry::getInstance().getHistogram(
+          "sdv_grpc_call_duration_seconds",
+          "Duration of GRPC calls from their creation until their completion",
+          {{"method", method}}, Histogram::NANOSECONDS_PER_SECOND))
+    , m_failures(&MetricsRegistry::getInstance().getCounter(
+          "sdv_grpc_call_failures_total", "Number of GRPC calls completed with a non-OK status",
+          {{"method", method}})) {}
+
+void GrpcCallMetrics::recordCompletion(const GrpcCall& call, const grpc::Status& status) const {
+    m_duration->recordDuration(std::chrono::steady_clock::now() - call.m_startTime);
+    if (!status.ok()) {
+        m_failures->increment();
+    }
+}
+
+google::protobuf::ArenaOptions createGrpcArenaOptions(std::vector<char>* initialBlock) {
+    google::protobuf::ArenaOptions options;
+    options.start_block_size = getGrpcArenaBlockSize();
+    options.max_block_size   = std::max(options.start_block_size, options.max_block_size);
+    if (initialBlock != nullptr) {
+        options.initial_block      = initialBlock->data();
+        options.initial_block_size = initialBlock->size();
+    }
+    return options;
+}
+
+} // namespace velocitas
@@ -28,7 +28,9 @@ void GrpcClient::addActiveCall(std::shared_ptr<GrpcCall> call) {
 }
 
 void GrpcClient::pruneCompletedRequests() {
-    static auto isComplete = [](const auto& activeCall) { return activeCall->m_isComplete; };
+    static auto isComplete = [](const auto& activeCall) -> bool {
+        return activeCall->m_isComplete;
+    };
 
     {
         std::scoped_lock<std::mutex> lock(m_mutex);
@@ -16,11 +16,13 @@
 
 #include "sdk/IPubSubClient.h"
 #include "sdk/Logger.h"
+#include "sdk/Metrics.h"
 #include "sdk/Status.h"
 #include "sdk/ThreadPool.h"
 
 #include "sdk/middleware/Middleware.h"
 
+#include <chrono>
 #include <mqtt/async_client.h>
 #include <mqtt/connect_options.h>
 #include <unordered_map>
@@ -89,8 +91,15 @@ public:
     [[nodiscard]] bool isConnected() const override { return m_client.is_connected(); }
 
     void publishOnTopic(const std::string& topic, const std::string& data) override {
+        static auto& publishDuration = MetricsRegistry::getInstance().getHistogram(
+            "sdv_mqtt_publish_duration_seconds",
+            "Duration of successful MQTT publishes until their completion", {},
+            Histogram::NANOSECONDS_PER_SECOND);
+
         logger().debug(R"(Publish on topic "{}": "{}")", topic, data);
+        const auto startTime = std::chrono::steady_clock::now();
         m_client.publish(topic, data)->wait();
+        publishDuration.recordDuration(std::chrono::steady_clock::now() - startTime);
     }
 
     AsyncSubscriptionPtr_t<std::string> subscribeTopic(const std::string& topic) override {
@@ -103,15 +112,23 @@ public:
 
 private:
     void message_arrived(mqtt::const_message_ptr msg) override {
+        static auto& receivedMessages = MetricsRegistry::getInstance().getCounter(
+            "sdv_mqtt_received_messages_total", "Number of MQTT messages received");
+        static auto& receivedBytes = MetricsRegistry::getInstance().getCounter(
+            "sdv_mqtt_received_bytes_total", "Payload size of the MQTT messages received");
+
         const std::string& topic   = msg->get_topic();
         const std::string& payload = msg->get_payload_str();
+        receivedMessages.increment();
+        receivedBytes.increment(payload.size());
         logger().debug(R"(MQTT: Update on topic "{}": "{}")", topic, payload);
 
         // Todo: Replace by solution capable handling wildcards
-        auto range = m_subscriberMap.equal_range(topic);
+        auto range    = m_subscriberMap.equal_range(topic);
+        auto executor = ThreadPool::getInstance(executors::PUBSUB);
         for (auto it = range.first; it != range.second; ++it) {
             auto subscription = it->second;
-            ThreadPool::getInstance()->enqueue(Job::create([subscription, payload]() {
+            executor->enqueue(Job::create([subscription, payload]() {
                 try {
                     subscription->insertNewItem(std::string(payload));
                 } catch (std::exception& e) {
@@ -18,12 +18,19 @@
 
 #include "sdk/Logger.h"
 #include "sdk/Utils.h"
+#include "sdk/vdb/ReadCacheClient.h"
+#include "sdk/vdb/ReadCoalescingClient.h"
+#include "sdk/vdb/WriteCoalescingClient.h"
 #include "sdk/vdb/grpc/kuksa_val_v2/BrokerClient.h"
 #include "sdk/vdb/grpc/sdv_databroker_v1/BrokerClient.h"
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <tuple>
+#include <utility>
 
 namespace velocitas {
 
@@ -32,8 +39,28 @@ static const std::string SDV_V1_API           = "sdv.databroker.v1";    // NOLIN
 static const std::string KUKSA_V2_API         = "kuksa.val.v2";         // NOLINT(runtime/string)
 static const auto&       DEFAULT_API          = SDV_V1_API;
 
-std::shared_ptr<IVehicleDataBrokerClient>
-IVehicleDataBrokerClient::createInstance(const std::string& vdbServiceName) {
+constexpr char const* WRITE_COALESCING_ENV_VAR = "SDV_VDB_WRITE_COALESCING_WINDOW";
+constexpr char const* READ_COALESCING_ENV_VAR  = "SDV_VDB_READ_COALESCING_WINDOW";
+constexpr char const* READ_CACHE_ENV_VAR       = "SDV_VDB_READ_CACHE_MAX_AGE";
+
+static std::optional<std::chrono::milliseconds> getDurationFromEnvVar(const std::string& envVar) {
+    try {
+        auto durationStr = getEnvVar(envVar);
+        if (!durationStr.empty()) {
+            auto duration = std::stoi(durationStr);
+            if (duration < 0) {
+                throw std::out_of_range("negative duration");
+            }
+            return std::chrono::milliseconds{duration};
+        }
+    } catch (...) {
+        logger().error("Invalid duration specified via env var {}! Feature is disabled.", envVar);
+    }
+    return std::nullopt;
+}
+
+static std::shared_ptr<IVehicleDataBrokerClient>
+createBrokerClient(const std::string& vdbServiceName) {
     const auto apiVariant = getEnvVar(API_DEFINING_ENV_VAR, DEFAULT_API);
 
     if (apiVariant == SDV_V1_API) {
@@ -50,4 +77,72 @@ IVehicleDataBrokerClient::createInstance(const std::string& vdbServiceName) {
     throw std::runtime_error("Unsupported API specified");
 }
 
+std::shared_ptr<IVehicleDataBrokerClient>
+IVehicleDataBrokerClient::createInstance(const std::string& vdbServiceName) {
+    auto client = createBrokerClient(vdbServiceName);
+
+    if (const auto window = getDurationFromEnvVar(WRITE_COALESCING_ENV_VAR); window) {
+        logger().info("Coalescing writes within {} ms", window->count());
+        client = std::make_shared<WriteCoalescingClient>(std::move(client), window);
+    }
+    if (const auto window = getDurationFromEnvVar(READ_COALESCING_ENV_VAR); window) {
+        logger().info("Coalescing reads within {} ms", window->count());
+        // without a window only reads being in flight at the same time are merged
+        client = std::make_shared<ReadCoalescingClient>(
+            std::move(client), (window->count() > 0) ? window : std::nullopt);
+    }
+    if (const auto maxAge = getDurationFromEnvVar(READ_CACHE_ENV_VAR); maxAge) {
+        logger().info("Caching read values for up to {} ms", maxAge->count());
+        // outermost, so that cache misses are still coalesced
+        client = std::make_shared<ReadCacheClient>(std::move(client), ReadPolicy::maxAge(*maxAge));
+    }
+    return client;
+}
+
+AsyncResultPtr_t<DataPointReply>
+IVehicleDataBrokerClient::getDatapoints(const std::vector<std::string>& datapoints,
+                                        const ReadPolicy&               policy) {
+    std::ignore = policy;
+    return getDatapoints(datapoints);
+}
+
+PreparedSignalSetPtr_t
+IVehicleDataBrokerClient::prepareSignalSet(const std::vector<std::string>& signalPaths) {
+    return std::make_shared<PreparedSignalSet>(signalPaths);
+}
+
+AsyncResultPtr_t<DataPointReply>
+IVehicleDataBrokerClient::getPreparedDatapoints(const PreparedSignalSetPtr_t& signalSet) {
+    return getDatapoints(signalSet->getSignalPaths())
+        ->map<DataPointReply>([layout = signalSet->getLayout()](const DataPointReply& reply) {
+            if (reply.getLayout() == layout) {
+                return reply;
+            }
+            // Move the values into the slots of the set, so that handles resolved once stay valid
+            auto values = std::make_shared<DataPointValues_t>(layout->size());
+            for (DataPointLayout::Handle_t slot = 0; slot < layout->size(); ++slot) {
+                const auto* value = reply.findUntyped(reply.getHandle(layout->getPath(slot)));
+                if (value != nullptr) {
+                    (*values)[slot] = *value;
+                }
+            }
+            return DataPointReply(layout, std::move(values));
+        });
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
+IVehicleDataBrokerClient::setPreparedDatapoints(
+    const PreparedSignalSetPtr_t&                       signalSet,
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    std::ignore = signalSet;
+    return setDatapoints(datapoints);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+IVehicleDataBrokerClient::subscribePrepared(const PreparedSignalSetPtr_t& signalSet) {
+    return subscribe("SELECT " + StringUtils::join(signalSet->getSignalPaths(), ", "));
+}
+
+void IVehicleDataBrokerClient::flush() {}
+
 } // namespace velocitas
@@ -0,0 +1,275 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/ReadCacheClient.h"
+
+#include "sdk/Utils.h"
+
+#include <mutex>
+#include <utility>
+
+namespace velocitas {
+
+/**
+ * @brief A subscription filling the cache.
+ */
+class ReadCacheClient::Source {
+public:
+    Source(const AsyncSubscriptionPtr_t<DataPointReply>& subscription, bool isComplete)
+        : m_subscription(subscription)
+        , m_isComplete(isComplete)
+        , m_maxDeliveryDelay(subscription->getMaxDeliveryDelay()) {}
+
+    void setFailed() { m_hasFailed = true; }
+
+    /**
+     * @brief Get the max. age of the values of a live subscription, e.g. its conflation interval.
+     */
+    [[nodiscard]] std::chrono::milliseconds getMaxDeliveryDelay() const {
+        return m_maxDeliveryDelay;
+    }
+
+    // Only to be called with the client's mutex held exclusively
+    void setLayout(std::shared_ptr<const DataPointLayout> layout) { m_layout = std::move(layout); }
+
+    // Only to be called with the client's mutex held
+    [[nodiscard]] bool isLive(PathId_t pathId) const {
+        if (!m_isComplete || m_hasFailed || !m_layout ||
+            (m_layout->findHandleById(pathId) == DataPointLayout::INVALID_HANDLE)) {
+            return false;
+        }
+        auto subscription = m_subscription.lock();
+        return subscription && !subscription->isCancelled();
+    }
+
+private:
+    std::weak_ptr<AsyncSubscription<DataPointReply>> m_subscription;
+    // False if the subscription does not deliver every change of its signals
+    bool                                             m_isComplete;
+    std::chrono::milliseconds                        m_maxDeliveryDelay;
+    std::atomic_bool                                 m_hasFailed{false};
+    // The layout of the latest item, i.e. the signals currently subscribed
+    std::shared_ptr<const DataPointLayout>           m_layout;
+};
+
+ReadCacheClient::ReadCacheClient(std::shared_ptr<IVehicleDataBrokerClient> client,
+                                 ReadPolicy                                defaultPolicy)
+    : m_client(std::move(client))
+    , m_defaultPolicy(defaultPolicy) {}
+
+AsyncResultPtr_t<DataPointReply>
+ReadCacheClient::getDatapoints(const std::vector<std::string>& datapoints) {
+    return getDatapoints(datapoints, m_defaultPolicy);
+}
+
+AsyncResultPtr_t<DataPointReply>
+ReadCacheClient::getDatapoints(const std::vector<std::string>& datapoints,
+                               const ReadPolicy&               policy) {
+    if (datapoints.empty() || (policy.getMode() == ReadPolicy::Mode::FRESH)) {
+        m_numMisses += datapoints.size();
+        return m_client->getDatapoints(datapoints)->map<DataPointReply>(
+            [weakSelf = weak_from_this()](const DataPointReply& reply) {
+                if (auto self = weakSelf.lock()) {
+                    self->storeReply(reply, nullptr);
+                }
+                return reply;
+            });
+    }
+
+    auto       layout       = std::make_shared<const DataPointLayout>(datapoints);
+    auto       values       = std::make_shared<DataPointValues_t>(layout->size());
+    const auto missingSlots = lookUp(*layout, policy, *values);
+    m_numHits += layout->size() - missingSlots.size();
+    m_numMisses += missingSlots.size();
+
+    if (missingSlots.empty() || (policy.getMode() == ReadPolicy::Mode::CACHE_ONLY)) {
+        return createLocalReply(std::move(layout), std::move(values), missingSlots);
+    }
+
+    std::vector<std::string> missingPaths;
+    missingPaths.reserve(missingSlots.size());
+    for (const auto slot : missingSlots) {
+        missingPaths.emplace_back(layout->getPath(slot));
+    }
+    return m_client->getDatapoints(missingPaths)
+        ->map<DataPointReply>([weakSelf = weak_from_this(), layout, values,
+                               missingSlots](const DataPointReply& reply) {
+            if (auto self = weakSelf.lock()) {
+                self->storeReply(reply, nullptr);
+            }
+            for (const auto slot : missingSlots) {
+                const auto* value = reply.findUntyped(reply.getHandle(layout->getPath(slot)));
+                if (value != nullptr) {
+                    (*values)[slot] = *value;
+                }
+            }
+            return DataPointReply(layout, values);
+        });
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
+ReadCacheClient::setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    return m_client->setDatapoints(datapoints);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply> ReadCacheClient::subscribe(const std::string& query) {
+    // A condition suppresses all changes not matching it
+    const bool isComplete = StringUtils::toUpper(query).find(" WHERE ") == std::string::npos;
+    return observe(m_client->subscribe(query), isComplete);
+}
+
+PreparedSignalSetPtr_t
+ReadCacheClient::prepareSignalSet(const std::vector<std::string>& signalPaths) {
+    return m_client->prepareSignalSet(signalPaths);
+}
+
+AsyncResultPtr_t<DataPointReply>
+ReadCacheClient::getPreparedDatapoints(const PreparedSignalSetPtr_t& signalSet) {
+    const auto& layout = signalSet->getLayout();
+    if (m_defaultPolicy.getMode() != ReadPolicy::Mode::FRESH) {
+        auto       values       = std::make_shared<DataPointValues_t>(layout->size());
+        const auto missingSlots = lookUp(*layout, m_defaultPolicy, *values);
+        if (missingSlots.empty() || (m_defaultPolicy.getMode() == ReadPolicy::Mode::CACHE_ONLY)) {
+            m_numHits += layout->size() - missingSlots.size();
+            m_numMisses += missingSlots.size();
+            return createLocalReply(layout, std::move(values), missingSlots);
+        }
+    }
+
+    // The set is read as a whole to keep the benefit of its prepared requests
+    m_numMisses += layout->size();
+    return m_client->getPreparedDatapoints(signalSet)->map<DataPointReply>(
+        [weakSelf = weak_from_this()](const DataPointReply& reply) {
+            if (auto self = weakSelf.lock()) {
+                self->storeReply(reply, nullptr);
+            }
+            return reply;
+        });
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t> ReadCacheClient::setPreparedDatapoints(
+    const PreparedSignalSetPtr_t&                       signalSet,
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    return m_client->setPreparedDatapoints(signalSet, datapoints);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+ReadCacheClient::subscribePrepared(const PreparedSignalSetPtr_t& signalSet) {
+    return observe(m_client->subscribePrepared(signalSet), true);
+}
+
+void ReadCacheClient::flush() { m_client->flush(); }
+
+AsyncSubscriptionPtr_t<DataPointReply>
+ReadCacheClient::observe(AsyncSubscriptionPtr_t<DataPointReply> subscription, bool isComplete) {
+    if (!subscription) {
+        return subscription;
+    }
+    auto source = std::make_shared<Source>(subscription, isComplete);
+    subscription->setObserver(
+        [weakSelf = weak_from_this(), source](const DataPointReply& item) {
+            if (auto self = weakSelf.lock()) {
+                self->storeReply(item, source);
+            }
+        },
+        [source](const Status&) { source->setFailed(); });
+    return subscription;
+}
+
+std::vector<DataPointLayout::Handle_t>
+ReadCacheClient::lookUp(const DataPointLayout& layout, const ReadPolicy& policy,
+                        DataPointValues_t& values) const {
+    std::vector<DataPointLayout::Handle_t> missingSlots;
+    const auto                             now = Clock_t::now();
+    std::shared_lock                       lock(m_mutex);
+    for (DataPointLayout::Handle_t slot = 0; slot < layout.size(); ++slot) {
+        auto iter = m_entries.find(layout.getInternedPath(slot).getId());
+        if ((iter != m_entries.end()) && isAcceptable(iter->second, policy, now)) {
+            values[slot] = iter->second.m_value;
+        } else {
+            missingSlots.emplace_back(slot);
+        }
+    }
+    return missingSlots;
+}
+
+AsyncResultPtr_t<DataPointReply>
+ReadCacheClient::createLocalReply(std::shared_ptr<const DataPointLayout>        layout,
+                                  std::shared_ptr<DataPointValues_t>            values,
+                                  const std::vector<DataPointLayout::Handle_t>& missingSlots) {
+    for (const auto slot : missingSlots) {
+        (*values)[slot].emplace(DataPointValue::Type::INVALID, layout->getInternedPath(slot),
+                                Timestamp{}, DataPointValue::Failure::NOT_AVAILABLE);
+    }
+    auto result = std::make_shared<AsyncResult<DataPointReply>>();
+    result->insertResult(DataPointReply(std::move(layout), std::move(values)));
+    return result;
+}
+
+void ReadCacheClient::storeReply(const DataPointReply&          reply,
+                                 const std::shared_ptr<Source>& source) {
+    const auto& layout = reply.getLayout();
+    if (!layout) {
+        return;
+    }
+
+    const auto       now = Clock_t::now();
+    std::unique_lock lock(m_mutex);
+    if (source) {
+        source->setLayout(layout);
+    }
+    for (DataPointLayout::Handle_t slot = 0; slot < layout->size(); ++slot) {
+        const auto* value = reply.findUntyped(slot);
+        if (value == nullptr) {
+            continue;
+        }
+        const auto pathId = layout->getInternedPath(slot).getId();
+        auto       iter   = m_entries.find(pathId);
+        if (iter == m_entries.end()) {
+            m_entries.emplace(pathId, Entry{*value, now, source});
+            continue;
+        }
+
+        auto& entry = iter->second;
+        // A get reply may be older than the latest item of a subscription
+        if (!source && entry.m_source && entry.m_source->isLive(pathId)) {
+            continue;
+        }
+        entry.m_value      = *value;
+        entry.m_updateTime = now;
+        entry.m_source     = source;
+    }
+}
+
+bool ReadCacheClient::isAcceptable(const Entry& entry, const ReadPolicy& policy,
+                                   Clock_t::time_point now) const {
+    switch (policy.getMode()) {
+    case ReadPolicy::Mode::FRESH:
+        return false;
+    case ReadPolicy::Mode::CACHE_ONLY:
+        return true;
+    case ReadPolicy::Mode::MAX_AGE:
+        break;
+    }
+    // A live subscription delivers each change, but possibly held back by up to its delay
+    if (entry.m_source && entry.m_source->isLive(entry.m_value.getInternedPath().getId()) &&
+        (entry.m_source->getMaxDeliveryDelay() <= policy.getMaxAge())) {
+        return true;
+    }
+    return (now - entry.m_updateTime) <= policy.getMaxAge();
+}
+
+} // namespace velocitas
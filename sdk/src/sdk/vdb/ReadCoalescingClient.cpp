@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/ReadCoalescingClient.h"
+
+#include "sdk/Job.h"
+#include "sdk/ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace velocitas {
+
+/**
+ * @brief A caller waiting for the signals it asked for, which may be served by several reads.
+ */
+class ReadCoalescingClient::Waiter {
+public:
+    using Handle_t = DataPointLayout::Handle_t;
+
+    explicit Waiter(std::shared_ptr<const DataPointLayout> layout)
+        : m_result(std::make_shared<AsyncResult<DataPointReply>>())
+        , m_layout(std::move(layout))
+        , m_values(std::make_shared<DataPointValues_t>(m_layout->size())) {}
+
+    [[nodiscard]] const DataPointLayout&                 getLayout() const { return *m_layout; }
+    [[nodiscard]] const AsyncResultPtr_t<DataPointReply>& getResult() const { return m_result; }
+
+    void setNumOpenReads(size_t numOpenReads) { m_numOpenReads = numOpenReads; }
+
+    void onReadSucceeded(const DataPointReply& reply, const std::vector<Handle_t>& slots) {
+        bool isComplete = false;
+        {
+            std::lock_guard lock(m_mutex);
+            for (const auto slot : slots) {
+                const auto* value = reply.findUntyped(reply.getHandle(m_layout->getPath(slot)));
+                if (value != nullptr) {
+                    (*m_values)[slot] = *value;
+                }
+            }
+            isComplete = (--m_numOpenReads == 0) && !m_hasFailed;
+        }
+        if (isComplete) {
+            m_result->insertResult(DataPointReply(m_layout, m_values));
+        }
+    }
+
+    void onReadFailed(const Status& status) {
+        bool isFirstFailure = false;
+        {
+            std::lock_guard lock(m_mutex);
+            --m_numOpenReads;
+            isFirstFailure = !m_hasFailed;
+            m_hasFailed    = true;
+        }
+        if (isFirstFailure) {
+            m_result->insertError(Status(status));
+        }
+    }
+
+private:
+    AsyncResultPtr_t<DataPointReply>       m_result;
+    std::shared_ptr<const DataPointLayout> m_layout;
+    std::shared_ptr<DataPointValues_t>     m_values;
+    std::mutex                             m_mutex;
+    size_t                                 m_numOpenReads{0};
+    bool                                   m_hasFailed{false};
+};
+
+/**
+ * @brief A get request to the wrapped client and all callers waiting for (some of) its signals.
+ */
+class ReadCoalescingClient::Read {
+public:
+    using Handle_t = DataPointLayout::Handle_t;
+
+    // Both are only modified with the client's mutex held and as long as the read is registered
+    // in the client's m_readsByPath.
+    std::vector<InternedPath>                                              m_paths;
+    std::vector<std::pair<std::shared_ptr<Waiter>, std::vector<Handle_t>>> m_waiters;
+};
+
+ReadCoalescingClient::ReadCoalescingClient(std::shared_ptr<IVehicleDataBrokerClient> client,
+                                           std::optional<std::chrono::milliseconds>  window)
+    : m_client(std::move(client))
+    , m_window(window) {}
+
+ReadCoalescingClient::~ReadCoalescingClient() {
+    if (m_batchedRead) {
+        sendRead(m_batchedRead);
+    }
+}
+
+AsyncResultPtr_t<DataPointReply>
+ReadCoalescingClient::getDatapoints(const std::vector<std::string>& datapoints) {
+    if (datapoints.empty()) {
+        return m_client->getDatapoints(datapoints);
+    }
+
+    auto        waiter = std::make_shared<Waiter>(std::make_shared<DataPointLayout>(datapoints));
+    const auto& layout = waiter->getLayout();
+
+    std::shared_ptr<Read> newRead;
+    std::shared_ptr<Read> newBatchedRead;
+    {
+        std::lock_guard lock(m_mutex);
+        std::vector<std::pair<std::shared_ptr<Read>, std::vector<Read::Handle_t>>> sources;
+        for (Read::Handle_t slot = 0; slot < layout.size(); ++slot) {
+            const auto path = layout.getInternedPath(slot);
+            auto&      read = m_readsByPath[path.getId()];
+            if (!read) {
+                if (!m_window) {
+                    if (!newRead) {
+                        newRead = std::make_shared<Read>();
+                    }
+                    read = newRead;
+                } else {
+                    if (!m_batchedRead) {
+                        m_batchedRead  = std::make_shared<Read>();
+                        newBatchedRead = m_batchedRead;
+                    }
+                    read = m_batchedRead;
+                }
+                read->m_paths.emplace_back(path);
+            }
+
+            auto iter = std::find_if(sources.begin(), sources.end(),
+                                     [&read](const auto& source) { return source.first == read; });
+            if (iter == sources.end()) {
+                iter = sources.emplace(sources.end(), read, std::vector<Read::Handle_t>{});
+            }
+            iter->second.emplace_back(slot);
+        }
+
+        waiter->setNumOpenReads(sources.size());
+        for (auto& [read, slots] : sources) {
+            read->m_waiters.emplace_back(waiter, std::move(slots));
+        }
+    }
+
+    if (newRead) {
+        sendRead(newRead);
+    }
+    if (newBatchedRead) {
+        scheduleBatchedRead(newBatchedRead);
+    }
+    return waiter->getResult();
+}
+
+AsyncResultPtr_t<DataPointReply>
+ReadCoalescingClient::getDatapoints(const std::vector<std::string>& datapoints,
+                                    const ReadPolicy&               policy) {
+    return m_client->getDatapoints(datapoints, policy);
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t> ReadCoalescingClient::setDatapoints(
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    return m_client->setDatapoints(datapoints);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply> ReadCoalescingClient::subscribe(const std::string& query) {
+    return m_client->subscribe(query);
+}
+
+PreparedSignalSetPtr_t
+ReadCoalescingClient::prepareSignalSet(const std::vector<std::string>& signalPaths) {
+    return m_client->prepareSignalSet(signalPaths);
+}
+
+AsyncResultPtr_t<DataPointReply>
+ReadCoalescingClient::getPreparedDatapoints(const PreparedSignalSetPtr_t& signalSet) {
+    return m_client->getPreparedDatapoints(signalSet);
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
+ReadCoalescingClient::setPreparedDatapoints(
+    const PreparedSignalSetPtr_t&                       signalSet,
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    return m_client->setPreparedDatapoints(signalSet, datapoints);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+ReadCoalescingClient::subscribePrepared(const PreparedSignalSetPtr_t& signalSet) {
+    return m_client->subscribePrepared(signalSet);
+}
+
+void ReadCoalescingClient::flush() {
+    std::shared_ptr<Read> read;
+    {
+        std::lock_guard lock(m_mutex);
+        read = std::move(m_batchedRead);
+        m_batchedRead.reset();
+    }
+    if (read) {
+        sendRead(read);
+    }
+    m_client->flush();
+}
+
+void ReadCoalescingClient::sendRead(const std::shared_ptr<Read>& read) {
+    std::vector<std::string> paths;
+    paths.reserve(read->m_paths.size());
+    for (const auto& path : read->m_paths) {
+        paths.emplace_back(path.str());
+    }
+
+    // The callbacks must not keep the client alive, but still serve the waiters if it is gone
+    auto result = m_client->getDatapoints(paths);
+    result->onResult([weakSelf = weak_from_this(), read](const DataPointReply& reply) {
+        if (auto self = weakSelf.lock()) {
+            self->finishRead(read);
+        }
+        for (const auto& [waiter, slots] : read->m_waiters) {
+            waiter->onReadSucceeded(reply, slots);
+        }
+    });
+    result->onError([weakSelf = weak_from_this(), read](const Status& status) {
+        if (auto self = weakSelf.lock()) {
+            self->finishRead(read);
+        }
+        for (const auto& [waiter, slots] : read->m_waiters) {
+            waiter->onReadFailed(status);
+        }
+    });
+}
+
+void ReadCoalescingClient::scheduleBatchedRead(const std::shared_ptr<Read>& read) {
+    ThreadPool::getInstance(executors::SDK_INTERNAL)
+        ->enqueue(Job::create(
+            [weakSelf = weak_from_this(), weakRead = std::weak_ptr<Read>(read)]() {
+                auto self = weakSelf.lock();
+                auto read = weakRead.lock();
+                if (!self || !read) {
+                    return;
+                }
+                {
+                    std::lock_guard lock(self->m_mutex);
+                    // the read was already sent via flush()
+                    if (self->m_batchedRead != read) {
+                        return;
+                    }
+                    self->m_batchedRead.reset();
+                }
+                self->sendRead(read);
+            },
+            *m_window));
+}
+
+void ReadCoalescingClient::finishRead(const std::shared_ptr<Read>& read) {
+    // Afterwards no further waiters can be attached to the read
+    std::lock_guard lock(m_mutex);
+    for (const auto& path : read->m_paths) {
+        if (auto iter = m_readsByPath.find(path.getId());
+            iter != m_readsByPath.end() && iter->second == read) {
+            m_readsByPath.erase(iter);
+        }
+    }
+}
+
+} // namespace velocitas
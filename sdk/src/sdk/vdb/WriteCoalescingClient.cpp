@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/WriteCoalescingClient.h"
+
+#include "sdk/Job.h"
+#include "sdk/ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace velocitas {
+
+WriteCoalescingClient::WriteCoalescingClient(std::shared_ptr<IVehicleDataBrokerClient> client,
+                                             std::optional<std::chrono::milliseconds>  window)
+    : m_client(std::move(client))
+    , m_window(window) {}
+
+WriteCoalescingClient::~WriteCoalescingClient() { flush(); }
+
+AsyncResultPtr_t<DataPointReply>
+WriteCoalescingClient::getDatapoints(const std::vector<std::string>& datapoints) {
+    return m_client->getDatapoints(datapoints);
+}
+
+AsyncResultPtr_t<DataPointReply>
+WriteCoalescingClient::getDatapoints(const std::vector<std::string>& datapoints,
+                                     const ReadPolicy&               policy) {
+    return m_client->getDatapoints(datapoints, policy);
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t> WriteCoalescingClient::setDatapoints(
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    if (datapoints.empty()) {
+        return m_client->setDatapoints(datapoints);
+    }
+
+    PendingWrite write{std::make_shared<AsyncResult<SetErrorMap_t>>(), {}};
+    write.m_paths.reserve(datapoints.size());
+    auto result = write.m_result;
+
+    bool     isFirstPendingWrite = false;
+    uint64_t batchNumber         = 0;
+    {
+        std::lock_guard lock(m_mutex);
+        for (const auto& datapoint : datapoints) {
+            const auto path = datapoint->getInternedPath();
+            write.m_paths.emplace_back(path);
+            // the typed value can be sliced, it does not add any members
+            auto value = std::make_unique<DataPointValue>(*datapoint);
+            auto [iter, isNew] =
+                m_pendingValueIndexByPath.try_emplace(path.getId(), m_pendingValues.size());
+            if (isNew) {
+                m_pendingValues.emplace_back(std::move(value));
+            } else {
+                m_pendingValues[iter->second] = std::move(value);
+            }
+        }
+        isFirstPendingWrite = m_pendingWrites.empty();
+        batchNumber         = m_batchNumber;
+        m_pendingWrites.emplace_back(std::move(write));
+    }
+
+    if (isFirstPendingWrite) {
+        scheduleFlush(batchNumber);
+    }
+    return result;
+}
+
+AsyncSubscriptionPtr_t<DataPointReply> WriteCoalescingClient::subscribe(const std::string& query) {
+    return m_client->subscribe(query);
+}
+
+PreparedSignalSetPtr_t
+WriteCoalescingClient::prepareSignalSet(const std::vector<std::string>& signalPaths) {
+    return m_client->prepareSignalSet(signalPaths);
+}
+
+AsyncResultPtr_t<DataPointReply>
+WriteCoalescingClient::getPreparedDatapoints(const PreparedSignalSetPtr_t& signalSet) {
+    return m_client->getPreparedDatapoints(signalSet);
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
+WriteCoalescingClient::setPreparedDatapoints(
+    const PreparedSignalSetPtr_t&                       signalSet,
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    if (isAnyWritePending(datapoints)) {
+        flush();
+    }
+    return m_client->setPreparedDatapoints(signalSet, datapoints);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+WriteCoalescingClient::subscribePrepared(const PreparedSignalSetPtr_t& signalSet) {
+    return m_client->subscribePrepared(signalSet);
+}
+
+void WriteCoalescingClient::flush() {
+    std::vector<std::unique_ptr<DataPointValue>> values;
+    auto writes = std::make_shared<std::vector<PendingWrite>>();
+    {
+        std::lock_guard lock(m_mutex);
+        ++m_batchNumber;
+        values.swap(m_pendingValues);
+        writes->swap(m_pendingWrites);
+        m_pendingValueIndexByPath.clear();
+    }
+    if (writes->empty()) {
+        m_client->flush();
+        return;
+    }
+
+    auto result = m_client->setDatapoints(values);
+    result->onResult([writes](const SetErrorMap_t& errorMap) {
+        for (const auto& write : *writes) {
+            SetErrorMap_t writeErrors;
+            for (const auto& path : write.m_paths) {
+                if (auto iter = errorMap.find(path.str()); iter != errorMap.end()) {
+                    writeErrors.emplace(*iter);
+                }
+            }
+            write.m_result->insertResult(std::move(writeErrors));
+        }
+    });
+    result->onError([writes](const Status& status) {
+        for (const auto& write : *writes) {
+            write.m_result->insertError(Status(status));
+        }
+    });
+    m_client->flush();
+}
+
+bool WriteCoalescingClient::isAnyWritePending(
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    std::lock_guard lock(m_mutex);
+    return std::any_of(datapoints.cbegin(), datapoints.cend(), [this](const auto& datapoint) {
+        return m_pendingValueIndexByPath.count(datapoint->getInternedPath().getId()) > 0;
+    });
+}
+
+void WriteCoalescingClient::scheduleFlush(uint64_t batchNumber) {
+    if (!m_window) {
+        return;
+    }
+    ThreadPool::getInstance(executors::SDK_INTERNAL)
+        ->enqueue(Job::create(
+            [weakSelf = weak_from_this(), batchNumber]() {
+                if (auto self = weakSelf.lock()) {
+                    {
+                        std::lock_guard lock(self->m_mutex);
+                        // the batch was already sent via an explicit flush
+                        if (self->m_batchNumber != batchNumber) {
+                            return;
+                        }
+                    }
+                    self->flush();
+                }
+            },
+            *m_window));
+}
+
+} // namespace velocitas
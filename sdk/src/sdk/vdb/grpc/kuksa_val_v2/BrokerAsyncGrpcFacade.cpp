@@ -24,21 +24,25 @@
 namespace velocitas::kuksa_val_v2 {
 
 BrokerAsyncGrpcFacade::BrokerAsyncGrpcFacade(const std::shared_ptr<grpc::Channel>& channel)
-    : m_stub{kuksa::val::v2::VAL::NewStub(channel)} {}
+    : AsyncGrpcFacade(channel)
+    , m_stub{kuksa::val::v2::VAL::NewStub(channel)} {}
 
 void BrokerAsyncGrpcFacade::GetValues(
     kuksa::val::v2::GetValuesRequest                                       request,
     std::function<void(const kuksa::val::v2::GetValuesResponse& response)> responseHandler,
     std::function<void(const grpc::Status& status)>                        errorHandler) {
+    static const GrpcCallMetrics callMetrics{"kuksa.val.v2.VAL/GetValues"};
+
     auto callData = std::make_shared<GrpcSingleResponseCall<kuksa::val::v2::GetValuesRequest,
                                                             kuksa::val::v2::GetValuesResponse>>(
         std::move(request));
     applyContextModifier(*callData);
 
     auto grpcResultHandler = [callData, responseHandler, errorHandler](grpc::Status status) {
+        callMetrics.recordCompletion(*callData, status);
         try {
             if (status.ok()) {
-                responseHandler(callData->m_response);
+                responseHandler(callData->getResponse());
             } else {
                 errorHandler(status);
             };
@@ -48,23 +52,26 @@ void BrokerAsyncGrpcFacade::GetValues(
         callData->m_isComplete = true;
     };
 
-    m_stub->async()->GetValues(&callData->m_context, &callData->m_request, &callData->m_response,
-                               grpcResultHandler);
+    m_stub->async()->GetValues(&callData->m_context, &callData->getRequest(),
+                               &callData->getResponse(), grpcResultHandler);
 }
 
 void BrokerAsyncGrpcFacade::BatchActuate(
     kuksa::val::v2::BatchActuateRequest                                       request,
     std::function<void(const kuksa::val::v2::BatchActuateResponse& response)> responseHandler,
     std::function<void(const grpc::Status& status)>                           errorHandler) {
+    static const GrpcCallMetrics callMetrics{"kuksa.val.v2.VAL/BatchActuate"};
+
     auto callData = std::make_shared<GrpcSingleResponseCall<kuksa::val::v2::BatchActuateRequest,
                                                             kuksa::val::v2::BatchActuateResponse>>(
         std::move(request));
     applyContextModifier(*callData);
 
     auto grpcResultHandler = [callData, responseHandler, errorHandler](grpc::Status status) {
+        callMetrics.recordCompletion(*callData, status);
         try {
             if (status.ok()) {
-                responseHandler(callData->m_response);
+                responseHandler(callData->getResponse());
             } else {
                 errorHandler(status);
             };
@@ -74,8 +81,8 @@ void BrokerAsyncGrpcFacade::BatchActuate(
         callData->m_isComplete = true;
     };
 
-    m_stub->async()->BatchActuate(&callData->m_context, &callData->m_request, &callData->m_response,
-                                  grpcResultHandler);
+    m_stub->async()->BatchActuate(&callData->m_context, &callData->getRequest(),
+                                  &callData->getResponse(), grpcResultHandler);
 }
 
 std::shared_ptr<GrpcCall> BrokerAsyncGrpcFacade::SubscribeById(
@@ -92,7 +99,9 @@ std::shared_ptr<GrpcCall> BrokerAsyncGrpcFacade::SubscribeById(
                                    &callData->getReactor());
 
     callData->onData(updateHandler);
-    callData->onFinish(finishHandler);
+    // The call keeps itself alive until it is done, as its owner might be gone before. Releasing it
+    // on a thread of gRPC does not release the channel (see ~AsyncGrpcFacade).
+    callData->onFinish([callData, finishHandler](const auto& status) { finishHandler(status); });
     callData->startCall();
     return callData;
 }
@@ -101,15 +110,18 @@ void BrokerAsyncGrpcFacade::ListMetadata(
     kuksa::val::v2::ListMetadataRequest                                       request,
     std::function<void(const kuksa::val::v2::ListMetadataResponse& response)> responseHandler,
     std::function<void(const grpc::Status& status)>                           errorHandler) {
+    static const GrpcCallMetrics callMetrics{"kuksa.val.v2.VAL/ListMetadata"};
+
     auto callData = std::make_shared<GrpcSingleResponseCall<kuksa::val::v2::ListMetadataRequest,
                                                             kuksa::val::v2::ListMetadataResponse>>(
         std::move(request));
     applyContextModifier(*callData);
 
     auto grpcResultHandler = [callData, responseHandler, errorHandler](grpc::Status status) {
+        callMetrics.recordCompletion(*callData, status);
         try {
             if (status.ok()) {
-                responseHandler(callData->m_response);
+                responseHandler(callData->getResponse());
             } else {
                 errorHandler(status);
             };
@@ -119,8 +131,37 @@ void BrokerAsyncGrpcFacade::ListMetadata(
         callData->m_isComplete = true;
     };
 
-    m_stub->async()->ListMetadata(&callData->m_context, &callData->m_request, &callData->m_response,
-                                  grpcResultHandler);
+    m_stub->async()->ListMetadata(&callData->m_context, &callData->getRequest(),
+                                  &callData->getResponse(), grpcResultHandler);
+}
+
+void BrokerAsyncGrpcFacade::GetServerInfo(
+    kuksa::val::v2::GetServerInfoRequest                                       request,
+    std::function<void(const kuksa::val::v2::GetServerInfoResponse& response)> responseHandler,
+    std::function<void(const grpc::Status& status)>                            errorHandler) {
+    static const GrpcCallMetrics callMetrics{"kuksa.val.v2.VAL/GetServerInfo"};
+
+    auto callData = std::make_shared<GrpcSingleResponseCall<kuksa::val::v2::GetServerInfoRequest,
+                                                            kuksa::val::v2::GetServerInfoResponse>>(
+        std::move(request));
+    applyContextModifier(*callData);
+
+    auto grpcResultHandler = [callData, responseHandler, errorHandler](grpc::Status status) {
+        callMetrics.recordCompletion(*callData, status);
+        try {
+            if (status.ok()) {
+                responseHandler(callData->getResponse());
+            } else {
+                errorHandler(status);
+            };
+        } catch (std::exception& e) {
+            logger().error("GRPC: Exception occurred during \"GetServerInfo\": {}", e.what());
+        }
+        callData->m_isComplete = true;
+    };
+
+    m_stub->async()->GetServerInfo(&callData->m_context, &callData->getRequest(),
+                                   &callData->getResponse(), grpcResultHandler);
 }
 
 } // namespace velocitas::kuksa_val_v2
@@ -55,6 +55,11 @@ public:
         std::function<void(const kuksa::val::v2::ListMetadataResponse& reply)> replyHandler,
         std::function<void(const grpc::Status& status)>                        errorHandler);
 
+    void GetServerInfo(
+        kuksa::val::v2::GetServerInfoRequest                                    request,
+        std::function<void(const kuksa::val::v2::GetServerInfoResponse& reply)> replyHandler,
+        std::function<void(const grpc::Status& status)>                         errorHandler);
+
 private:
     std::unique_ptr<kuksa::val::v2::VAL::StubInterface> m_stub;
 };
@@ -25,11 +25,12 @@
 #include <string>
 
 namespace velocitas {
-
-class GrpcClient;
-
 namespace kuksa_val_v2 {
 
+class ResolvedSignalSet;
+class SubscriptionMultiplexer;
+struct SignalSetResolution;
+
 /**
  * Provides the Graph API to access vehicle signals via the kuksa.val.v2 API
  */
@@ -45,6 +46,9 @@ public:
     BrokerClient& operator=(const BrokerClient&) = delete;
     BrokerClient& operator=(BrokerClient&&)      = delete;
 
+    // Reads passing a ReadPolicy are served by the default implementation
+    using IVehicleDataBrokerClient::getDatapoints;
+
     AsyncResultPtr_t<DataPointReply>
     getDatapoints(const std::vector<std::string>& datapoints) override;
 
@@ -53,16 +57,48 @@ public:
 
     AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) override;
 
+    PreparedSignalSetPtr_t prepareSignalSet(const std::vector<std::string>& signalPaths) override;
+
+    AsyncResultPtr_t<DataPointReply>
+    getPreparedDatapoints(const PreparedSignalSetPtr_t& signalSet) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setPreparedDatapoints(const PreparedSignalSetPtr_t&                       signalSet,
+                          const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply>
+    subscribePrepared(const PreparedSignalSetPtr_t& signalSet) override;
+
 private:
+    /**
+     * @brief Returns the passed set as ResolvedSignalSet if it was prepared by this client,
+     * nullptr otherwise.
+     */
+    [[nodiscard]] std::shared_ptr<ResolvedSignalSet>
+    asResolvedSignalSet(const PreparedSignalSetPtr_t& signalSet) const;
+
+    void onGetDatapointsError(const grpc::Status&                     status,
+                              const AsyncResultPtr_t<DataPointReply>& result);
+    void onGetValuesResponse(const kuksa::val::v2::GetValuesResponse&      response,
+                             const std::shared_ptr<const DataPointLayout>& layout,
+                             const SignalSetResolution&                    resolution,
+                             const AsyncResultPtr_t<DataPointReply>&       result);
+    void onGetValuesError(const grpc::Status&                           status,
+                          const std::shared_ptr<const DataPointLayout>& layout,
+                          const SignalSetResolution&                    resolution,
+                          const AsyncResultPtr_t<DataPointReply>&       result);
+    void batchActuate(kuksa::val::v2::BatchActuateRequest&&  batchRequest,
+                      const AsyncResultPtr_t<SetErrorMap_t>& result);
+
     void onGetValuesResponse(const kuksa::val::v2::GetValuesResponse& response,
                              const MetadataList_t& metadataList, size_t numRequestedSignals,
                              const AsyncResultPtr_t<DataPointReply>& result);
     void onGetValuesError(const grpc::Status& status, const MetadataList_t& metadataList,
                           const AsyncResultPtr_t<DataPointReply>& result);
 
-    std::shared_ptr<BrokerAsyncGrpcFacade> m_asyncBrokerFacade;
-    std::shared_ptr<MetadataAgent>         m_metadataAgent;
-    std::unique_ptr<GrpcClient>            m_activeCalls;
+    std::shared_ptr<BrokerAsyncGrpcFacade>   m_asyncBrokerFacade;
+    std::shared_ptr<MetadataAgent>           m_metadataAgent;
+    std::shared_ptr<SubscriptionMultiplexer> m_subscriptionMultiplexer;
 };
 
 } // namespace kuksa_val_v2
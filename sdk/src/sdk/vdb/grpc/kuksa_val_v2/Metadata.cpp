@@ -15,25 +15,64 @@
  */
 
 #include "Metadata.h"
+#include "MetadataStore.h"
 
 #include "sdk/Job.h"
 #include "sdk/Logger.h"
+#include "sdk/Metrics.h"
+#include "sdk/PathRegistry.h"
 #include "sdk/ThreadPool.h"
+#include "sdk/Utils.h"
 #include "sdk/vdb/grpc/kuksa_val_v2/BrokerAsyncGrpcFacade.h"
 
+#include <fmt/core.h>
+
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <limits>
+#include <optional>
 #include <set>
 #include <shared_mutex>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace velocitas::kuksa_val_v2 {
 
 namespace {
 
-const unsigned int MAX_PARALLEL_REQUESTS{5};
+// The number of ListMetadata requests in flight adapts to the databroker's responsiveness: Starting
+// with INITIAL_REQUEST_WINDOW, each successful request widens the window by one (i.e. it doubles
+// per round trip) up to the configured maximum, each failed request halves it.
+const size_t INITIAL_REQUEST_WINDOW{5};
+const size_t DEFAULT_MAX_REQUEST_WINDOW{64};
+
+size_t determineMaxRequestWindow() {
+    size_t maxWindow = DEFAULT_MAX_REQUEST_WINDOW;
+    try {
+        auto maxWindowStr = getEnvVar("SDV_METADATA_MAX_PARALLEL_REQUESTS");
+        if (!maxWindowStr.empty()) {
+            auto value = std::stoi(maxWindowStr);
+            if (value <= 0) {
+                throw std::out_of_range("non-positive number of requests");
+            }
+            maxWindow = static_cast<size_t>(value);
+        }
+    } catch (...) {
+        logger().error("Invalid max. number of parallel metadata requests specified via env var! "
+                       "Using default ({}).",
+                       maxWindow);
+    }
+    return maxWindow;
+}
+
+size_t getMaxRequestWindow() {
+    static const size_t maxWindow = determineMaxRequestWindow();
+    return maxWindow;
+}
 
 class Request {
 public:
@@ -47,26 +86,29 @@ public:
         return request;
     }
 
+    /**
+     * @brief Send the request to the databroker. Must not be called with the agent's mutex held,
+     * as the callbacks might be invoked from within this call.
+     */
     void initiate(const std::shared_ptr<BrokerAsyncGrpcFacade>& brokerFacade) {
-        ThreadPool::getInstance()->enqueue(Job::create([thisPtr = getThisPtr(), brokerFacade]() {
-            // !! Capturing a shared_ptr to this Request object (i.e. thisPtr) within this lambda
-            // guarantees that this object is not destructed before the lambda is left, means
-            // destruction happens outside any function of this class.
-            if (thisPtr->m_isCancelled) {
-                thisPtr->onError(grpc::Status(grpc::StatusCode::CANCELLED, ""));
-            } else {
-                kuksa::val::v2::ListMetadataRequest request;
-                request.set_root(thisPtr->m_signalPath);
-                brokerFacade->ListMetadata(
-                    std::move(request),
-                    [thisPtr](const auto& response) {
-                        thisPtr->onResponse(std::forward<decltype(response)>(response));
-                    },
-                    [thisPtr](const auto& status) {
-                        thisPtr->onError(std::forward<decltype(status)>(status));
-                    });
-            }
-        }));
+        // !! Capturing a shared_ptr to this Request object (i.e. thisPtr) within the callbacks
+        // guarantees that this object is not destructed before they are left, means destruction
+        // happens outside any function of this class.
+        auto thisPtr = getThisPtr();
+        if (m_isCancelled) {
+            thisPtr->onError(grpc::Status(grpc::StatusCode::CANCELLED, ""));
+            return;
+        }
+        kuksa::val::v2::ListMetadataRequest request;
+        request.set_root(m_signalPath);
+        brokerFacade->ListMetadata(
+            std::move(request),
+            [thisPtr](const auto& response) {
+                thisPtr->onResponse(std::forward<decltype(response)>(response));
+            },
+            [thisPtr](const auto& status) {
+                thisPtr->onError(std::forward<decltype(status)>(status));
+            });
     }
 
     void                             cancel() { m_isCancelled = true; }
@@ -133,7 +175,7 @@ class MetadataCache {
 public:
     void add(const MetadataPtr_t& metadata) {
         assert(metadata);
-        m_pathMap[metadata->m_signalPath] = metadata;
+        m_pathMap[PathRegistry::getInstance().intern(metadata->m_signalPath)] = metadata;
         if (metadata->m_isKnown) {
             m_idMap[metadata->m_id] = metadata;
         }
@@ -144,12 +186,27 @@ public:
         m_idMap.clear();
     }
 
+    void removePreloaded() {
+        removePreloaded(m_pathMap);
+        removePreloaded(m_idMap);
+    }
+
+    [[nodiscard]] MetadataList_t getAllKnown() const {
+        MetadataList_t metadataList;
+        metadataList.reserve(m_idMap.size());
+        for (const auto& [id, metadata] : m_idMap) {
+            metadataList.push_back(metadata);
+        }
+        return metadataList;
+    }
+
     [[nodiscard]] bool isPresent(const std::string& signalPath) const {
-        return (m_pathMap.find(signalPath) != m_pathMap.cend());
+        return getByPath(signalPath) != nullptr;
     }
 
     [[nodiscard]] MetadataPtr_t getByPath(const std::string& signalPath) const {
-        if (auto metadata = m_pathMap.find(signalPath); metadata != m_pathMap.end()) {
+        const auto pathId = PathRegistry::getInstance().find(signalPath);
+        if (auto metadata = m_pathMap.find(pathId); metadata != m_pathMap.end()) {
             return metadata->second;
         }
         return {};
@@ -163,8 +220,15 @@ public:
     }
 
 private:
-    std::map<std::string, MetadataPtr_t>  m_pathMap;
-    std::map<numeric_id_t, MetadataPtr_t> m_idMap;
+    template <typename TMap> static void removePreloaded(TMap& map) {
+        for (auto iter = map.begin(); iter != map.end();) {
+            iter = iter->second->m_isPreloaded ? map.erase(iter) : std::next(iter);
+        }
+    }
+
+    // Keyed by the id of the interned signal path, not by the path string itself
+    std::unordered_map<PathId_t, MetadataPtr_t>     m_pathMap;
+    std::unordered_map<numeric_id_t, MetadataPtr_t> m_idMap;
 };
 
 class Query {
@@ -184,7 +248,32 @@ public:
             m_cachedMetadata.push_back(metadata);
         }
     }
+    /**
+     * @brief Remove all metadata read from the persistent cache, marking the affected signals as
+     * missing again.
+     *
+     * @return std::set<std::string> The affected signals.
+     */
+    std::set<std::string> discardPreloadedMetadata() {
+        std::set<std::string> discardedSignals;
+        auto                  iter = m_cachedMetadata.begin();
+        while (iter != m_cachedMetadata.end()) {
+            if ((*iter)->m_isPreloaded) {
+                discardedSignals.insert((*iter)->m_signalPath);
+                iter = m_cachedMetadata.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+        m_missingSignals.insert(discardedSignals.cbegin(), discardedSignals.cend());
+        return discardedSignals;
+    }
+
     [[nodiscard]] bool isFulfilled() const { return m_missingSignals.empty(); }
+    [[nodiscard]] bool hasPreloadedMetadata() const {
+        return std::any_of(m_cachedMetadata.cbegin(), m_cachedMetadata.cend(),
+                           [](const auto& metadata) { return metadata->m_isPreloaded; });
+    }
     [[nodiscard]] const std::set<std::string>& getMissingSignals() const {
         return m_missingSignals;
     }
@@ -231,45 +320,236 @@ void notifyQueryInitiators(std::deque<Query>&& queries, const grpc::Status& stat
 
 } // namespace
 
-class MetadataAgentImpl : public MetadataAgent {
+class MetadataAgentImpl : public MetadataAgent,
+                          public std::enable_shared_from_this<MetadataAgentImpl> {
 public:
-    explicit MetadataAgentImpl(std::shared_ptr<BrokerAsyncGrpcFacade> asyncBrokerFacade)
-        : m_asyncBrokerFacade(std::move(asyncBrokerFacade)) {}
+    MetadataAgentImpl(std::shared_ptr<BrokerAsyncGrpcFacade> asyncBrokerFacade,
+                      std::string                            brokerIdentity,
+                      std::optional<MetadataStore>           store)
+        : m_asyncBrokerFacade(std::move(asyncBrokerFacade))
+        , m_store(std::move(store)) {
+        m_persistedMetadata.m_brokerIdentity = std::move(brokerIdentity);
+        if (m_store) {
+            loadPersistedMetadata();
+        }
+    }
 
     void query(const SignalPathList_t&                    signalPaths,
                std::function<void(MetadataList_t&&)>&&    onSuccess,
                std::function<void(const grpc::Status&)>&& onError) override;
     void invalidate(grpc::StatusCode statusCode) override;
+    void invalidateIfCurrent(uint64_t generation, grpc::StatusCode statusCode) override;
+    void discardPreloadedIfCurrent(uint64_t generation) override;
 
     [[nodiscard]] MetadataPtr_t getByNumericId(numeric_id_t numericId) const override {
         std::shared_lock lock(m_mutex);
         return m_cache.getById(numericId);
     }
 
+    [[nodiscard]] uint64_t getGeneration() const override { return m_generation; }
+
 private:
     void              addCachedMetadata(Query& query, const SignalPathList_t& signalPaths);
     void              addQuery(Query&& query);
     void              addSetOfSignalToRequestQueue(const std::set<std::string>& signals);
     void              addSignalToRequestQueue(const std::string& signalPath);
-    bool              isSignalPartOfActiveRequests(const std::string& signalPath) const;
     void              triggerMetadataRequests();
-    void              updateActiveRequests(const std::shared_ptr<Request>& request);
+    void              updateActiveRequests(const std::shared_ptr<Request>& request, bool isSuccess);
     std::deque<Query> updateQueriesAndExtractFulfilled(const MetadataPtr_t& metadata);
+    std::deque<Query> extractFulfilledQueries();
+    [[nodiscard]] bool isReadyToNotify(const Query& query) const;
     std::deque<Query> extractAffectedQueries(const std::string& signalPath);
     void              cancelActiveRequests();
+    std::deque<Query> invalidateCache();
+
+    enum class ValidationState { NOT_REQUESTED, REQUESTED, VALIDATED };
+
+    void                             loadPersistedMetadata();
+    void                             preloadPersistedMetadata();
+    bool                             markValidationRequested();
+    void                             requestServerInfo();
+    void                             onServerInfo(const std::string& version, uint64_t generation);
+    void                             onServerInfoFailed(uint64_t generation);
+    void                             discardPreloadedMetadata();
+    void                             resetPersistedIds();
+    void                             recordForPersistence(const Metadata& metadata);
+    std::optional<PersistedMetadata> extractSnapshotToSave();
+    void                             saveSnapshot(std::optional<PersistedMetadata>&& snapshot);
 
     std::shared_ptr<BrokerAsyncGrpcFacade> m_asyncBrokerFacade;
+    std::optional<MetadataStore>           m_store;
 
     mutable std::shared_mutex          m_mutex;
     MetadataCache                      m_cache;
     std::deque<Query>                  m_pendingQueries;
     std::deque<std::string>            m_pendingSignals;
+    // Signals either pending or part of an active request
+    std::unordered_set<std::string>    m_requestedSignals;
     std::set<std::shared_ptr<Request>> m_activeRequests;
+    size_t                             m_requestWindow{INITIAL_REQUEST_WINDOW};
+    std::atomic<uint64_t>              m_generation{0};
+    // Mirrors the content of the persistent cache (if configured)
+    PersistedMetadata m_persistedMetadata;
+    bool              m_isPersistedMetadataDirty{false};
+    uint64_t          m_lastSnapshotRevision{0};
+    ValidationState   m_validationState{ValidationState::NOT_REQUESTED};
 };
 
 std::shared_ptr<MetadataAgent>
-MetadataAgent::create(const std::shared_ptr<BrokerAsyncGrpcFacade>& brokerFacade) {
-    return std::make_shared<MetadataAgentImpl>(brokerFacade);
+MetadataAgent::create(const std::shared_ptr<BrokerAsyncGrpcFacade>& brokerFacade,
+                      const std::string&                            brokerIdentity) {
+    return std::make_shared<MetadataAgentImpl>(brokerFacade, brokerIdentity,
+                                               MetadataStore::createFromEnvironment());
+}
+
+void MetadataAgentImpl::loadPersistedMetadata() {
+    auto persistedMetadata = m_store->load();
+    if (!persistedMetadata) {
+        return;
+    }
+    if (persistedMetadata->m_brokerIdentity != m_persistedMetadata.m_brokerIdentity) {
+        logger().info("Metadata cache '{}' refers to another databroker -> ignored",
+                      m_store->getFilePath());
+        return;
+    }
+    m_persistedMetadata = std::move(*persistedMetadata);
+    preloadPersistedMetadata();
+    logger().info("Preloaded ids of {} signals from metadata cache '{}'",
+                  m_persistedMetadata.m_idsByPath.size(), m_store->getFilePath());
+}
+
+void MetadataAgentImpl::preloadPersistedMetadata() {
+    for (const auto& [path, id] : m_persistedMetadata.m_idsByPath) {
+        m_cache.add(std::make_shared<Metadata>(Metadata{path, id, true, true}));
+    }
+}
+
+bool MetadataAgentImpl::markValidationRequested() {
+    if (!m_store || m_validationState != ValidationState::NOT_REQUESTED) {
+        return false;
+    }
+    m_validationState = ValidationState::REQUESTED;
+    return true;
+}
+
+void MetadataAgentImpl::requestServerInfo() {
+    const auto generation = getGeneration();
+    // The queries might be answered from the cache before, hence the agent may be gone already
+    // once the validation completes
+    m_asyncBrokerFacade->GetServerInfo(
+        kuksa::val::v2::GetServerInfoRequest{},
+        [weakSelf = weak_from_this(), generation](const auto& info) {
+            if (auto self = weakSelf.lock()) {
+                self->onServerInfo(
+                    fmt::format("{} {} {}", info.name(), info.version(), info.commit_hash()),
+                    generation);
+            }
+        },
+        [weakSelf = weak_from_this(), generation](const auto& status) {
+            logger().warn("Cannot validate metadata cache: GetServerInfo failed: code={}, {}",
+                          static_cast<unsigned int>(status.error_code()), status.error_message());
+            if (auto self = weakSelf.lock()) {
+                self->onServerInfoFailed(generation);
+            }
+        });
+}
+
+void MetadataAgentImpl::onServerInfoFailed(uint64_t generation) {
+    std::deque<Query> fulfilledQueries;
+    {
+        std::unique_lock lock(m_mutex);
+        if (generation != m_generation) {
+            return;
+        }
+        // Unvalidated ids must not be used, hence resolve the signals from scratch. Validation is
+        // retried with the next query.
+        m_validationState = ValidationState::NOT_REQUESTED;
+        discardPreloadedMetadata();
+        fulfilledQueries = extractFulfilledQueries();
+    }
+    notifyQueryInitiators(std::move(fulfilledQueries));
+}
+
+void MetadataAgentImpl::onServerInfo(const std::string& version, uint64_t generation) {
+    std::deque<Query>                fulfilledQueries;
+    std::optional<PersistedMetadata> snapshot;
+    {
+        std::unique_lock lock(m_mutex);
+        if (generation != m_generation) {
+            // the cache got invalidated meanwhile, the next query triggers a new validation
+            return;
+        }
+        m_validationState = ValidationState::VALIDATED;
+        if (version != m_persistedMetadata.m_serverVersion) {
+            if (!m_persistedMetadata.m_idsByPath.empty()) {
+                logger().info("Metadata cache refers to another databroker version -> discarded");
+                discardPreloadedMetadata();
+            }
+            m_persistedMetadata.m_serverVersion = version;
+            resetPersistedIds();
+        }
+        // Queries held back because of preloaded ids can be answered now
+        fulfilledQueries = extractFulfilledQueries();
+        snapshot         = extractSnapshotToSave();
+    }
+    saveSnapshot(std::move(snapshot));
+    notifyQueryInitiators(std::move(fulfilledQueries));
+}
+
+void MetadataAgentImpl::discardPreloadedMetadata() {
+    // Preloaded ids are never handed out before being validated, hence the generation stays: All
+    // ids handed out so far were resolved by the databroker itself.
+    m_cache.removePreloaded();
+    for (auto& query : m_pendingQueries) {
+        addSetOfSignalToRequestQueue(query.discardPreloadedMetadata());
+    }
+    triggerMetadataRequests();
+}
+
+void MetadataAgentImpl::resetPersistedIds() {
+    m_persistedMetadata.m_idsByPath.clear();
+    for (const auto& metadata : m_cache.getAllKnown()) {
+        m_persistedMetadata.m_idsByPath.emplace(metadata->m_signalPath, metadata->m_id);
+    }
+    m_isPersistedMetadataDirty = true;
+}
+
+void MetadataAgentImpl::recordForPersistence(const Metadata& metadata) {
+    if (!m_store) {
+        return;
+    }
+    auto& idsByPath = m_persistedMetadata.m_idsByPath;
+    if (metadata.m_isKnown) {
+        auto [iter, isInserted] = idsByPath.emplace(metadata.m_signalPath, metadata.m_id);
+        if (isInserted || iter->second != metadata.m_id) {
+            iter->second               = metadata.m_id;
+            m_isPersistedMetadataDirty = true;
+        }
+    } else if (idsByPath.erase(metadata.m_signalPath) > 0) {
+        m_isPersistedMetadataDirty = true;
+    }
+}
+
+std::optional<PersistedMetadata> MetadataAgentImpl::extractSnapshotToSave() {
+    // Saving is deferred until all outstanding requests are answered, avoiding a write per signal
+    if (!m_isPersistedMetadataDirty || m_validationState != ValidationState::VALIDATED ||
+        !m_pendingSignals.empty() || !m_activeRequests.empty()) {
+        return std::nullopt;
+    }
+    m_isPersistedMetadataDirty = false;
+    auto snapshot              = m_persistedMetadata;
+    snapshot.m_revision        = ++m_lastSnapshotRevision;
+    return snapshot;
+}
+
+void MetadataAgentImpl::saveSnapshot(std::optional<PersistedMetadata>&& snapshot) {
+    if (!snapshot) {
+        return;
+    }
+    ThreadPool::getInstance(executors::SDK_INTERNAL)
+        ->enqueue(Job::create([store = *m_store, snapshot = std::move(*snapshot)]() {
+            store.save(snapshot);
+        }));
 }
 
 void MetadataAgentImpl::cancelActiveRequests() {
@@ -278,40 +558,103 @@ void MetadataAgentImpl::cancelActiveRequests() {
     }
 }
 
+void MetadataAgentImpl::discardPreloadedIfCurrent(uint64_t generation) {
+    std::optional<PersistedMetadata> snapshot;
+    {
+        std::unique_lock lock(m_mutex);
+        if (generation != m_generation) {
+            return;
+        }
+        logger().info("Databroker rejected ids of metadata cache -> discarded");
+        // Unlike after a version mismatch, the preloaded ids were handed out already
+        ++m_generation;
+        discardPreloadedMetadata();
+        // Only persist ids resolved by the databroker, so the rejected ones are not preloaded again
+        resetPersistedIds();
+        snapshot = extractSnapshotToSave();
+    }
+    saveSnapshot(std::move(snapshot));
+}
+
 void MetadataAgentImpl::invalidate(grpc::StatusCode statusCode) {
-    logger().info("Invalidating signal metadata cache");
     std::deque<Query> openQueries;
     {
         std::unique_lock lock(m_mutex);
-        m_cache.clear();
-        m_pendingQueries.swap(openQueries);
-        m_pendingSignals.clear();
-        cancelActiveRequests();
+        openQueries = invalidateCache();
+    }
+    notifyQueryInitiators(std::move(openQueries), grpc::Status(statusCode, "Cache invalidation"));
+}
+
+void MetadataAgentImpl::invalidateIfCurrent(uint64_t generation, grpc::StatusCode statusCode) {
+    std::deque<Query> openQueries;
+    {
+        std::unique_lock lock(m_mutex);
+        if (generation != m_generation) {
+            return;
+        }
+        openQueries = invalidateCache();
     }
     notifyQueryInitiators(std::move(openQueries), grpc::Status(statusCode, "Cache invalidation"));
 }
 
+std::deque<Query> MetadataAgentImpl::invalidateCache() {
+    logger().info("Invalidating signal metadata cache");
+    ++m_generation;
+    m_cache.clear();
+    if (m_store) {
+        // The databroker probably got restarted. As long as its version stays the same, the
+        // persisted ids remain valid.
+        preloadPersistedMetadata();
+        m_validationState = ValidationState::NOT_REQUESTED;
+    }
+    std::deque<Query> openQueries;
+    m_pendingQueries.swap(openQueries);
+    m_pendingSignals.clear();
+    m_requestedSignals.clear();
+    cancelActiveRequests();
+    return openQueries;
+}
+
 void MetadataAgentImpl::addCachedMetadata(Query& query, const SignalPathList_t& signalPaths) {
+    static auto& cacheHits = MetricsRegistry::getInstance().getCounter(
+        "sdv_vdb_metadata_cache_hits_total",
+        "Number of signal metadata lookups served by the cache");
+    static auto& cacheMisses = MetricsRegistry::getInstance().getCounter(
+        "sdv_vdb_metadata_cache_misses_total",
+        "Number of signal metadata lookups requiring a request to the databroker");
+
+    size_t numHits = 0;
     for (const auto& path : signalPaths) {
         if (auto metadata = m_cache.getByPath(path)) {
             query.addMetadata(metadata);
+            ++numHits;
         }
     }
+    cacheHits.increment(numHits);
+    cacheMisses.increment(signalPaths.size() - numHits);
 }
 
 void MetadataAgentImpl::query(const SignalPathList_t&                    signalPaths,
                               std::function<void(MetadataList_t&&)>&&    onSuccess,
                               std::function<void(const grpc::Status&)>&& onError) {
     Query query(signalPaths, std::move(onSuccess), std::move(onError));
+    bool  isFulfilled     = false;
+    bool  isValidationDue = false;
     {
         std::unique_lock lock(m_mutex);
+        isValidationDue = markValidationRequested();
         addCachedMetadata(query, signalPaths);
-        if (!query.isFulfilled()) {
+        isFulfilled = isReadyToNotify(query);
+        if (!isFulfilled) {
             addQuery(std::move(query));
-            return;
         }
     }
-    query.notifyInitiator();
+    if (isValidationDue) {
+        requestServerInfo();
+    }
+    if (isFulfilled) {
+        query.notifyInitiator();
+    }
 }
 
 void MetadataAgentImpl::addQuery(Query&& query) {
@@ -320,16 +663,8 @@ void MetadataAgentImpl::addQuery(Query&& query) {
     triggerMetadataRequests();
 }
 
-bool MetadataAgentImpl::isSignalPartOfActiveRequests(const std::string& signalPath) const {
-    return std::any_of(
-        m_activeRequests.cbegin(), m_activeRequests.cend(),
-        [signalPath](const auto& request) { return signalPath == request->getSignalPath(); });
-}
-
 void MetadataAgentImpl::addSignalToRequestQueue(const std::string& signalPath) {
-    if (!isSignalPartOfActiveRequests(signalPath) &&
-        (std::find(m_pendingSignals.cbegin(), m_pendingSignals.cend(), signalPath) ==
-         m_pendingSignals.end())) {
+    if (m_requestedSignals.insert(signalPath).second) {
         m_pendingSignals.push_back(signalPath);
     }
 }
@@ -341,20 +676,25 @@ void MetadataAgentImpl::addSetOfSignalToRequestQueue(const std::set<std::string>
 }
 
 void MetadataAgentImpl::triggerMetadataRequests() {
-    while (!m_pendingSignals.empty() && (m_activeRequests.size() < MAX_PARALLEL_REQUESTS)) {
+    std::vector<std::shared_ptr<Request>> newRequests;
+    while (!m_pendingSignals.empty() && (m_activeRequests.size() < m_requestWindow)) {
         auto request = Request::create(
             m_pendingSignals.front(),
             [this](const auto& request, const auto& metadata) {
                 assert(request && metadata);
-                std::deque<Query> fulfilledQueries;
+                std::deque<Query>                fulfilledQueries;
+                std::optional<PersistedMetadata> snapshot;
                 {
                     std::unique_lock lock(m_mutex);
-                    updateActiveRequests(request);
+                    updateActiveRequests(request, true);
                     if (!request->isCancelled()) {
                         m_cache.add(metadata);
+                        recordForPersistence(*metadata);
                         fulfilledQueries = updateQueriesAndExtractFulfilled(metadata);
+                        snapshot         = extractSnapshotToSave();
                     }
                 }
+                saveSnapshot(std::move(snapshot));
                 notifyQueryInitiators(std::move(fulfilledQueries));
             },
             [this](const auto& request, const auto& status) {
@@ -362,7 +702,7 @@ void MetadataAgentImpl::triggerMetadataRequests() {
                 std::deque<Query> affectedQueries;
                 {
                     std::unique_lock lock(m_mutex);
-                    updateActiveRequests(request);
+                    updateActiveRequests(request, false);
                     if (!request->isCancelled()) {
                         affectedQueries = extractAffectedQueries(request->getSignalPath());
                     }
@@ -371,23 +711,49 @@ void MetadataAgentImpl::triggerMetadataRequests() {
             });
         m_pendingSignals.pop_front();
         m_activeRequests.insert(request);
-        request->initiate(m_asyncBrokerFacade);
+        newRequests.push_back(std::move(request));
+    }
+
+    if (!newRequests.empty()) {
+        // A single job initiates all new requests outside the lock of the caller
+        ThreadPool::getInstance(executors::SDK_INTERNAL)
+            ->enqueue(Job::create([requests = std::move(newRequests),
+                                   brokerFacade = m_asyncBrokerFacade]() {
+                for (const auto& request : requests) {
+                    request->initiate(brokerFacade);
+                }
+            }));
     }
 }
 
-void MetadataAgentImpl::updateActiveRequests(const std::shared_ptr<Request>& request) {
+void MetadataAgentImpl::updateActiveRequests(const std::shared_ptr<Request>& request,
+                                             bool                            isSuccess) {
     size_t numErasedRequests = m_activeRequests.erase(request);
     assert(numErasedRequests == 1);
+    if (!request->isCancelled()) {
+        m_requestedSignals.erase(request->getSignalPath());
+        if (isSuccess) {
+            m_requestWindow = std::min(m_requestWindow + 1, getMaxRequestWindow());
+        } else {
+            m_requestWindow = std::max(m_requestWindow / 2, size_t{1});
+        }
+    }
     triggerMetadataRequests();
 }
 
 std::deque<Query>
 MetadataAgentImpl::updateQueriesAndExtractFulfilled(const MetadataPtr_t& metadata) {
+    for (auto& query : m_pendingQueries) {
+        query.addMetadata(metadata);
+    }
+    return extractFulfilledQueries();
+}
+
+std::deque<Query> MetadataAgentImpl::extractFulfilledQueries() {
     std::deque<Query> fulfilledQueries;
     auto              queryIter = m_pendingQueries.begin();
     while (queryIter != m_pendingQueries.end()) {
-        queryIter->addMetadata(metadata);
-        if (queryIter->isFulfilled()) {
+        if (isReadyToNotify(*queryIter)) {
             fulfilledQueries.push_back(std::move(*queryIter));
             queryIter = m_pendingQueries.erase(queryIter);
         } else {
@@ -397,6 +763,13 @@ MetadataAgentImpl::updateQueriesAndExtractFulfilled(const MetadataPtr_t& metadat
     return fulfilledQueries;
 }
 
+bool MetadataAgentImpl::isReadyToNotify(const Query& query) const {
+    // Preloaded ids are held back until validated: The databroker would apply writes or return
+    // values addressed by an outdated id to whatever signal carries that id now.
+    return query.isFulfilled() &&
+           (m_validationState == ValidationState::VALIDATED || !query.hasPreloadedMetadata());
+}
+
 std::deque<Query> MetadataAgentImpl::extractAffectedQueries(const std::string& signalPath) {
     std::deque<Query> affectedQueries;
     auto              queryIter = m_pendingQueries.begin();
@@ -38,6 +38,8 @@ struct Metadata {
     std::string  m_signalPath;
     numeric_id_t m_id{0};
     bool         m_isKnown{false};
+    /** Read from the persistent metadata cache instead of being provided by the databroker */
+    bool m_isPreloaded{false};
 };
 
 using MetadataPtr_t  = std::shared_ptr<Metadata>;
@@ -54,7 +56,21 @@ class BrokerAsyncGrpcFacade;
  */
 class MetadataAgent {
 public:
-    static std::shared_ptr<MetadataAgent> create(const std::shared_ptr<BrokerAsyncGrpcFacade>&);
+    /**
+     * @brief Create a metadata agent.
+     *
+     * If a persistent metadata cache is configured via environment variable
+     * SDV_METADATA_CACHE_PATH, the agent preloads the numeric ids stored there for the passed
+     * broker identity. They are validated against the version reported by the databroker with the
+     * first query, which is answered once validated. The preloaded ids get discarded if the
+     * version does not match or cannot be determined.
+     *
+     * @param brokerFacade    Facade used to access the databroker.
+     * @param brokerIdentity  Identifies the databroker within the persistent cache, e.g. its
+     *                        address.
+     */
+    static std::shared_ptr<MetadataAgent> create(const std::shared_ptr<BrokerAsyncGrpcFacade>&,
+                                                 const std::string& brokerIdentity = "");
     virtual ~MetadataAgent() = default;
 
     /**
@@ -80,6 +96,28 @@ public:
      */
     virtual void invalidate(grpc::StatusCode statusCode = grpc::StatusCode::UNAVAILABLE) = 0;
 
+    /**
+     * @brief Invalidates the cached metadata unless it was invalidated since the passed
+     * generation. Lets several clients failing at once due to the same loss of the databroker
+     * invalidate the cache only once.
+     *
+     * @param generation  Generation the caller got its numeric ids from.
+     * @param statusCode
+     */
+    virtual void
+    invalidateIfCurrent(uint64_t         generation,
+                        grpc::StatusCode statusCode = grpc::StatusCode::UNAVAILABLE) = 0;
+
+    /**
+     * @brief Discards the numeric ids preloaded from the persistent metadata cache unless the
+     * cache was invalidated since the passed generation, and resolves them again. This needs to be
+     * called by clients when the databroker rejects a preloaded id although its version matched.
+     * The discarded ids are removed from the persistent cache as well.
+     *
+     * @param generation  Generation the caller got its numeric ids from.
+     */
+    virtual void discardPreloadedIfCurrent(uint64_t generation) = 0;
+
     /**
      * @brief Get metadata of a signal reference by its numeric id.
      *
@@ -89,6 +127,15 @@ public:
      * nullptr is returned if the passed id is unknown.
      */
     [[nodiscard]] virtual MetadataPtr_t getByNumericId(numeric_id_t mumericId) const = 0;
+
+    /**
+     * @brief Get the generation of the cached metadata. The generation changes with each
+     * invalidation of the cache, i.e. numeric ids obtained within an older generation may be
+     * outdated.
+     *
+     * @return uint64_t The current generation.
+     */
+    [[nodiscard]] virtual uint64_t getGeneration() const = 0;
 };
 
 } // namespace velocitas::kuksa_val_v2
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "MetadataStore.h"
+
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace velocitas::kuksa_val_v2 {
+
+namespace {
+
+// File layout (line based):
+//   <FILE_HEADER>
+//   <broker identity>
+//   <server version>
+//   <numeric id> <signal path>   (one line per known signal)
+constexpr char const* FILE_HEADER = "velocitas-metadata-cache 1";
+
+/**
+ * @brief Write the passed content to a new, uniquely named file next to the passed one.
+ *
+ * @return The path of the written file or std::nullopt if it cannot be written.
+ */
+std::optional<std::string> writeTempFile(const std::string& filePath, const std::string& content) {
+    auto templatePath = filePath + ".XXXXXX";
+    // mkstemp replaces the placeholder in place, hence needs a writable buffer
+    std::vector<char> pathBuffer(templatePath.cbegin(), templatePath.cend());
+    pathBuffer.push_back('\0');
+    const int fileDescriptor = mkstemp(pathBuffer.data());
+    if (fileDescriptor < 0) {
+        return std::nullopt;
+    }
+    std::string tempFilePath(pathBuffer.data());
+
+    size_t written = 0;
+    while (written < content.size()) {
+        const auto result =
+            write(fileDescriptor, content.data() + written, content.size() - written);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result < 0) {
+            break;
+        }
+        written += static_cast<size_t>(result);
+    }
+    if ((close(fileDescriptor) != 0) || (written < content.size())) {
+        std::remove(tempFilePath.c_str());
+        return std::nullopt;
+    }
+    return tempFilePath;
+}
+
+} // namespace
+
+MetadataStore::MetadataStore(std::string filePath)
+    : m_filePath(std::move(filePath))
+    , m_saveState(std::make_shared<SaveState>()) {}
+
+std::optional<MetadataStore> MetadataStore::createFromEnvironment() {
+    auto filePath = getEnvVar("SDV_METADATA_CACHE_PATH");
+    if (filePath.empty()) {
+        return std::nullopt;
+    }
+    return MetadataStore(std::move(filePath));
+}
+
+std::optional<PersistedMetadata> MetadataStore::load() const {
+    std::ifstream file(m_filePath);
+    if (!file) {
+        return std::nullopt;
+    }
+
+    PersistedMetadata metadata;
+    std::string       line;
+    if (!std::getline(file, line) || line != FILE_HEADER ||
+        !std::getline(file, metadata.m_brokerIdentity) ||
+        !std::getline(file, metadata.m_serverVersion)) {
+        logger().warn("Ignoring malformed metadata cache file '{}'", m_filePath);
+        return std::nullopt;
+    }
+
+    while (std::getline(file, line)) {
+        const auto separator = line.find(' ');
+        try {
+            if (separator == std::string::npos || separator + 1 == line.size()) {
+                throw std::invalid_argument("missing signal path");
+            }
+            const auto id = static_cast<numeric_id_t>(std::stol(line.substr(0, separator)));
+            metadata.m_idsByPath.emplace(line.substr(separator + 1), id);
+        } catch (const std::exception&) {
+            logger().warn("Ignoring malformed metadata cache file '{}'", m_filePath);
+            return std::nullopt;
+        }
+    }
+    return metadata;
+}
+
+bool MetadataStore::save(const PersistedMetadata& metadata) const {
+    std::ostringstream content;
+    content << FILE_HEADER << '\n'
+            << metadata.m_brokerIdentity << '\n'
+            << metadata.m_serverVersion << '\n';
+    for (const auto& [path, id] : metadata.m_idsByPath) {
+        content << id << ' ' << path << '\n';
+    }
+
+    // Saves may run concurrently on several workers, an older snapshot must not replace a newer one
+    std::lock_guard lock(m_saveState->m_mutex);
+    if (metadata.m_revision < m_saveState->m_lastSavedRevision) {
+        logger().debug("Skipping outdated metadata snapshot of revision {}", metadata.m_revision);
+        return true;
+    }
+
+    // Write to a temporary file first, so that readers never see a partially written file
+    const auto tempFilePath = writeTempFile(m_filePath, content.str());
+    if (!tempFilePath) {
+        logger().warn("Cannot write temporary file for metadata cache file '{}'", m_filePath);
+        return false;
+    }
+    if (std::rename(tempFilePath->c_str(), m_filePath.c_str()) != 0) {
+        logger().warn("Cannot replace metadata cache file '{}'", m_filePath);
+        std::remove(tempFilePath->c_str());
+        return false;
+    }
+    m_saveState->m_lastSavedRevision = metadata.m_revision;
+    return true;
+}
+
+} // namespace velocitas::kuksa_val_v2
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_METADATASTORE_H
+#define VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_METADATASTORE_H
+
+#include "Metadata.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace velocitas::kuksa_val_v2 {
+
+/**
+ * @brief Snapshot of the numeric ids assigned by one specific databroker.
+ */
+struct PersistedMetadata {
+    /** Identifies the databroker instance, e.g. its address */
+    std::string m_brokerIdentity;
+    /** Name, version and commit hash as reported by GetServerInfo */
+    std::string m_serverVersion;
+    /** Numeric ids of all known signals, keyed by signal path */
+    std::unordered_map<std::string, numeric_id_t> m_idsByPath;
+    /** Orders the snapshots taken within the process, a newer snapshot has a higher revision.
+     *  Not persisted. */
+    uint64_t m_revision{0};
+};
+
+/**
+ * @brief Stores a PersistedMetadata snapshot in a file, allowing to reuse the numeric ids of the
+ *        signals across restarts of the application.
+ *
+ *        Copies of a store share their state, i.e. saving via any of them is serialized and a
+ *        snapshot never replaces one of a higher revision saved before.
+ */
+class MetadataStore {
+public:
+    /**
+     * @brief Construct a new metadata store.
+     *
+     * @param filePath  Path of the cache file.
+     */
+    explicit MetadataStore(std::string filePath);
+
+    /**
+     * @brief Create the store configured via environment variable SDV_METADATA_CACHE_PATH.
+     *
+     * @return std::optional<MetadataStore>  The store or std::nullopt if persisting the metadata
+     * is not configured.
+     */
+    static std::optional<MetadataStore> createFromEnvironment();
+
+    /**
+     * @brief Read the snapshot from the cache file.
+     *
+     * @return std::optional<PersistedMetadata>  The snapshot or std::nullopt if the file does not
+     * exist or is malformed.
+     */
+    [[nodiscard]] std::optional<PersistedMetadata> load() const;
+
+    /**
+     * @brief Write the passed snapshot to the cache file, replacing its former content atomically.
+     *        The snapshot is skipped if one of a higher revision was saved before.
+     *
+     * @param metadata  Snapshot to write.
+     * @return true if the snapshot was written or skipped, false otherwise.
+     */
+    bool save(const PersistedMetadata& metadata) const;
+
+    [[nodiscard]] const std::string& getFilePath() const { return m_filePath; }
+
+private:
+    struct SaveState {
+        std::mutex m_mutex;
+        uint64_t   m_lastSavedRevision{0};
+    };
+
+    std::string                m_filePath;
+    std::shared_ptr<SaveState> m_saveState;
+};
+
+} // namespace velocitas::kuksa_val_v2
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_METADATASTORE_H
@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ResolvedSignalSet.h"
+
+#include <grpcpp/support/status.h>
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace velocitas::kuksa_val_v2 {
+
+namespace {
+
+// A slot table is used as long as it is at most this factor larger than the number of signals
+constexpr size_t MAX_SLOT_TABLE_SPREAD{16};
+// ... or at most this size
+constexpr size_t MIN_SLOT_TABLE_SIZE{256};
+
+} // namespace
+
+SignalSetResolution::Handle_t SignalSetResolution::findSlot(numeric_id_t id) const {
+    if (!m_slotTable.empty()) {
+        // unsigned arithmetic also maps ids below m_minId out of range
+        const auto index = static_cast<size_t>(static_cast<int64_t>(id) - m_minId);
+        return index < m_slotTable.size() ? m_slotTable[index] : DataPointLayout::INVALID_HANDLE;
+    }
+    auto iter = std::lower_bound(
+        m_sortedSlots.cbegin(), m_sortedSlots.cend(), id,
+        [](const auto& entry, numeric_id_t value) { return entry.first < value; });
+    if (iter != m_sortedSlots.cend() && iter->first == id) {
+        return iter->second;
+    }
+    return DataPointLayout::INVALID_HANDLE;
+}
+
+ResolvedSignalSet::ResolvedSignalSet(std::vector<std::string>       signalPaths,
+                                     std::shared_ptr<MetadataAgent> metadataAgent)
+    : PreparedSignalSet(std::move(signalPaths))
+    , m_metadataAgent(std::move(metadataAgent)) {}
+
+void ResolvedSignalSet::resolve(
+    std::function<void(const SignalSetResolutionPtr_t&)>&& onResolved,
+    std::function<void(const grpc::Status&)>&&               onError) {
+    // The generation needs to be read before querying: If the cache gets invalidated while the
+    // query is processed, the resolution is rated outdated on next use.
+    const auto generation = m_metadataAgent->getGeneration();
+
+    SignalSetResolutionPtr_t resolution;
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_resolution && m_resolution->m_generation == generation) {
+            resolution = m_resolution;
+        }
+    }
+    if (resolution) {
+        onResolved(resolution);
+        return;
+    }
+
+    m_metadataAgent->query(
+        getSignalPaths(),
+        [self = shared_from_this(), generation,
+         onResolved = std::move(onResolved)](MetadataList_t&& metadataList) {
+            auto resolution = self->createResolution(metadataList, generation);
+            {
+                std::lock_guard lock(self->m_mutex);
+                if (!self->m_resolution || self->m_resolution->m_generation <= generation) {
+                    self->m_resolution = resolution;
+                }
+            }
+            onResolved(resolution);
+        },
+        std::move(onError));
+}
+
+SignalSetResolutionPtr_t
+ResolvedSignalSet::createResolution(const MetadataList_t& metadataList, uint64_t generation) const {
+    const auto& layout = *getLayout();
+
+    auto resolution          = std::make_shared<SignalSetResolution>();
+    resolution->m_generation = generation;
+    resolution->m_idsBySlot.resize(layout.size());
+    auto& sortedSlots = resolution->m_sortedSlots;
+    for (const auto& metadata : metadataList) {
+        if (metadata->m_isKnown) {
+            const auto slot = layout.findHandle(metadata->m_signalPath);
+            assert(slot != DataPointLayout::INVALID_HANDLE);
+            resolution->m_idsBySlot[slot] = metadata->m_id;
+            sortedSlots.emplace_back(metadata->m_id, slot);
+            resolution->m_usesPreloadedIds |= metadata->m_isPreloaded;
+        }
+    }
+    std::sort(sortedSlots.begin(), sortedSlots.end());
+
+    if (!sortedSlots.empty()) {
+        const auto minId  = sortedSlots.front().first;
+        const auto spread = static_cast<size_t>(
+            static_cast<int64_t>(sortedSlots.back().first) - minId + 1);
+        if (spread <= std::max(MIN_SLOT_TABLE_SIZE, MAX_SLOT_TABLE_SPREAD * sortedSlots.size())) {
+            resolution->m_minId = minId;
+            resolution->m_slotTable.assign(spread, DataPointLayout::INVALID_HANDLE);
+            for (const auto& [id, slot] : sortedSlots) {
+                resolution->m_slotTable[static_cast<size_t>(id - minId)] = slot;
+            }
+            sortedSlots.clear();
+            sortedSlots.shrink_to_fit();
+        }
+    }
+
+    auto& signalIds = *resolution->m_getValuesRequest.mutable_signal_ids();
+    for (const auto& id : resolution->m_idsBySlot) {
+        if (id) {
+            signalIds.Add()->set_id(*id);
+            ++resolution->m_numKnownSignals;
+        }
+    }
+    return resolution;
+}
+
+} // namespace velocitas::kuksa_val_v2
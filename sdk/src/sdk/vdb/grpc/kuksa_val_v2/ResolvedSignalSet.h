@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_RESOLVEDSIGNALSET_H
+#define VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_RESOLVEDSIGNALSET_H
+
+#include "Metadata.h"
+#include "sdk/vdb/PreparedSignalSet.h"
+
+#include "kuksa/val/v2/val.pb.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace velocitas::kuksa_val_v2 {
+
+/**
+ * @brief Numeric ids of the signals of a ResolvedSignalSet, valid within one generation of the
+ *        metadata cache (i.e. one session of the databroker).
+ */
+struct SignalSetResolution {
+    using Handle_t = DataPointLayout::Handle_t;
+
+    /**
+     * @brief Get the slot of the passed numeric id without any hashing: The databroker assigns
+     * its ids densely, so they usually directly index a table. Only ids spread too widely fall
+     * back to a binary search.
+     *
+     * @param id  Numeric id as received from the databroker.
+     * @return Handle_t  The slot or DataPointLayout::INVALID_HANDLE if the id is not part of
+     * the set.
+     */
+    [[nodiscard]] Handle_t findSlot(numeric_id_t id) const;
+
+    uint64_t m_generation{0};
+    /** Numeric id of each slot of the set's layout, std::nullopt for signals unknown to the
+     *  databroker */
+    std::vector<std::optional<numeric_id_t>> m_idsBySlot;
+    /** Slot of each numeric id from m_minId on (INVALID_HANDLE for ids not in the set), empty if
+     *  the ids are spread too widely */
+    std::vector<Handle_t> m_slotTable;
+    numeric_id_t          m_minId{0};
+    /** Slots of the known numeric ids sorted by id, used if m_slotTable is empty */
+    std::vector<std::pair<numeric_id_t, Handle_t>> m_sortedSlots;
+    /** GetValues request for all known signals, ordered by slot */
+    kuksa::val::v2::GetValuesRequest m_getValuesRequest;
+    /** Number of signals requested via m_getValuesRequest */
+    size_t m_numKnownSignals{0};
+    /** Set if any of the ids was read from the persistent metadata cache */
+    bool m_usesPreloadedIds{false};
+};
+
+using SignalSetResolutionPtr_t = std::shared_ptr<const SignalSetResolution>;
+
+/**
+ * @brief Prepared signal set of the kuksa.val.v2 client which caches the numeric ids of its
+ *        signals. The ids are resolved via the MetadataAgent on first use and transparently
+ *        re-resolved once the metadata cache got invalidated.
+ */
+class ResolvedSignalSet : public PreparedSignalSet,
+                          public std::enable_shared_from_this<ResolvedSignalSet> {
+public:
+    ResolvedSignalSet(std::vector<std::string>       signalPaths,
+                      std::shared_ptr<MetadataAgent> metadataAgent);
+
+    /**
+     * @brief Provide the numeric ids of the signals of this set. If the ids of the current
+     * generation of the metadata cache are already known, onResolved is called immediately -
+     * i.e. before returning from this call - without any further processing.
+     *
+     * @param onResolved Called with the resolved ids.
+     * @param onError    Called if resolving the ids failed.
+     */
+    void resolve(std::function<void(const SignalSetResolutionPtr_t&)>&& onResolved,
+                 std::function<void(const grpc::Status&)>&&               onError);
+
+    /**
+     * @brief Check if this set was prepared using the passed metadata agent, i.e. if it belongs
+     * to the client owning the agent.
+     */
+    [[nodiscard]] bool isResolvedBy(const std::shared_ptr<MetadataAgent>& metadataAgent) const {
+        return m_metadataAgent == metadataAgent;
+    }
+
+private:
+    SignalSetResolutionPtr_t createResolution(const MetadataList_t& metadataList,
+                                              uint64_t              generation) const;
+
+    std::shared_ptr<MetadataAgent> m_metadataAgent;
+    std::mutex                     m_mutex;
+    SignalSetResolutionPtr_t       m_resolution;
+};
+
+} // namespace velocitas::kuksa_val_v2
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_RESOLVEDSIGNALSET_H
@@ -0,0 +1,1224 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "SubscriptionMultiplexer.h"
+
+#include "sdk/DataPointValue.h"
+#include "sdk/Job.h"
+#include "sdk/Logger.h"
+#include "sdk/Metrics.h"
+#include "sdk/Status.h"
+#include "sdk/ThreadPool.h"
+#include "sdk/Utils.h"
+#include "sdk/grpc/GrpcCall.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/BrokerAsyncGrpcFacade.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/Metadata.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/ResolvedSignalSet.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <chrono>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace velocitas::kuksa_val_v2 {
+
+namespace {
+
+const unsigned int DEFAULT_SUBSCRIBE_BUFFER_SIZE = 0;
+
+// Identifies an upstream subscription for the lifetime of the process. Unlike its address, an id
+// is never reused by a later upstream subscription.
+using UpstreamId_t = uint64_t;
+
+UpstreamId_t createUpstreamId() {
+    static std::atomic<UpstreamId_t> nextId{0};
+    return nextId++;
+}
+
+const std::chrono::milliseconds RESUBSCRIBE_DELAY_INITIAL{100};
+const std::chrono::milliseconds RESUBSCRIBE_DELAY_MAX{2000};
+const unsigned int              RESUBSCRIBE_DELAY_FACTOR{2};
+
+const MetricLabels_t METRIC_LABELS{{"api", "kuksa.val.v2"}};
+
+Counter& getReceivedUpdatesCounter() {
+    static auto& counter = MetricsRegistry::getInstance().getCounter(
+        "sdv_vdb_subscription_updates_received_total",
+        "Number of subscription updates received from the databroker", METRIC_LABELS);
+    return counter;
+}
+
+Counter& getReceivedDataPointsCounter() {
+    static auto& counter = MetricsRegistry::getInstance().getCounter(
+        "sdv_vdb_subscription_datapoints_received_total",
+        "Number of data point values received via subscriptions", METRIC_LABELS);
+    return counter;
+}
+
+Counter& getPublishedUpdatesCounter() {
+    static auto& counter = MetricsRegistry::getInstance().getCounter(
+        "sdv_vdb_subscription_updates_published_total",
+        "Number of subscription updates handed over to the application", METRIC_LABELS);
+    return counter;
+}
+
+Histogram& getTimeToFirstValueHistogram() {
+    static auto& histogram = MetricsRegistry::getInstance().getHistogram(
+        "sdv_vdb_subscription_time_to_first_value_seconds",
+        "Duration from subscribing until the first update was received", METRIC_LABELS,
+        Histogram::NANOSECONDS_PER_SECOND);
+    return histogram;
+}
+
+void clearUpdateStatus(DataPointValues_t& datapointValues) {
+    for (auto& value : datapointValues) {
+        if (value) {
+            value->clearUpdateStatus();
+        }
+    }
+}
+
+uint32_t determineSubscribeBufferSize() {
+    uint32_t bufferSize = DEFAULT_SUBSCRIBE_BUFFER_SIZE;
+    try {
+        auto bufferSizeStr = getEnvVar("SDV_SUBSCRIBE_BUFFER_SIZE");
+        if (!bufferSizeStr.empty()) {
+            bufferSize = std::stoi(bufferSizeStr);
+        }
+    } catch (...) {
+        logger().error("Invalid Subscribe BufferSize specified via env var! Using default ({}).",
+                       bufferSize);
+    }
+    return bufferSize;
+}
+
+uint32_t getSubscribeBufferSize() {
+    static uint32_t bufferSize = determineSubscribeBufferSize();
+    return bufferSize;
+}
+
+std::optional<std::chrono::milliseconds> determineSubscribeConflationInterval() {
+    try {
+        auto intervalStr = getEnvVar("SDV_SUBSCRIBE_CONFLATION_INTERVAL");
+        if (!intervalStr.empty()) {
+            auto interval = std::stoi(intervalStr);
+            if (interval < 0) {
+                throw std::out_of_range("negative interval");
+            }
+            return std::chrono::milliseconds{interval};
+        }
+    } catch (...) {
+        logger().error("Invalid Subscribe ConflationInterval specified via env var! Conflation "
+                       "is disabled.");
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Returns the min. interval between two notifications of a conflating subscription or
+ *        std::nullopt if subscriptions shall not conflate updates.
+ */
+std::optional<std::chrono::milliseconds> getSubscribeConflationInterval() {
+    static auto interval = determineSubscribeConflationInterval();
+    return interval;
+}
+
+std::string getSignalPathAbstract(const std::vector<std::string>& signalPaths) {
+    auto abstract{signalPaths.front()};
+    if (signalPaths.size() > 1) {
+        abstract.append(", etc");
+    }
+    return abstract;
+}
+
+/**
+ * @brief Invalidate the passed value of a signal as its current state is not known anymore.
+ *        Values carrying a permanent failure stay untouched.
+ *
+ * @return true if the value was changed, false otherwise
+ */
+bool invalidateValue(std::optional<DataPointValue>& value, InternedPath path) {
+    if (!value) {
+        value.emplace(DataPointValue::Type::INVALID, path, Timestamp{},
+                      DataPointValue::Failure::NOT_AVAILABLE);
+        return true;
+    }
+    switch (value->getFailure()) {
+    case DataPointValue::Failure::NOT_AVAILABLE:
+    case DataPointValue::Failure::UNKNOWN_DATAPOINT:
+    case DataPointValue::Failure::ACCESS_DENIED:
+        // nothing to do
+        return false;
+    default:
+        value.emplace(value->getType(), path, Timestamp{}, DataPointValue::Failure::NOT_AVAILABLE);
+        return true;
+    }
+}
+
+} // namespace
+
+// One subscription of the app, fed by one or more upstream subscriptions.
+//
+// The subscriber keeps the latest value of each of its signals in a table of slots (one per signal,
+// addressed via the handles of the subscription's DataPointLayout) which is handed out to the
+// consumer as an immutable snapshot. The table is only copied if it needs to be modified while the
+// consumer still holds the previous snapshot (copy on write).
+//
+// Each signal is fed by at most one upstream subscription. The subscriber maps the slots of each
+// of its upstream subscriptions to its own slots, so the signals can be changed at any time (see
+// changeSignals()) without the upstream subscriptions knowing about the subscriber's layout.
+//
+// In conflation mode (see getSubscribeConflationInterval()) the consumer is notified at most once
+// per conflation interval about the latest values of all signals. If the consumer is busy, i.e. it
+// did not yet fetch the previous snapshot via next(), the pending snapshot gets replaced by the
+// newer one.
+class Subscriber : public std::enable_shared_from_this<Subscriber> {
+public:
+    /**
+     * @brief Outcome of changing the signals of a subscriber.
+     */
+    struct SignalSetChange {
+        // Upstream subscriptions which lost signals of the subscriber
+        std::vector<UpstreamId_t> m_affectedUpstreams;
+        // Added signals which are not fed by any upstream subscription yet
+        std::vector<std::string> m_unmappedSignalPaths;
+    };
+
+    Subscriber(std::shared_ptr<const DataPointLayout>   layout,
+               std::optional<std::chrono::milliseconds> conflationInterval)
+        : m_subscription(std::make_shared<AsyncSubscription<DataPointReply>>())
+        , m_layout(std::move(layout))
+        , m_datapointUpdates(std::make_shared<DataPointValues_t>(m_layout->size()))
+        , m_isSlotMapped(m_layout->size())
+        , m_conflationInterval(conflationInterval) {
+        if (m_conflationInterval) {
+            m_subscription->setBufferCapacity(1, OverflowPolicy::COALESCE_LATEST);
+            m_subscription->setMaxDeliveryDelay(*m_conflationInterval);
+        }
+    }
+
+    [[nodiscard]] AsyncSubscriptionPtr_t<DataPointReply> getSubscription() const {
+        return m_subscription;
+    }
+
+    [[nodiscard]] bool isCancelled() const { return m_subscription->isCancelled(); }
+
+    [[nodiscard]] bool hasSignals() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_layout->size() > 0;
+    }
+
+    /**
+     * @brief Let the passed upstream subscription feed the passed signals. Signals which are not
+     *        (anymore) part of the subscriber or which are already fed by another upstream
+     *        subscription are skipped.
+     *
+     * @return All slots of the upstream subscription feeding this subscriber.
+     */
+    std::vector<DataPointLayout::Handle_t>
+    mapUpstream(UpstreamId_t upstreamId, const DataPointLayout& upstreamLayout,
+                const std::vector<std::string>& signalPaths) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto*                       mapping = findMapping(upstreamId);
+        if (mapping == nullptr) {
+            mapping = &m_upstreamMappings.emplace_back(UpstreamMapping{
+                upstreamId, std::vector<DataPointLayout::Handle_t>(
+                                upstreamLayout.size(), DataPointLayout::INVALID_HANDLE)});
+        }
+        for (const auto& path : signalPaths) {
+            const auto slot         = m_layout->findHandle(path);
+            const auto upstreamSlot = upstreamLayout.findHandle(path);
+            if ((slot != DataPointLayout::INVALID_HANDLE) && !m_isSlotMapped[slot] &&
+                (upstreamSlot != DataPointLayout::INVALID_HANDLE)) {
+                mapping->m_slotByUpstreamSlot[upstreamSlot] = slot;
+                m_isSlotMapped[slot]                        = true;
+            }
+        }
+
+        auto upstreamSlots = getMappedUpstreamSlots(*mapping);
+        if (upstreamSlots.empty()) {
+            eraseMapping(upstreamId);
+        }
+        return upstreamSlots;
+    }
+
+    /**
+     * @brief Stop the passed upstream subscription from feeding any signal, so the signals can be
+     *        fed by another upstream subscription.
+     */
+    void unmapUpstream(UpstreamId_t upstreamId) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto*                 mapping = findMapping(upstreamId);
+        if (mapping == nullptr) {
+            return;
+        }
+        for (const auto slot : mapping->m_slotByUpstreamSlot) {
+            if (slot != DataPointLayout::INVALID_HANDLE) {
+                m_isSlotMapped[slot] = false;
+            }
+        }
+        eraseMapping(upstreamId);
+    }
+
+    /**
+     * @brief Get all slots of the passed upstream subscription feeding this subscriber.
+     */
+    [[nodiscard]] std::vector<DataPointLayout::Handle_t>
+    getMappedUpstreamSlots(UpstreamId_t upstreamId) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto*                 mapping = findMapping(upstreamId);
+        return mapping != nullptr ? getMappedUpstreamSlots(*mapping)
+                                  : std::vector<DataPointLayout::Handle_t>{};
+    }
+
+    /**
+     * @brief Take over the values of the passed slots of an upstream subscription. The consumer
+     *        is not notified, see notifyConsumer().
+     *
+     * @return true if any value of the subscriber changed, false otherwise
+     */
+    bool applyValues(UpstreamId_t                                  upstreamId,
+                     const std::vector<DataPointLayout::Handle_t>& upstreamSlots,
+                     const DataPointValues_t&                      upstreamValues) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto*                 mapping = findMapping(upstreamId);
+        if (mapping == nullptr) {
+            return false;
+        }
+        DataPointValues_t* datapointUpdates = nullptr;
+        for (const auto upstreamSlot : upstreamSlots) {
+            const auto slot = mapping->m_slotByUpstreamSlot[upstreamSlot];
+            if (slot != DataPointLayout::INVALID_HANDLE) {
+                if (datapointUpdates == nullptr) {
+                    datapointUpdates = &getWritableDataPointUpdates();
+                }
+                (*datapointUpdates)[slot] = upstreamValues[upstreamSlot];
+            }
+        }
+        const bool anyValueChanged = (datapointUpdates != nullptr);
+        m_hasUnpublishedUpdates    = m_hasUnpublishedUpdates || anyValueChanged;
+        return anyValueChanged;
+    }
+
+    /**
+     * @brief Invalidate the values of all signals fed by the passed upstream subscription.
+     *
+     * @return true if any value of the subscriber changed, false otherwise
+     */
+    bool invalidateDataPointValues(UpstreamId_t upstreamId) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto*                 mapping = findMapping(upstreamId);
+        if (mapping == nullptr) {
+            return false;
+        }
+        auto& datapointUpdates    = getWritableDataPointUpdates();
+        bool  anyValueInvalidated = false;
+        for (const auto slot : mapping->m_slotByUpstreamSlot) {
+            if (slot != DataPointLayout::INVALID_HANDLE) {
+                anyValueInvalidated |=
+                    invalidateValue(datapointUpdates[slot], m_layout->getInternedPath(slot));
+            }
+        }
+        m_hasUnpublishedUpdates = m_hasUnpublishedUpdates || anyValueInvalidated;
+        return anyValueInvalidated;
+    }
+
+    /**
+     * @brief Add and remove signals. The values of the remaining signals are kept, the consumer
+     *        gets the new layout with the next notification.
+     */
+    SignalSetChange changeSignals(const std::vector<std::string>& addedSignalPaths,
+                                  const std::vector<std::string>& removedSignalPaths) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto removedSignals = removedSignalPaths;
+        std::sort(removedSignals.begin(), removedSignals.end());
+        std::vector<std::string> signalPaths;
+        signalPaths.reserve(m_layout->size() + addedSignalPaths.size());
+        std::copy_if(m_layout->getPaths().cbegin(), m_layout->getPaths().cend(),
+                     std::back_inserter(signalPaths), [&removedSignals](const auto& path) {
+                         return !std::binary_search(removedSignals.cbegin(),
+                                                    removedSignals.cend(), path);
+                     });
+        signalPaths.insert(signalPaths.end(), addedSignalPaths.cbegin(), addedSignalPaths.cend());
+        auto layout = std::make_shared<const DataPointLayout>(std::move(signalPaths));
+        if (layout->getPaths() == m_layout->getPaths()) {
+            return {};
+        }
+
+        // Move the known values to their new slots; none of them is updated by the change itself
+        auto              datapointUpdates = std::make_shared<DataPointValues_t>(layout->size());
+        std::vector<bool> isSlotMapped(layout->size());
+        for (DataPointLayout::Handle_t slot = 0; slot < m_layout->size(); ++slot) {
+            const auto newSlot = layout->findHandle(m_layout->getPath(slot));
+            if (newSlot != DataPointLayout::INVALID_HANDLE) {
+                (*datapointUpdates)[newSlot] = (*m_datapointUpdates)[slot];
+            }
+        }
+        clearUpdateStatus(*datapointUpdates);
+
+        SignalSetChange change;
+        for (auto& mapping : m_upstreamMappings) {
+            bool isAffected = false;
+            for (auto& slot : mapping.m_slotByUpstreamSlot) {
+                if (slot != DataPointLayout::INVALID_HANDLE) {
+                    slot = layout->findHandle(m_layout->getPath(slot));
+                    if (slot != DataPointLayout::INVALID_HANDLE) {
+                        isSlotMapped[slot] = true;
+                    } else {
+                        isAffected = true;
+                    }
+                }
+            }
+            if (isAffected) {
+                change.m_affectedUpstreams.push_back(mapping.m_upstreamId);
+            }
+        }
+        m_upstreamMappings.erase(std::remove_if(m_upstreamMappings.begin(),
+                                                m_upstreamMappings.end(),
+                                                [](const auto& mapping) {
+                                                    return getMappedUpstreamSlots(mapping).empty();
+                                                }),
+                                 m_upstreamMappings.end());
+
+        for (const auto& path : layout->getPaths()) {
+            if (!isSlotMapped[layout->findHandle(path)] &&
+                (m_layout->findHandle(path) == DataPointLayout::INVALID_HANDLE)) {
+                change.m_unmappedSignalPaths.push_back(path);
+            }
+        }
+
+        m_layout                  = std::move(layout);
+        m_datapointUpdates        = std::move(datapointUpdates);
+        m_isSlotMapped            = std::move(isSlotMapped);
+        m_isUpdateStatusPublished = false;
+        return change;
+    }
+
+    void insertError(Status&& status) { m_subscription->insertError(std::move(status)); }
+
+    /**
+     * @brief Notify the consumer about the current values of the subscribed signals. In
+     *        conflation mode the notification is deferred until the conflation interval elapsed.
+     *
+     *        The calling thread typically serves a stream shared with other subscribers, hence it
+     *        never waits for the consumer: If its buffer is full and blocks the producer, the
+     *        notification is handed over to the SDK's internal thread pool. Updates arriving
+     *        meanwhile are conflated into the next snapshot.
+     */
+    void notifyConsumer() { publishSnapshots(false); }
+
+private:
+    struct UpstreamMapping {
+        UpstreamId_t m_upstreamId;
+        // Slot of the subscriber per slot of the upstream subscription, INVALID_HANDLE if the
+        // upstream subscription does not feed the signal to this subscriber
+        std::vector<DataPointLayout::Handle_t> m_slotByUpstreamSlot;
+    };
+
+    static std::vector<DataPointLayout::Handle_t>
+    getMappedUpstreamSlots(const UpstreamMapping& mapping) {
+        std::vector<DataPointLayout::Handle_t> upstreamSlots;
+        for (DataPointLayout::Handle_t upstreamSlot = 0;
+             upstreamSlot < mapping.m_slotByUpstreamSlot.size(); ++upstreamSlot) {
+            if (mapping.m_slotByUpstreamSlot[upstreamSlot] != DataPointLayout::INVALID_HANDLE) {
+                upstreamSlots.push_back(upstreamSlot);
+            }
+        }
+        return upstreamSlots;
+    }
+
+    [[nodiscard]] const UpstreamMapping* findMapping(UpstreamId_t upstreamId) const {
+        auto iter = std::find_if(
+            m_upstreamMappings.cbegin(), m_upstreamMappings.cend(),
+            [upstreamId](const auto& mapping) { return mapping.m_upstreamId == upstreamId; });
+        return iter != m_upstreamMappings.cend() ? &*iter : nullptr;
+    }
+
+    UpstreamMapping* findMapping(UpstreamId_t upstreamId) {
+        return const_cast<UpstreamMapping*>(std::as_const(*this).findMapping(upstreamId));
+    }
+
+    void eraseMapping(UpstreamId_t upstreamId) {
+        m_upstreamMappings.erase(
+            std::remove_if(
+                m_upstreamMappings.begin(), m_upstreamMappings.end(),
+                [upstreamId](const auto& mapping) { return mapping.m_upstreamId == upstreamId; }),
+            m_upstreamMappings.end());
+    }
+
+    /**
+     * @brief Publish snapshots as long as there are unpublished updates, obeying the conflation
+     *        interval. Only one thread at a time executes this function (guarded by
+     *        m_isPublishingScheduled), others leave the updates to it.
+     *
+     * @param isScheduled  true if called by a job scheduled via schedulePublishing(), which may
+     *                     wait for the consumer to make room in its buffer.
+     */
+    void publishSnapshots(bool isScheduled) {
+        bool isPublishingThread = isScheduled;
+        while (true) {
+            std::shared_ptr<const DataPointLayout>   layout;
+            std::shared_ptr<const DataPointValues_t> snapshot;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!isPublishingThread) {
+                    if (m_isPublishingScheduled) {
+                        // the publishing thread will pick up the latest values
+                        return;
+                    }
+                    m_isPublishingScheduled = true;
+                    isPublishingThread      = true;
+                }
+                if (!m_hasUnpublishedUpdates) {
+                    m_isPublishingScheduled = false;
+                    return;
+                }
+                const auto now = std::chrono::steady_clock::now();
+                if (m_conflationInterval) {
+                    const auto nextDueAt = m_lastPublishTime + *m_conflationInterval;
+                    if (now < nextDueAt) {
+                        schedulePublishing(
+                            std::chrono::ceil<std::chrono::milliseconds>(nextDueAt - now));
+                        return;
+                    }
+                }
+                if (!isScheduled && m_subscription->wouldBlockProducer()) {
+                    schedulePublishing(std::chrono::milliseconds::zero());
+                    return;
+                }
+                m_lastPublishTime         = now;
+                layout                    = m_layout;
+                snapshot                  = m_datapointUpdates;
+                m_hasUnpublishedUpdates   = false;
+                m_isUpdateStatusPublished = true;
+            }
+            m_subscription->insertNewItem(DataPointReply(std::move(layout), std::move(snapshot)));
+            getPublishedUpdatesCounter().increment();
+        }
+    }
+
+    void schedulePublishing(std::chrono::milliseconds delay) {
+        ThreadPool::getInstance(executors::SDK_INTERNAL)
+            ->enqueue(Job::create(
+                [weakSelf = weak_from_this()]() {
+                    if (auto self = weakSelf.lock()) {
+                        self->publishSnapshots(true);
+                    }
+                },
+                delay));
+    }
+
+    /**
+     * @brief Returns the table of latest values for modification. Needs to be called with
+     *        m_mutex held.
+     */
+    DataPointValues_t& getWritableDataPointUpdates() {
+        // If the consumer still holds the last published snapshot, we must not modify it
+        if (m_datapointUpdates.use_count() > 1) {
+            m_datapointUpdates = std::make_shared<DataPointValues_t>(*m_datapointUpdates);
+        }
+        // The update status of the values refers to the last published snapshot. It is only reset
+        // when the table is about to be changed, so it stays intact within the published snapshot.
+        if (m_isUpdateStatusPublished) {
+            clearUpdateStatus(*m_datapointUpdates);
+            m_isUpdateStatusPublished = false;
+        }
+        return *m_datapointUpdates;
+    }
+
+    std::shared_ptr<AsyncSubscription<DataPointReply>> m_subscription;
+    mutable std::mutex                                 m_mutex;
+    std::shared_ptr<const DataPointLayout>             m_layout;
+    std::shared_ptr<DataPointValues_t>                 m_datapointUpdates;
+    std::vector<UpstreamMapping>                       m_upstreamMappings;
+    std::vector<bool>                                  m_isSlotMapped;
+    bool                                               m_hasUnpublishedUpdates{false};
+    bool                                               m_isUpdateStatusPublished{false};
+    std::optional<std::chrono::milliseconds>           m_conflationInterval;
+    bool                                               m_isPublishingScheduled{false};
+    std::chrono::steady_clock::time_point              m_lastPublishTime{};
+};
+
+// One SubscribeById stream to the databroker, shared by all subscribers attached to it.
+//
+// The upstream subscription keeps the latest value of each of its signals and fans incoming
+// updates out to the attached subscribers interested in the updated signals. Its signal set is
+// fixed, subscribers can only attach signals covered by it. Subscribers cancelled by the app are
+// detached with the next update; once the last one is gone, the stream is closed.
+class UpstreamSubscription : public std::enable_shared_from_this<UpstreamSubscription> {
+public:
+    enum class AttachResult { NOT_COVERED, ATTACHED, ATTACHED_WITH_KNOWN_VALUES };
+
+    UpstreamSubscription(std::shared_ptr<BrokerAsyncGrpcFacade> asyncBrokerFacade,
+                         std::shared_ptr<MetadataAgent>         metadataAgent,
+                         std::shared_ptr<ResolvedSignalSet>     signalSet)
+        : m_asyncBrokerFacade(std::move(asyncBrokerFacade))
+        , m_metadataAgent(std::move(metadataAgent))
+        , m_signalSet(std::move(signalSet))
+        , m_layout(m_signalSet->getLayout())
+        , m_latestValues(m_layout->size())
+        , m_interestedBySlot(m_layout->size()) {}
+
+    [[nodiscard]] UpstreamId_t getId() const { return m_id; }
+
+    /**
+     * @brief Attach the passed signals of a subscriber if all of them are part of this
+     *        subscription. The latest values known so far are handed over to the subscriber, but
+     *        its consumer is not notified.
+     */
+    AttachResult attach(const std::shared_ptr<Subscriber>& subscriber,
+                        const std::vector<std::string>&    signalPaths) {
+        const bool isCovered =
+            std::all_of(signalPaths.cbegin(), signalPaths.cend(), [this](const auto& path) {
+                return m_layout->findHandle(path) != DataPointLayout::INVALID_HANDLE;
+            });
+        if (!isCovered) {
+            return AttachResult::NOT_COVERED;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_isClosed) {
+            return AttachResult::NOT_COVERED;
+        }
+        auto upstreamSlots = subscriber->mapUpstream(m_id, *m_layout, signalPaths);
+        std::vector<DataPointLayout::Handle_t> knownSlots;
+        std::copy_if(upstreamSlots.cbegin(), upstreamSlots.cend(), std::back_inserter(knownSlots),
+                     [this](const auto slot) { return m_latestValues[slot].has_value(); });
+        setAttachment(subscriber, std::move(upstreamSlots));
+        return subscriber->applyValues(m_id, knownSlots, m_latestValues)
+                   ? AttachResult::ATTACHED_WITH_KNOWN_VALUES
+                   : AttachResult::ATTACHED;
+    }
+
+    /**
+     * @brief Take over the signals the passed subscriber currently wants to get from this
+     *        subscription. The stream is closed if no subscriber is left.
+     */
+    void refreshAttachment(const std::shared_ptr<Subscriber>& subscriber) {
+        bool isUnused = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            setAttachment(subscriber, subscriber->getMappedUpstreamSlots(m_id));
+            isUnused = m_attachments.empty();
+        }
+        if (isUnused) {
+            close();
+        }
+    }
+
+    [[nodiscard]] bool isUnused() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_attachments.empty();
+    }
+
+    [[nodiscard]] bool isClosed() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_isClosed;
+    }
+
+    /**
+     * @brief Check if the subscription is closed and its stream completed, i.e. no callbacks
+     *        will reach this object anymore.
+     */
+    [[nodiscard]] bool isFinished() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_isClosed && (!m_grpcSubscriptionCall || m_grpcSubscriptionCall->m_isComplete);
+    }
+
+    /**
+     * @brief Close the subscription, i.e. cancel its stream and stop resubscribing.
+     */
+    void close() {
+        logger().debug("Closing subscription of {}",
+                       getSignalPathAbstract(m_signalSet->getSignalPaths()));
+        std::shared_ptr<GrpcCall> grpcSubscriptionCall;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_isClosed) {
+                return;
+            }
+            m_isClosed           = true;
+            grpcSubscriptionCall = m_grpcSubscriptionCall;
+        }
+        if (grpcSubscriptionCall) {
+            grpcSubscriptionCall->m_context.TryCancel();
+        }
+    }
+
+    void subscribe() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_isClosed) {
+                return;
+            }
+            m_subscribeStartTime   = std::chrono::steady_clock::now();
+            m_isFirstUpdatePending = true;
+        }
+        m_signalSet->resolve(
+            [self = shared_from_this()](const auto& resolution) {
+                self->onSignalsResolved(resolution);
+            },
+            [self = shared_from_this()](const auto& status) { self->onError(status, false); });
+    }
+
+private:
+    struct Attachment {
+        std::shared_ptr<Subscriber> m_subscriber;
+        // Slots of this subscription feeding the subscriber
+        std::vector<DataPointLayout::Handle_t> m_upstreamSlots;
+        // Slots updated by the current update, reused across updates to avoid allocations
+        std::vector<DataPointLayout::Handle_t> m_pendingSlots;
+    };
+
+    void onSignalsResolved(const SignalSetResolutionPtr_t& resolution) {
+        kuksa::val::v2::SubscribeByIdRequest request;
+        if (getSubscribeBufferSize() != DEFAULT_SUBSCRIBE_BUFFER_SIZE) {
+            request.set_buffer_size(getSubscribeBufferSize());
+        }
+        request.mutable_signal_ids()->Reserve(
+            assertProtobufArrayLimits(resolution->m_numKnownSignals));
+        std::vector<std::shared_ptr<Subscriber>> subscribersToNotify;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_isClosed) {
+                return;
+            }
+            // numeric ids are only valid for the current session of the databroker
+            m_resolution = resolution;
+            for (DataPointLayout::Handle_t slot = 0; slot < m_layout->size(); ++slot) {
+                if (const auto& id = resolution->m_idsBySlot[slot]) {
+                    request.add_signal_ids(*id);
+                } else {
+                    m_latestValues[slot].emplace(DataPointValue::Type::INVALID,
+                                                 m_layout->getInternedPath(slot), Timestamp{},
+                                                 DataPointValue::Failure::UNKNOWN_DATAPOINT);
+                    addToPendingSlots(slot);
+                }
+            }
+            subscribersToNotify = applyPendingSlots();
+            assert(!m_grpcSubscriptionCall || m_grpcSubscriptionCall->m_isComplete);
+        }
+        for (const auto& subscriber : subscribersToNotify) {
+            subscriber->notifyConsumer();
+        }
+
+        // The call may outlive this subscription, e.g. if the client is destroyed while the stream
+        // is open, hence the callbacks must not keep a dangling pointer to it
+        auto grpcSubscriptionCall = m_asyncBrokerFacade->SubscribeById(
+            std::move(request),
+            [weakSelf = weak_from_this()](const auto& update) {
+                if (auto self = weakSelf.lock()) {
+                    self->onUpdate(update);
+                }
+            },
+            [weakSelf = weak_from_this()](const auto& status) {
+                if (auto self = weakSelf.lock()) {
+                    self->onError(status);
+                }
+            });
+        bool isCancelRequired = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_grpcSubscriptionCall = grpcSubscriptionCall;
+            isCancelRequired       = m_isClosed || m_isRestartRequested;
+        }
+        if (isCancelRequired) {
+            // closed or restart requested by an update received while the call was set up
+            grpcSubscriptionCall->m_context.TryCancel();
+        }
+    }
+
+    void onUpdate(const kuksa::val::v2::SubscribeByIdResponse& update) {
+        if (isResolutionOutdated()) {
+            // The ids got invalid (e.g. preloaded ids turned out to stem from another databroker
+            // version), hence the update might refer to other signals than subscribed
+            restartSubscription();
+            return;
+        }
+        resetResubscribeDelay();
+        getReceivedUpdatesCounter().increment();
+        getReceivedDataPointsCounter().increment(update.entries().size());
+        std::optional<std::chrono::steady_clock::duration> timeToFirstValue;
+        std::vector<std::shared_ptr<Subscriber>>           subscribersToNotify;
+        bool                                               isUnused = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_isFirstUpdatePending) {
+                m_isFirstUpdatePending = false;
+                timeToFirstValue       = std::chrono::steady_clock::now() - m_subscribeStartTime;
+            }
+            detachCancelledSubscribers();
+            const auto& resolution = *m_resolution;
+            for (const auto& [id, dataPoint] : update.entries()) {
+                const auto slot = resolution.findSlot(id);
+                if (slot != DataPointLayout::INVALID_HANDLE) {
+                    m_latestValues[slot] =
+                        convertFromGrpcDataPoint(m_layout->getInternedPath(slot), dataPoint);
+                    addToPendingSlots(slot);
+                } else {
+                    logger().error("onSubscriptionUpdate: Unexpected signal id={} received.", id);
+                }
+            }
+            subscribersToNotify = applyPendingSlots();
+            isUnused            = m_attachments.empty();
+        }
+        if (timeToFirstValue) {
+            getTimeToFirstValueHistogram().recordDuration(*timeToFirstValue);
+            logger().info(
+                "Subscription of {} received first values after {}ms",
+                getSignalPathAbstract(m_signalSet->getSignalPaths()),
+                std::chrono::duration_cast<std::chrono::milliseconds>(*timeToFirstValue).count());
+        }
+        for (const auto& subscriber : subscribersToNotify) {
+            subscriber->notifyConsumer();
+        }
+        if (isUnused) {
+            close();
+        }
+    }
+
+    /**
+     * @brief Set the slots feeding the passed subscriber, detaching it if there are none. Needs
+     *        to be called with m_mutex held.
+     */
+    void setAttachment(const std::shared_ptr<Subscriber>&       subscriber,
+                       std::vector<DataPointLayout::Handle_t>&& upstreamSlots) {
+        auto iter = std::find_if(m_attachments.begin(), m_attachments.end(),
+                                 [&subscriber](const auto& attachment) {
+                                     return attachment.m_subscriber == subscriber;
+                                 });
+        if (upstreamSlots.empty()) {
+            if (iter != m_attachments.end()) {
+                m_attachments.erase(iter);
+            }
+        } else if (iter != m_attachments.end()) {
+            iter->m_upstreamSlots = std::move(upstreamSlots);
+        } else {
+            m_attachments.push_back(Attachment{subscriber, std::move(upstreamSlots), {}});
+        }
+        updateInterestedSubscribers();
+    }
+
+    /**
+     * @brief Rebuild the subscribers interested per slot. Needs to be called with m_mutex held.
+     */
+    void updateInterestedSubscribers() {
+        for (auto& interested : m_interestedBySlot) {
+            interested.clear();
+        }
+        for (size_t index = 0; index < m_attachments.size(); ++index) {
+            for (const auto upstreamSlot : m_attachments[index].m_upstreamSlots) {
+                m_interestedBySlot[upstreamSlot].push_back(index);
+            }
+        }
+    }
+
+    /**
+     * @brief Remember the passed slot as updated for all subscribers interested in it. Needs to
+     *        be called with m_mutex held.
+     */
+    void addToPendingSlots(DataPointLayout::Handle_t upstreamSlot) {
+        for (const auto index : m_interestedBySlot[upstreamSlot]) {
+            m_attachments[index].m_pendingSlots.push_back(upstreamSlot);
+        }
+    }
+
+    /**
+     * @brief Hand the values of all pending slots over to the subscribers. Needs to be called
+     *        with m_mutex held.
+     *
+     * @return The subscribers whose values changed.
+     */
+    std::vector<std::shared_ptr<Subscriber>> applyPendingSlots() {
+        std::vector<std::shared_ptr<Subscriber>> updatedSubscribers;
+        for (auto& attachment : m_attachments) {
+            if (!attachment.m_pendingSlots.empty()) {
+                if (attachment.m_subscriber->applyValues(m_id, attachment.m_pendingSlots,
+                                                         m_latestValues)) {
+                    updatedSubscribers.push_back(attachment.m_subscriber);
+                }
+                attachment.m_pendingSlots.clear();
+            }
+        }
+        return updatedSubscribers;
+    }
+
+    /**
+     * @brief Detach all subscribers cancelled by the app. Needs to be called with m_mutex held.
+     */
+    void detachCancelledSubscribers() {
+        const auto isCancelled = [](const auto& attachment) {
+            return attachment.m_subscriber->isCancelled();
+        };
+        if (std::none_of(m_attachments.cbegin(), m_attachments.cend(), isCancelled)) {
+            return;
+        }
+
+        m_attachments.erase(
+            std::remove_if(m_attachments.begin(), m_attachments.end(), isCancelled),
+            m_attachments.end());
+        updateInterestedSubscribers();
+    }
+
+    bool isResolutionOutdated() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_resolution->m_generation != m_metadataAgent->getGeneration();
+    }
+
+    /**
+     * @brief Invalidate the metadata unless it was invalidated since this subscription resolved
+     *        its ids. When the databroker goes away, all upstream subscriptions fail at once; only
+     *        the first one needs to invalidate, as each further invalidation would make the ids of
+     *        already resubscribed upstream subscriptions look outdated again.
+     */
+    void invalidateMetadataIfCurrent() {
+        std::optional<uint64_t> generation;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_resolution) {
+                generation = m_resolution->m_generation;
+            }
+        }
+        if (generation) {
+            m_metadataAgent->invalidateIfCurrent(*generation);
+        }
+    }
+
+    void restartSubscription() {
+        std::shared_ptr<GrpcCall> grpcSubscriptionCall;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_isRestartRequested) {
+                return;
+            }
+            m_isRestartRequested = true;
+            grpcSubscriptionCall = m_grpcSubscriptionCall;
+        }
+        logger().info("Restarting subscription of {} due to outdated signal ids",
+                      getSignalPathAbstract(m_signalSet->getSignalPaths()));
+        // If the update stems from a call which is not stored yet, the stored one is the previous
+        // call; the pending request is applied by onSignalsResolved() once the new call is stored
+        if (grpcSubscriptionCall && !grpcSubscriptionCall->m_isComplete) {
+            grpcSubscriptionCall->m_context.TryCancel();
+        }
+    }
+
+    bool takeRestartRequest() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return std::exchange(m_isRestartRequested, false);
+    }
+
+    /**
+     * @brief Check if the subscription might have been rejected by the databroker due to wrong
+     *        ids rather than for good, i.e. if its ids are outdated or stem from the persistent
+     *        metadata cache. The latter get discarded, so the signals are resolved from scratch
+     *        once, and an error persisting then is rated unrecoverable.
+     */
+    bool discardQuestionableIds() {
+        SignalSetResolutionPtr_t resolution;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            resolution = m_resolution;
+        }
+        if (!resolution) {
+            return false;
+        }
+        if (resolution->m_usesPreloadedIds) {
+            m_metadataAgent->discardPreloadedIfCurrent(resolution->m_generation);
+            return true;
+        }
+        return resolution->m_generation != m_metadataAgent->getGeneration();
+    }
+
+    /**
+     * @param isSubscribeCallError  Whether the error was reported by the SubscribeById call
+     *                              rather than by resolving the signal ids.
+     */
+    void onError(const grpc::Status& status, bool isSubscribeCallError = true) {
+        if (isClosed()) {
+            return;
+        }
+        if (takeRestartRequest()) {
+            resubscribe();
+            return;
+        }
+        switch (status.error_code()) {
+        case grpc::StatusCode::OK:
+        case grpc::StatusCode::UNAVAILABLE:
+            // The databroker ended the connection or became unavailable. This is most
+            // probably a temporary error, so we try to subscribe again
+            logger().warn("Connection to databroker lost or failed");
+            invalidateMetadataIfCurrent();
+            for (const auto& subscriber : invalidateDataPointValues()) {
+                subscriber->notifyConsumer();
+            }
+            resubscribe();
+            break;
+        default: {
+            if (isSubscribeCallError && discardQuestionableIds()) {
+                logger().warn("Subscribe failed: code={}, {} -> resolving signal ids again",
+                              static_cast<unsigned int>(status.error_code()),
+                              status.error_message());
+                resubscribe();
+                break;
+            }
+            // all other errors are rated unrecoverable, therefore retry does not make sense
+            std::vector<Attachment> attachments;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_isClosed = true;
+                attachments.swap(m_attachments);
+                updateInterestedSubscribers();
+            }
+            for (const auto& attachment : attachments) {
+                attachment.m_subscriber->unmapUpstream(m_id);
+                attachment.m_subscriber->insertError(Status(fmt::format(
+                    "Subscribe failed: code={}, {}", static_cast<unsigned int>(status.error_code()),
+                    status.error_message())));
+            }
+            break;
+        }
+        }
+    }
+
+    /**
+     * @brief Invalidate the values of all signals.
+     *
+     * @return The subscribers whose values changed.
+     */
+    std::vector<std::shared_ptr<Subscriber>> invalidateDataPointValues() {
+        std::vector<std::shared_ptr<Subscriber>> updatedSubscribers;
+        std::lock_guard<std::mutex>              lock(m_mutex);
+        for (DataPointLayout::Handle_t slot = 0; slot < m_layout->size(); ++slot) {
+            invalidateValue(m_latestValues[slot], m_layout->getInternedPath(slot));
+        }
+        for (const auto& attachment : m_attachments) {
+            if (attachment.m_subscriber->invalidateDataPointValues(m_id)) {
+                updatedSubscribers.push_back(attachment.m_subscriber);
+            }
+        }
+        return updatedSubscribers;
+    }
+
+    void resubscribe() {
+        logger().debug("Initiating re-subscribe of {} after {}ms",
+                       getSignalPathAbstract(m_signalSet->getSignalPaths()),
+                       m_resubscribeDelay.count());
+        ThreadPool::getInstance(executors::SDK_INTERNAL)
+            ->enqueue(Job::create(
+                [self = shared_from_this(), start = std::chrono::steady_clock::now()]() {
+                    const std::chrono::duration<double> diff =
+                        std::chrono::steady_clock::now() - start;
+                    logger().debug("Try re-subscribing {} after {}s of waiting",
+                                   getSignalPathAbstract(self->m_signalSet->getSignalPaths()),
+                                   diff.count());
+                    self->increaseResubscribeDelay();
+                    self->subscribe();
+                },
+                m_resubscribeDelay));
+    }
+
+    void resetResubscribeDelay() { m_resubscribeDelay = RESUBSCRIBE_DELAY_INITIAL; }
+
+    void increaseResubscribeDelay() {
+        m_resubscribeDelay *= RESUBSCRIBE_DELAY_FACTOR;
+        if (m_resubscribeDelay > RESUBSCRIBE_DELAY_MAX) {
+            m_resubscribeDelay = RESUBSCRIBE_DELAY_MAX;
+        }
+    }
+
+    const UpstreamId_t                     m_id{createUpstreamId()};
+    std::shared_ptr<BrokerAsyncGrpcFacade> m_asyncBrokerFacade;
+    std::shared_ptr<MetadataAgent>         m_metadataAgent;
+    std::shared_ptr<ResolvedSignalSet>     m_signalSet;
+    std::shared_ptr<const DataPointLayout> m_layout;
+    mutable std::mutex                     m_mutex;
+    SignalSetResolutionPtr_t               m_resolution;
+    DataPointValues_t                      m_latestValues;
+    std::vector<Attachment>                m_attachments;
+    // Subscribers (index into m_attachments) interested per slot
+    std::vector<std::vector<size_t>>      m_interestedBySlot;
+    bool                                  m_isClosed{false};
+    std::chrono::steady_clock::time_point m_subscribeStartTime{};
+    bool                                  m_isFirstUpdatePending{false};
+    std::shared_ptr<GrpcCall>             m_grpcSubscriptionCall;
+    bool                                  m_isRestartRequested{false};
+    std::chrono::milliseconds             m_resubscribeDelay{RESUBSCRIBE_DELAY_INITIAL};
+};
+
+SubscriptionMultiplexer::SubscriptionMultiplexer(
+    std::shared_ptr<BrokerAsyncGrpcFacade> asyncBrokerFacade,
+    std::shared_ptr<MetadataAgent>         metadataAgent)
+    : m_asyncBrokerFacade(std::move(asyncBrokerFacade))
+    , m_metadataAgent(std::move(metadataAgent)) {}
+
+SubscriptionMultiplexer::~SubscriptionMultiplexer() {
+    // Pending resubscribes keep their upstream alive, closing it stops them from reconnecting
+    // on behalf of a client which is gone
+    for (const auto& upstream : m_upstreams) {
+        upstream->close();
+    }
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+SubscriptionMultiplexer::subscribe(const std::shared_ptr<ResolvedSignalSet>& signalSet) {
+    auto subscriber =
+        std::make_shared<Subscriber>(signalSet->getLayout(), getSubscribeConflationInterval());
+    auto subscription = subscriber->getSubscription();
+    // The subscription must not keep its subscriber alive, the subscriber owns the subscription
+    subscription->setSignalSetChangeHandler(
+        [weakSelf = weak_from_this(), weakSubscriber = std::weak_ptr<Subscriber>(subscriber)](
+            const auto& addedSignalPaths, const auto& removedSignalPaths) {
+            auto self       = weakSelf.lock();
+            auto subscriber = weakSubscriber.lock();
+            if (self && subscriber) {
+                self->changeSignals(subscriber, addedSignalPaths, removedSignalPaths);
+            }
+        });
+
+    bool hasKnownValues = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        pruneFinishedUpstreams();
+        hasKnownValues = attachOrQueue(subscriber, signalSet);
+    }
+    if (hasKnownValues) {
+        subscriber->notifyConsumer();
+    }
+    return subscription;
+}
+
+void SubscriptionMultiplexer::changeSignals(const std::shared_ptr<Subscriber>& subscriber,
+                                            const std::vector<std::string>&    addedSignalPaths,
+                                            const std::vector<std::string>&    removedSignalPaths) {
+    bool hasKnownValues = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        pruneFinishedUpstreams();
+        auto change = subscriber->changeSignals(addedSignalPaths, removedSignalPaths);
+        for (const auto& upstream : m_upstreams) {
+            const auto& affected   = change.m_affectedUpstreams;
+            const auto  upstreamId = upstream->getId();
+            if (std::find(affected.cbegin(), affected.cend(), upstreamId) != affected.cend()) {
+                upstream->refreshAttachment(subscriber);
+            }
+        }
+
+        // Nothing else keeps a subscriber without signals alive
+        auto idleIter = std::find(m_idleSubscribers.begin(), m_idleSubscribers.end(), subscriber);
+        if (subscriber->hasSignals()) {
+            if (idleIter != m_idleSubscribers.end()) {
+                m_idleSubscribers.erase(idleIter);
+            }
+        } else if (idleIter == m_idleSubscribers.end()) {
+            m_idleSubscribers.push_back(subscriber);
+        }
+
+        if (!change.m_unmappedSignalPaths.empty()) {
+            hasKnownValues = attachOrQueue(
+                subscriber, std::make_shared<ResolvedSignalSet>(
+                                std::move(change.m_unmappedSignalPaths), m_metadataAgent));
+        }
+    }
+    if (hasKnownValues) {
+        subscriber->notifyConsumer();
+    }
+}
+
+size_t SubscriptionMultiplexer::getNumUpstreams() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    pruneFinishedUpstreams();
+    return m_upstreams.size();
+}
+
+bool SubscriptionMultiplexer::attachOrQueue(const std::shared_ptr<Subscriber>&        subscriber,
+                                            const std::shared_ptr<ResolvedSignalSet>& signalSet) {
+    for (const auto& upstream : m_upstreams) {
+        switch (upstream->attach(subscriber, signalSet->getSignalPaths())) {
+        case UpstreamSubscription::AttachResult::ATTACHED:
+            return false;
+        case UpstreamSubscription::AttachResult::ATTACHED_WITH_KNOWN_VALUES:
+            return true;
+        case UpstreamSubscription::AttachResult::NOT_COVERED:
+            break;
+        }
+    }
+
+    m_pendingSubscribers.emplace_back(subscriber, signalSet);
+    if (m_pendingSubscribers.size() == 1) {
+        ThreadPool::getInstance(executors::SDK_INTERNAL)
+            ->enqueue(Job::create([self = shared_from_this()]() { self->openUpstream(); }));
+    }
+    return false;
+}
+
+void SubscriptionMultiplexer::pruneFinishedUpstreams() {
+    m_upstreams.erase(std::remove_if(m_upstreams.begin(), m_upstreams.end(),
+                                     [](const auto& upstream) { return upstream->isFinished(); }),
+                      m_upstreams.end());
+    m_idleSubscribers.erase(std::remove_if(m_idleSubscribers.begin(), m_idleSubscribers.end(),
+                                           [](const auto& subscriber) {
+                                               return subscriber->isCancelled();
+                                           }),
+                            m_idleSubscribers.end());
+}
+
+void SubscriptionMultiplexer::openUpstream() {
+    std::shared_ptr<UpstreamSubscription> upstream;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<PendingSubscriber_t> pendingSubscribers;
+        pendingSubscribers.swap(m_pendingSubscribers);
+
+        // A single subscriber keeps its prepared set, which might be resolved already
+        auto signalSet = pendingSubscribers.front().second;
+        if (pendingSubscribers.size() > 1) {
+            std::vector<std::string> signalPaths;
+            for (const auto& pendingSubscriber : pendingSubscribers) {
+                const auto& paths = pendingSubscriber.second->getSignalPaths();
+                signalPaths.insert(signalPaths.end(), paths.cbegin(), paths.cend());
+            }
+            signalSet =
+                std::make_shared<ResolvedSignalSet>(std::move(signalPaths), m_metadataAgent);
+        }
+
+        upstream = std::make_shared<UpstreamSubscription>(m_asyncBrokerFacade, m_metadataAgent,
+                                                          std::move(signalSet));
+        for (const auto& [subscriber, subscriberSignalSet] : pendingSubscribers) {
+            [[maybe_unused]] const auto result =
+                upstream->attach(subscriber, subscriberSignalSet->getSignalPaths());
+            assert(result == UpstreamSubscription::AttachResult::ATTACHED);
+        }
+        if (upstream->isUnused()) {
+            // all pending signals got removed in the meantime
+            return;
+        }
+        m_upstreams.push_back(upstream);
+    }
+    upstream->subscribe();
+}
+
+} // namespace velocitas::kuksa_val_v2
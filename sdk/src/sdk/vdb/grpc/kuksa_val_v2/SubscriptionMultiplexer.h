@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_SUBSCRIPTIONMULTIPLEXER_H
+#define VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_SUBSCRIPTIONMULTIPLEXER_H
+
+#include "sdk/AsyncResult.h"
+#include "sdk/DataPointReply.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace velocitas::kuksa_val_v2 {
+
+class BrokerAsyncGrpcFacade;
+class MetadataAgent;
+class ResolvedSignalSet;
+class Subscriber;
+class UpstreamSubscription;
+
+/**
+ * @brief Merges the subscriptions of the app into few SubscribeById streams to the databroker.
+ *
+ * A new subscription is attached to an existing stream if that covers all of its signals.
+ * Otherwise it is collected together with all other subscriptions made until the SDK's internal
+ * executor picks them up, and a single stream is opened for all of them. Updates are fanned out
+ * to all subscriptions interested in the updated signals.
+ *
+ * The signals of a subscription can be changed via AsyncSubscription::addSignals() and
+ * removeSignals(): Added signals are attached to an existing stream or to a new one, just like a
+ * new subscription, so a subscription may be fed by several streams.
+ *
+ * Subscriptions cancelled via AsyncSubscription::cancel() are detached from their stream without
+ * affecting the others; a stream is closed once its last subscription is gone.
+ */
+class SubscriptionMultiplexer : public std::enable_shared_from_this<SubscriptionMultiplexer> {
+public:
+    SubscriptionMultiplexer(std::shared_ptr<BrokerAsyncGrpcFacade> asyncBrokerFacade,
+                            std::shared_ptr<MetadataAgent>         metadataAgent);
+    ~SubscriptionMultiplexer();
+
+    /**
+     * @brief Subscribe to the signals of the passed set.
+     *
+     * @param signalSet  Set of the signals to subscribe to.
+     * @return AsyncSubscriptionPtr_t<DataPointReply>  The subscription, its replies refer to the
+     * layout of the passed set.
+     */
+    AsyncSubscriptionPtr_t<DataPointReply>
+    subscribe(const std::shared_ptr<ResolvedSignalSet>& signalSet);
+
+    /**
+     * @brief Return the number of currently open streams to the databroker.
+     */
+    [[nodiscard]] size_t getNumUpstreams();
+
+    SubscriptionMultiplexer(const SubscriptionMultiplexer&)            = delete;
+    SubscriptionMultiplexer(SubscriptionMultiplexer&&)                 = delete;
+    SubscriptionMultiplexer& operator=(const SubscriptionMultiplexer&) = delete;
+    SubscriptionMultiplexer& operator=(SubscriptionMultiplexer&&)      = delete;
+
+private:
+    using PendingSubscriber_t =
+        std::pair<std::shared_ptr<Subscriber>, std::shared_ptr<ResolvedSignalSet>>;
+
+    void changeSignals(const std::shared_ptr<Subscriber>& subscriber,
+                       const std::vector<std::string>&    addedSignalPaths,
+                       const std::vector<std::string>&    removedSignalPaths);
+
+    /**
+     * @brief Attach the signals of the passed set to an open stream covering all of them or queue
+     *        them for a new stream. Needs to be called with m_mutex held.
+     *
+     * @return true if the subscriber got known values and needs to notify its consumer.
+     */
+    bool attachOrQueue(const std::shared_ptr<Subscriber>&        subscriber,
+                       const std::shared_ptr<ResolvedSignalSet>& signalSet);
+    void openUpstream();
+    void pruneFinishedUpstreams();
+
+    std::shared_ptr<BrokerAsyncGrpcFacade>             m_asyncBrokerFacade;
+    std::shared_ptr<MetadataAgent>                     m_metadataAgent;
+    std::mutex                                         m_mutex;
+    std::vector<std::shared_ptr<UpstreamSubscription>> m_upstreams;
+    std::vector<PendingSubscriber_t>                   m_pendingSubscribers;
+    // Subscribers whose signals were all removed, i.e. which are not attached to any stream
+    std::vector<std::shared_ptr<Subscriber>>           m_idleSubscribers;
+};
+
+} // namespace velocitas::kuksa_val_v2
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_SUBSCRIPTIONMULTIPLEXER_H
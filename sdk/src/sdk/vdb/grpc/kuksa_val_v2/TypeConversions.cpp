@@ -20,6 +20,7 @@
 #include "sdk/Logger.h"
 #include "sdk/vdb/grpc/common/TypeConversions.h"
 
+#include <limits>
 #include <stdexcept>
 
 namespace velocitas::kuksa_val_v2 {
@@ -29,128 +30,110 @@ kuksa::val::v2::Value convertToGrpcValue(const DataPointValue& dataPoint) {
 
     switch (dataPoint.getType()) {
     case DataPointValue::Type::BOOL: {
-        grpcValue.set_bool_(dynamic_cast<const TypedDataPointValue<bool>*>(&dataPoint)->value());
+        grpcValue.set_bool_(dataPoint.getValueAs<bool>());
         break;
     }
     case DataPointValue::Type::BOOL_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<bool>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<bool>>();
         grpcValue.mutable_bool_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::INT8: {
-        grpcValue.set_int32(dynamic_cast<const TypedDataPointValue<int8_t>*>(&dataPoint)->value());
+        grpcValue.set_int32(dataPoint.getValueAs<int8_t>());
         break;
     }
     case DataPointValue::Type::INT8_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int8_t>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<int8_t>>();
         grpcValue.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::INT16: {
-        grpcValue.set_int32(dynamic_cast<const TypedDataPointValue<int16_t>*>(&dataPoint)->value());
+        grpcValue.set_int32(dataPoint.getValueAs<int16_t>());
         break;
     }
     case DataPointValue::Type::INT16_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int16_t>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<int16_t>>();
         grpcValue.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::INT32: {
-        grpcValue.set_int32(dynamic_cast<const TypedDataPointValue<int32_t>*>(&dataPoint)->value());
+        grpcValue.set_int32(dataPoint.getValueAs<int32_t>());
         break;
     }
     case DataPointValue::Type::INT32_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int32_t>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<int32_t>>();
         grpcValue.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::INT64: {
-        grpcValue.set_int64(dynamic_cast<const TypedDataPointValue<int64_t>*>(&dataPoint)->value());
+        grpcValue.set_int64(dataPoint.getValueAs<int64_t>());
         break;
     }
     case DataPointValue::Type::INT64_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int64_t>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<int64_t>>();
         grpcValue.mutable_int64_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::UINT8: {
-        grpcValue.set_uint32(
-            dynamic_cast<const TypedDataPointValue<uint8_t>*>(&dataPoint)->value());
+        grpcValue.set_uint32(dataPoint.getValueAs<uint8_t>());
         break;
     }
     case DataPointValue::Type::UINT8_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint8_t>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<uint8_t>>();
         grpcValue.mutable_uint32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::UINT16: {
-        grpcValue.set_uint32(
-            dynamic_cast<const TypedDataPointValue<uint16_t>*>(&dataPoint)->value());
+        grpcValue.set_uint32(dataPoint.getValueAs<uint16_t>());
         break;
     }
     case DataPointValue::Type::UINT16_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint16_t>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<uint16_t>>();
         grpcValue.mutable_uint32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::UINT32: {
-        grpcValue.set_uint32(
-            dynamic_cast<const TypedDataPointValue<uint32_t>*>(&dataPoint)->value());
+        grpcValue.set_uint32(dataPoint.getValueAs<uint32_t>());
         break;
     }
     case DataPointValue::Type::UINT32_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint32_t>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<uint32_t>>();
         grpcValue.mutable_uint32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::UINT64: {
-        grpcValue.set_uint64(
-            dynamic_cast<const TypedDataPointValue<uint64_t>*>(&dataPoint)->value());
+        grpcValue.set_uint64(dataPoint.getValueAs<uint64_t>());
         break;
     }
     case DataPointValue::Type::UINT64_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint64_t>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<uint64_t>>();
         grpcValue.mutable_uint64_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::FLOAT: {
-        grpcValue.set_float_(dynamic_cast<const TypedDataPointValue<float>*>(&dataPoint)->value());
+        grpcValue.set_float_(dataPoint.getValueAs<float>());
         break;
     }
     case DataPointValue::Type::FLOAT_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<float>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<float>>();
         grpcValue.mutable_float_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::DOUBLE: {
-        grpcValue.set_double_(
-            dynamic_cast<const TypedDataPointValue<double>*>(&dataPoint)->value());
+        grpcValue.set_double_(dataPoint.getValueAs<double>());
         break;
     }
     case DataPointValue::Type::DOUBLE_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<double>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<double>>();
         grpcValue.mutable_double_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
     case DataPointValue::Type::STRING: {
-        grpcValue.set_string(
-            dynamic_cast<const TypedDataPointValue<std::string>*>(&dataPoint)->value());
+        grpcValue.set_string(dataPoint.getValueAs<std::string>());
         break;
     }
     case DataPointValue::Type::STRING_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<std::string>>*>(&dataPoint)->value();
+        const auto& array = dataPoint.getValueAs<std::vector<std::string>>();
         grpcValue.mutable_string_array()->mutable_values()->Assign(array.cbegin(), array.cend());
         break;
     }
@@ -168,64 +151,63 @@ std::vector<DATA_TYPE> convertValueArray(const ARRAY_CLASS& arrayObject) {
     return result;
 }
 
-std::shared_ptr<DataPointValue> convertFromGrpcValue(const std::string&           path,
-                                                     const kuksa::val::v2::Value& value,
-                                                     const Timestamp&             timestamp) {
+DataPointValue convertFromGrpcValue(InternedPath path, const kuksa::val::v2::Value& value,
+                                    const Timestamp& timestamp) {
     switch (value.typed_value_case()) {
     case kuksa::val::v2::Value::TypedValueCase::kString:
-        return std::make_shared<TypedDataPointValue<std::string>>(path, value.string(), timestamp);
+        return TypedDataPointValue<std::string>(path, value.string(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kBool:
-        return std::make_shared<TypedDataPointValue<bool>>(path, value.bool_(), timestamp);
+        return TypedDataPointValue<bool>(path, value.bool_(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kInt32:
-        return std::make_shared<TypedDataPointValue<int32_t>>(path, value.int32(), timestamp);
+        return TypedDataPointValue<int32_t>(path, value.int32(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kInt64:
-        return std::make_shared<TypedDataPointValue<int64_t>>(path, value.int64(), timestamp);
+        return TypedDataPointValue<int64_t>(path, value.int64(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kUint32:
-        return std::make_shared<TypedDataPointValue<uint32_t>>(path, value.uint32(), timestamp);
+        return TypedDataPointValue<uint32_t>(path, value.uint32(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kUint64:
-        return std::make_shared<TypedDataPointValue<uint64_t>>(path, value.uint64(), timestamp);
+        return TypedDataPointValue<uint64_t>(path, value.uint64(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kFloat:
-        return std::make_shared<TypedDataPointValue<float>>(path, value.float_(), timestamp);
+        return TypedDataPointValue<float>(path, value.float_(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kDouble:
-        return std::make_shared<TypedDataPointValue<double>>(path, value.double_(), timestamp);
+        return TypedDataPointValue<double>(path, value.double_(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kStringArray:
-        return std::make_shared<TypedDataPointValue<std::vector<std::string>>>(
+        return TypedDataPointValue<std::vector<std::string>>(
             path, convertValueArray<std::string>(value.string_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kBoolArray:
-        return std::make_shared<TypedDataPointValue<std::vector<bool>>>(
+        return TypedDataPointValue<std::vector<bool>>(
             path, convertValueArray<bool>(value.bool_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kInt32Array:
-        return std::make_shared<TypedDataPointValue<std::vector<int32_t>>>(
+        return TypedDataPointValue<std::vector<int32_t>>(
             path, convertValueArray<int32_t>(value.int32_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kInt64Array:
-        return std::make_shared<TypedDataPointValue<std::vector<int64_t>>>(
+        return TypedDataPointValue<std::vector<int64_t>>(
             path, convertValueArray<int64_t>(value.int64_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kUint32Array:
-        return std::make_shared<TypedDataPointValue<std::vector<uint32_t>>>(
+        return TypedDataPointValue<std::vector<uint32_t>>(
             path, convertValueArray<uint32_t>(value.uint32_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kUint64Array:
-        return std::make_shared<TypedDataPointValue<std::vector<uint64_t>>>(
+        return TypedDataPointValue<std::vector<uint64_t>>(
             path, convertValueArray<uint64_t>(value.uint64_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kFloatArray:
-        return std::make_shared<TypedDataPointValue<std::vector<float>>>(
+        return TypedDataPointValue<std::vector<float>>(
             path, convertValueArray<float>(value.float_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kDoubleArray:
-        return std::make_shared<TypedDataPointValue<std::vector<double>>>(
+        return TypedDataPointValue<std::vector<double>>(
             path, convertValueArray<double>(value.double_array()), timestamp);
     default:
         throw RpcException("Unknown value case!");
     }
 }
 
-std::shared_ptr<DataPointValue>
-convertFromGrpcDataPoint(const std::string& path, const kuksa::val::v2::Datapoint& grpcDataPoint) {
+DataPointValue convertFromGrpcDataPoint(InternedPath                     path,
+                                        const kuksa::val::v2::Datapoint& grpcDataPoint) {
     auto timestamp = convertFromGrpcTimestamp(grpcDataPoint.timestamp());
     if (grpcDataPoint.has_value()) {
         return convertFromGrpcValue(path, grpcDataPoint.value(), timestamp);
     }
 
-    return std::make_shared<DataPointValue>(DataPointValue::Type::INVALID, path, timestamp,
-                                            DataPointValue::Failure::NOT_AVAILABLE);
+    return DataPointValue(DataPointValue::Type::INVALID, path, timestamp,
+                          DataPointValue::Failure::NOT_AVAILABLE);
 }
 
 static const std::string SELECT_STATEMENT{"SELECT "}; // NOLINT(runtime/string)
@@ -257,4 +239,11 @@ std::vector<std::string> parseQuery(const std::string& query) {
     return signalPaths;
 }
 
+int assertProtobufArrayLimits(size_t numElements) {
+    if (numElements > std::numeric_limits<int>::max()) {
+        throw std::runtime_error("# requested datapoints exceeds gRPC limits");
+    }
+    return static_cast<int>(numElements);
+}
+
 } // namespace velocitas::kuksa_val_v2
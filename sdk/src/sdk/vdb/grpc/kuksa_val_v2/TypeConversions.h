@@ -21,7 +21,6 @@
 
 #include "sdk/DataPointValue.h"
 
-#include <memory>
 #include <string>
 #include <vector>
 
@@ -29,15 +28,21 @@ namespace velocitas::kuksa_val_v2 {
 
 kuksa::val::v2::Value convertToGrpcValue(const DataPointValue& dataPoint);
 
-std::shared_ptr<DataPointValue> convertFromGrpcValue(const std::string&           path,
-                                                     const kuksa::val::v2::Value& value,
-                                                     const Timestamp&             timestamp);
+DataPointValue convertFromGrpcValue(InternedPath path, const kuksa::val::v2::Value& value,
+                                    const Timestamp& timestamp);
 
-std::shared_ptr<DataPointValue>
-convertFromGrpcDataPoint(const std::string& path, const kuksa::val::v2::Datapoint& grpcDataPoint);
+DataPointValue convertFromGrpcDataPoint(InternedPath                     path,
+                                        const kuksa::val::v2::Datapoint& grpcDataPoint);
 
 std::vector<std::string> parseQuery(const std::string& query);
 
+/**
+ * @brief Return the passed number of elements as int, the size type of repeated protobuf fields.
+ *
+ * @throw std::runtime_error if the number exceeds the limits of protobuf
+ */
+int assertProtobufArrayLimits(size_t numElements);
+
 } // namespace velocitas::kuksa_val_v2
 
 #endif // VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_TYPECONVERSIONS_H
@@ -24,26 +24,30 @@
 namespace velocitas::sdv_databroker_v1 {
 
 BrokerAsyncGrpcFacade::BrokerAsyncGrpcFacade(const std::shared_ptr<grpc::Channel>& channel)
-    : m_stub{sdv::databroker::v1::Broker::NewStub(channel)} {}
+    : AsyncGrpcFacade(channel)
+    , m_stub{sdv::databroker::v1::Broker::NewStub(channel)} {}
 
 void BrokerAsyncGrpcFacade::GetDatapoints(
     const std::vector<std::string>&                                           datapoints,
     std::function<void(const sdv::databroker::v1::GetDatapointsReply& reply)> replyHandler,
     std::function<void(const grpc::Status& status)>                           errorHandler) {
+    static const GrpcCallMetrics callMetrics{"sdv.databroker.v1.Broker/GetDatapoints"};
+
     auto callData =
         std::make_shared<GrpcSingleResponseCall<sdv::databroker::v1::GetDatapointsRequest,
                                                 sdv::databroker::v1::GetDatapointsReply>>();
 
     std::for_each(datapoints.begin(), datapoints.end(), [&callData](const auto& dataPoint) {
-        callData->m_request.add_datapoints(dataPoint);
+        callData->getRequest().add_datapoints(dataPoint);
     });
 
     applyContextModifier(*callData);
 
     const auto grpcResultHandler = [callData, replyHandler, errorHandler](grpc::Status status) {
+        callMetrics.recordCompletion(*callData, status);
         try {
             if (status.ok()) {
-                replyHandler(callData->m_response);
+                replyHandler(callData->getResponse());
             } else {
                 errorHandler(status);
             };
@@ -55,28 +59,31 @@ void BrokerAsyncGrpcFacade::GetDatapoints(
 
     addActiveCall(callData);
 
-    m_stub->async()->GetDatapoints(&callData->m_context, &callData->m_request,
-                                   &callData->m_response, grpcResultHandler);
+    m_stub->async()->GetDatapoints(&callData->m_context, &callData->getRequest(),
+                                   &callData->getResponse(), grpcResultHandler);
 }
 
 void BrokerAsyncGrpcFacade::SetDatapoints(
     const std::map<std::string, sdv::databroker::v1::Datapoint>&              datapoints,
     std::function<void(const sdv::databroker::v1::SetDatapointsReply& reply)> replyHandler,
     std::function<void(const grpc::Status& status)>                           errorHandler) {
+    static const GrpcCallMetrics callMetrics{"sdv.databroker.v1.Broker/SetDatapoints"};
+
     auto callData =
         std::make_shared<GrpcSingleResponseCall<sdv::databroker::v1::SetDatapointsRequest,
                                                 sdv::databroker::v1::SetDatapointsReply>>();
 
-    for (const auto [key, value] : datapoints) {
-        (*callData->m_request.mutable_datapoints())[key] = value;
+    for (const auto& [key, value] : datapoints) {
+        (*callData->getRequest().mutable_datapoints())[key] = value;
     }
 
     applyContextModifier(*callData);
 
     auto grpcResultHandler = [callData, replyHandler, errorHandler](grpc::Status status) {
+        callMetrics.recordCompletion(*callData, status);
         try {
             if (status.ok()) {
-                replyHandler(callData->m_response);
+                replyHandler(callData->getResponse());
             } else {
                 errorHandler(status);
             };
@@ -88,8 +95,8 @@ void BrokerAsyncGrpcFacade::SetDatapoints(
 
     addActiveCall(callData);
 
-    m_stub->async()->SetDatapoints(&callData->m_context, &callData->m_request,
-                                   &callData->m_response, grpcResultHandler);
+    m_stub->async()->SetDatapoints(&callData->m_context, &callData->getRequest(),
+                                   &callData->getResponse(), grpcResultHandler);
 }
 
 void BrokerAsyncGrpcFacade::Subscribe(
@@ -16,20 +16,23 @@
 
 #include "BrokerClient.h"
 
+#include "sdk/DataPointReply.h"
 #include "sdk/DataPointValue.h"
 #include "sdk/Exceptions.h"
 #include "sdk/Logger.h"
+#include "sdk/Metrics.h"
 
 #include "sdk/middleware/Middleware.h"
 #include "sdk/vdb/grpc/common/ChannelConfiguration.h"
 #include "sdk/vdb/grpc/sdv_databroker_v1/BrokerAsyncGrpcFacade.h"
-#include "sdk/vdb/grpc/sdv_databroker_v1/GrpcDataPointValueProvider.h"
+#include "sdk/vdb/grpc/sdv_databroker_v1/TypeConversions.h"
 
 #include <fmt/core.h>
 #include <grpcpp/channel.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
+#include <algorithm>
 #include <thread>
 #include <utility>
 
@@ -52,249 +55,19 @@ BrokerClient::BrokerClient(const std::string& vdbServiceName)
 
 BrokerClient::~BrokerClient() {}
 
-static sdv::databroker::v1::Datapoint_Failure mapToGrpcType(DataPointValue::Failure failure) {
-    switch (failure) {
-    case DataPointValue::Failure::INVALID_VALUE:
-        return sdv::databroker::v1::Datapoint_Failure_INVALID_VALUE;
-    case DataPointValue::Failure::NOT_AVAILABLE:
-        return sdv::databroker::v1::Datapoint_Failure_NOT_AVAILABLE;
-    case DataPointValue::Failure::UNKNOWN_DATAPOINT:
-        return sdv::databroker::v1::Datapoint_Failure_UNKNOWN_DATAPOINT;
-    case DataPointValue::Failure::ACCESS_DENIED:
-        return sdv::databroker::v1::Datapoint_Failure_ACCESS_DENIED;
-    case DataPointValue::Failure::INTERNAL_ERROR:
-        return sdv::databroker::v1::Datapoint_Failure_INTERNAL_ERROR;
-    default:
-        logger().error("Unknown 'DataPointValue::Failure': {}", static_cast<unsigned int>(failure));
-        assert(false);
-        return sdv::databroker::v1::Datapoint_Failure_INTERNAL_ERROR;
-    }
-}
-
-sdv::databroker::v1::Datapoint convertToGrpcDataPoint(const DataPointValue& dataPoint) {
-    sdv::databroker::v1::Datapoint grpcDataPoint{};
-
-    switch (dataPoint.getType()) {
-    case DataPointValue::Type::BOOL: {
-        grpcDataPoint.set_bool_value(
-            dynamic_cast<const TypedDataPointValue<bool>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::BOOL_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<bool>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_bool_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::DOUBLE: {
-        grpcDataPoint.set_double_value(
-            dynamic_cast<const TypedDataPointValue<double>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::DOUBLE_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<double>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_double_array()->mutable_values()->Assign(array.cbegin(),
-                                                                       array.cend());
-        break;
-    }
-    case DataPointValue::Type::FLOAT: {
-        grpcDataPoint.set_float_value(
-            dynamic_cast<const TypedDataPointValue<float>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::FLOAT_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<float>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_float_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT8: {
-        grpcDataPoint.set_int32_value(
-            dynamic_cast<const TypedDataPointValue<int8_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT8_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int8_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT16: {
-        grpcDataPoint.set_int32_value(
-            dynamic_cast<const TypedDataPointValue<int16_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT16_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int16_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT32: {
-        grpcDataPoint.set_int32_value(
-            dynamic_cast<const TypedDataPointValue<int32_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT32_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int32_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT64: {
-        grpcDataPoint.set_int64_value(
-            dynamic_cast<const TypedDataPointValue<int64_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT64_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int64_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int64_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::STRING: {
-        grpcDataPoint.set_string_value(
-            dynamic_cast<const TypedDataPointValue<std::string>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::STRING_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<std::string>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_string_array()->mutable_values()->Assign(array.cbegin(),
-                                                                       array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT8: {
-        grpcDataPoint.set_int32_value(
-            dynamic_cast<const TypedDataPointValue<uint8_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT8_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint8_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT16: {
-        grpcDataPoint.set_int32_value(
-            dynamic_cast<const TypedDataPointValue<uint16_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT16_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint16_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT32: {
-        grpcDataPoint.set_uint32_value(
-            dynamic_cast<const TypedDataPointValue<uint32_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT32_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint32_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_uint32_array()->mutable_values()->Assign(array.cbegin(),
-                                                                       array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT64: {
-        grpcDataPoint.set_uint64_value(
-            dynamic_cast<const TypedDataPointValue<uint64_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT64_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint64_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_uint64_array()->mutable_values()->Assign(array.cbegin(),
-                                                                       array.cend());
-        break;
-    }
-    default:
-        throw InvalidTypeException("");
-    }
-
-    return grpcDataPoint;
-}
-
-std::shared_ptr<DataPointValue>
-convertDataPointToInternal(const std::string&                    name,
-                           const sdv::databroker::v1::Datapoint& grpcDataPoint) {
-    GrpcDataPointValueProvider valueProvider{grpcDataPoint};
-
-    switch (grpcDataPoint.value_case()) {
-    case sdv::databroker::v1::Datapoint::ValueCase::kFailureValue:
-        return std::make_shared<DataPointValue>(DataPointValue::Type::INVALID, name,
-                                                valueProvider.getTimestamp(),
-                                                valueProvider.getFailure());
-    case sdv::databroker::v1::Datapoint::ValueCase::kStringValue:
-        return std::make_shared<TypedDataPointValue<std::string>>(
-            name, valueProvider.getStringValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kBoolValue:
-        return std::make_shared<TypedDataPointValue<bool>>(name, valueProvider.getBoolValue(),
-                                                           valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kInt32Value:
-        return std::make_shared<TypedDataPointValue<int32_t>>(name, valueProvider.getInt32Value(),
-                                                              valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kInt64Value:
-        return std::make_shared<TypedDataPointValue<int64_t>>(name, valueProvider.getInt64Value(),
-                                                              valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kUint32Value:
-        return std::make_shared<TypedDataPointValue<uint32_t>>(name, valueProvider.getUint32Value(),
-                                                               valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kUint64Value:
-        return std::make_shared<TypedDataPointValue<uint64_t>>(name, valueProvider.getUint64Value(),
-                                                               valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kFloatValue:
-        return std::make_shared<TypedDataPointValue<float>>(name, valueProvider.getFloatValue(),
-                                                            valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kDoubleValue:
-        return std::make_shared<TypedDataPointValue<double>>(name, valueProvider.getDoubleValue(),
-                                                             valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kStringArray:
-        return std::make_shared<TypedDataPointValue<std::vector<std::string>>>(
-            name, valueProvider.getStringArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kBoolArray:
-        return std::make_shared<TypedDataPointValue<std::vector<bool>>>(
-            name, valueProvider.getBoolArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kInt32Array:
-        return std::make_shared<TypedDataPointValue<std::vector<int32_t>>>(
-            name, valueProvider.getInt32ArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kInt64Array:
-        return std::make_shared<TypedDataPointValue<std::vector<int64_t>>>(
-            name, valueProvider.getInt64ArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kUint32Array:
-        return std::make_shared<TypedDataPointValue<std::vector<uint32_t>>>(
-            name, valueProvider.getUint32ArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kUint64Array:
-        return std::make_shared<TypedDataPointValue<std::vector<uint64_t>>>(
-            name, valueProvider.getUint64ArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kFloatArray:
-        return std::make_shared<TypedDataPointValue<std::vector<float>>>(
-            name, valueProvider.getFloatArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kDoubleArray:
-        return std::make_shared<TypedDataPointValue<std::vector<double>>>(
-            name, valueProvider.getDoubleArrayValue(), valueProvider.getTimestamp());
-    default:
-        throw RpcException("Unknown value case!");
-    }
-
-    return nullptr;
-}
-
 AsyncResultPtr_t<DataPointReply>
 BrokerClient::getDatapoints(const std::vector<std::string>& datapoints) {
     auto result = std::make_shared<AsyncResult<DataPointReply>>();
     m_asyncBrokerFacade->GetDatapoints(
         datapoints,
-        [result](auto reply) {
-            DataPointMap_t resultMap;
-            for (const auto [key, value] : reply.datapoints()) {
-                resultMap[key] = convertDataPointToInternal(key, value);
+        [result](const auto& reply) {
+            std::vector<DataPointValue> resultValues;
+            resultValues.reserve(reply.datapoints().size());
+            for (const auto& [key, value] : reply.datapoints()) {
+                resultValues.emplace_back(convertDataPointToInternal(InternedPath(key), value));
             }
 
-            result->insertResult(DataPointReply(std::move(resultMap)));
+            result->insertResult(DataPointReply(std::move(resultValues)));
         },
         [result](auto status) {
             result->insertError(
@@ -328,17 +101,51 @@ BrokerClient::setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>&
     return result;
 }
 
+/**
+ * @brief Check if the passed fields are exactly the data points of the passed layout.
+ */
+static bool
+hasLayout(const google::protobuf::Map<std::string, sdv::databroker::v1::Datapoint>& fields,
+          const DataPointLayout&                                                   layout) {
+    return (static_cast<size_t>(fields.size()) == layout.size()) &&
+           std::all_of(fields.cbegin(), fields.cend(), [&layout](const auto& field) {
+               return layout.findHandle(field.first) != DataPointLayout::INVALID_HANDLE;
+           });
+}
+
 AsyncSubscriptionPtr_t<DataPointReply> BrokerClient::subscribe(const std::string& query) {
+    static const MetricLabels_t labels{{"api", "sdv.databroker.v1"}};
+    static auto& receivedUpdates = MetricsRegistry::getInstance().getCounter(
+        "sdv_vdb_subscription_updates_received_total",
+        "Number of subscription updates received from the databroker", labels);
+    static auto& receivedDataPoints = MetricsRegistry::getInstance().getCounter(
+        "sdv_vdb_subscription_datapoints_received_total",
+        "Number of data point values received via subscriptions", labels);
+
     auto subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
     m_asyncBrokerFacade->Subscribe(
         query,
-        [subscription](const auto& item) {
-            DataPointMap_t resultFields;
-            const auto     fieldsMap = item.fields();
-            for (const auto& [key, value] : fieldsMap) {
-                resultFields[key] = convertDataPointToInternal(key, value);
+        [subscription, layout = std::shared_ptr<const DataPointLayout>()](
+            const auto& item) mutable {
+            // Updates mostly carry the same fields, so their layout is only built on changes
+            const auto& fields = item.fields();
+            if (!layout || !hasLayout(fields, *layout)) {
+                std::vector<std::string> paths;
+                paths.reserve(fields.size());
+                for (const auto& field : fields) {
+                    paths.emplace_back(field.first);
+                }
+                layout = std::make_shared<const DataPointLayout>(std::move(paths));
+            }
+
+            auto values = std::make_shared<DataPointValues_t>(layout->size());
+            for (const auto& [key, value] : fields) {
+                const auto slot = layout->findHandle(key);
+                (*values)[slot] = convertDataPointToInternal(layout->getInternedPath(slot), value);
             }
-            subscription->insertNewItem(DataPointReply(std::move(resultFields)));
+            subscription->insertNewItem(DataPointReply(layout, std::move(values)));
+            receivedUpdates.increment();
+            receivedDataPoints.increment(fields.size());
         },
         [subscription](const auto& status) {
             subscription->insertError(
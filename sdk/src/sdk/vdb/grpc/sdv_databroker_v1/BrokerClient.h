@@ -43,6 +43,9 @@ public:
     BrokerClient& operator=(const BrokerClient&) = delete;
     BrokerClient& operator=(BrokerClient&&)      = delete;
 
+    // Reads passing a ReadPolicy are served by the default implementation
+    using IVehicleDataBrokerClient::getDatapoints;
+
     AsyncResultPtr_t<DataPointReply>
     getDatapoints(const std::vector<std::string>& datapoints) override;
 
@@ -23,19 +23,20 @@
 
 namespace velocitas::sdv_databroker_v1 {
 
-GrpcDataPointValueProvider::GrpcDataPointValueProvider(sdv::databroker::v1::Datapoint datapoint)
-    : m_datapoint(std::move(datapoint)) {}
+GrpcDataPointValueProvider::GrpcDataPointValueProvider(
+    const sdv::databroker::v1::Datapoint& datapoint)
+    : m_datapoint(&datapoint) {}
 
 const sdv::databroker::v1::Datapoint& GrpcDataPointValueProvider::getDataPoint() const {
-    return m_datapoint;
+    return *m_datapoint;
 }
 
 DataPointValue::Failure GrpcDataPointValueProvider::getFailure() const {
-    if (!m_datapoint.has_failure_value()) {
+    if (!m_datapoint->has_failure_value()) {
         return DataPointValue::Failure::NONE;
     }
 
-    switch (m_datapoint.failure_value()) {
+    switch (m_datapoint->failure_value()) {
     case sdv::databroker::v1::Datapoint_Failure_INVALID_VALUE:
         return DataPointValue::Failure::INVALID_VALUE;
     case sdv::databroker::v1::Datapoint_Failure_NOT_AVAILABLE:
@@ -48,16 +49,16 @@ DataPointValue::Failure GrpcDataPointValueProvider::getFailure() const {
         return DataPointValue::Failure::INTERNAL_ERROR;
     default:
         logger().error("Unknown 'DataPointValue::Failure': {}",
-                       static_cast<int>(m_datapoint.failure_value()));
+                       static_cast<int>(m_datapoint->failure_value()));
         assert(false);
         return DataPointValue::Failure::INTERNAL_ERROR;
     }
 }
 
-bool GrpcDataPointValueProvider::getBoolValue() const { return m_datapoint.bool_value(); }
+bool GrpcDataPointValueProvider::getBoolValue() const { return m_datapoint->bool_value(); }
 
 std::vector<bool> GrpcDataPointValueProvider::getBoolArrayValue() const {
-    auto              valueArray = getDataPoint().bool_array().values();
+    const auto&       valueArray = getDataPoint().bool_array().values();
     std::vector<bool> result{valueArray.cbegin(), valueArray.cend()};
     return result;
 }
@@ -65,7 +66,7 @@ std::vector<bool> GrpcDataPointValueProvider::getBoolArrayValue() const {
 float GrpcDataPointValueProvider::getFloatValue() const { return getDataPoint().float_value(); }
 
 std::vector<float> GrpcDataPointValueProvider::getFloatArrayValue() const {
-    auto               valueArray = getDataPoint().float_array().values();
+    const auto&        valueArray = getDataPoint().float_array().values();
     std::vector<float> result{valueArray.cbegin(), valueArray.cend()};
     return result;
 }
@@ -73,7 +74,7 @@ std::vector<float> GrpcDataPointValueProvider::getFloatArrayValue() const {
 double GrpcDataPointValueProvider::getDoubleValue() const { return getDataPoint().double_value(); }
 
 std::vector<double> GrpcDataPointValueProvider::getDoubleArrayValue() const {
-    auto                valueArray = getDataPoint().double_array().values();
+    const auto&         valueArray = getDataPoint().double_array().values();
     std::vector<double> result{valueArray.cbegin(), valueArray.cend()};
     return result;
 }
@@ -86,7 +87,7 @@ int8_t GrpcDataPointValueProvider::getInt8Value() const {
 }
 
 std::vector<int8_t> GrpcDataPointValueProvider::getInt8ArrayValue() const {
-    auto                valueArray = getDataPoint().int32_array().values();
+    const auto&         valueArray = getDataPoint().int32_array().values();
     std::vector<int8_t> result;
     result.reserve(valueArray.size());
     for (const auto value : valueArray) {
@@ -105,7 +106,7 @@ int16_t GrpcDataPointValueProvider::getInt16Value() const {
 }
 
 std::vector<int16_t> GrpcDataPointValueProvider::getInt16ArrayValue() const {
-    auto                 valueArray = getDataPoint().int32_array().values();
+    const auto&          valueArray = getDataPoint().int32_array().values();
     std::vector<int16_t> result;
     result.reserve(valueArray.size());
     for (const auto value : valueArray) {
@@ -119,7 +120,7 @@ std::vector<int16_t> GrpcDataPointValueProvider::getInt16ArrayValue() const {
 int32_t GrpcDataPointValueProvider::getInt32Value() const { return getDataPoint().int32_value(); }
 
 std::vector<int32_t> GrpcDataPointValueProvider::getInt32ArrayValue() const {
-    auto                 valueArray = getDataPoint().int32_array().values();
+    const auto&          valueArray = getDataPoint().int32_array().values();
     std::vector<int32_t> result{valueArray.cbegin(), valueArray.cend()};
     return result;
 }
@@ -127,7 +128,7 @@ std::vector<int32_t> GrpcDataPointValueProvider::getInt32ArrayValue() const {
 int64_t GrpcDataPointValueProvider::getInt64Value() const { return getDataPoint().int64_value(); }
 
 std::vector<int64_t> GrpcDataPointValueProvider::getInt64ArrayValue() const {
-    auto                 valueArray = getDataPoint().int64_array().values();
+    const auto&          valueArray = getDataPoint().int64_array().values();
     std::vector<int64_t> result{valueArray.cbegin(), valueArray.cend()};
     return result;
 }
@@ -140,7 +141,7 @@ uint8_t GrpcDataPointValueProvider::getUint8Value() const {
 }
 
 std::vector<uint8_t> GrpcDataPointValueProvider::getUint8ArrayValue() const {
-    auto                 valueArray = getDataPoint().uint32_array().values();
+    const auto&          valueArray = getDataPoint().uint32_array().values();
     std::vector<uint8_t> result;
     result.reserve(valueArray.size());
     for (const auto value : valueArray) {
@@ -159,7 +160,7 @@ uint16_t GrpcDataPointValueProvider::getUint16Value() const {
 }
 
 std::vector<uint16_t> GrpcDataPointValueProvider::getUint16ArrayValue() const {
-    auto                  valueArray = getDataPoint().uint32_array().values();
+    const auto&           valueArray = getDataPoint().uint32_array().values();
     std::vector<uint16_t> result;
     result.reserve(valueArray.size());
     for (const auto value : valueArray) {
@@ -175,7 +176,7 @@ uint32_t GrpcDataPointValueProvider::getUint32Value() const {
 }
 
 std::vector<uint32_t> GrpcDataPointValueProvider::getUint32ArrayValue() const {
-    auto                  valueArray = getDataPoint().uint32_array().values();
+    const auto&           valueArray = getDataPoint().uint32_array().values();
     std::vector<uint32_t> result{valueArray.cbegin(), valueArray.cend()};
     return result;
 }
@@ -185,7 +186,7 @@ uint64_t GrpcDataPointValueProvider::getUint64Value() const {
 }
 
 std::vector<uint64_t> GrpcDataPointValueProvider::getUint64ArrayValue() const {
-    auto                  valueArray = getDataPoint().uint64_array().values();
+    const auto&           valueArray = getDataPoint().uint64_array().values();
     std::vector<uint64_t> result{valueArray.cbegin(), valueArray.cend()};
     return result;
 }
@@ -195,13 +196,13 @@ std::string GrpcDataPointValueProvider::getStringValue() const {
 }
 
 std::vector<std::string> GrpcDataPointValueProvider::getStringArrayValue() const {
-    auto                     valueArray = getDataPoint().string_array().values();
+    const auto&              valueArray = getDataPoint().string_array().values();
     std::vector<std::string> result{valueArray.cbegin(), valueArray.cend()};
     return result;
 }
 
 Timestamp GrpcDataPointValueProvider::getTimestamp() const {
-    return {m_datapoint.timestamp().seconds(), m_datapoint.timestamp().nanos()};
+    return {m_datapoint->timestamp().seconds(), m_datapoint->timestamp().nanos()};
 }
 
 } // namespace velocitas::sdv_databroker_v1
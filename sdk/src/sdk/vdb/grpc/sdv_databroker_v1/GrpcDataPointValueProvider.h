@@ -25,7 +25,11 @@ namespace velocitas::sdv_databroker_v1 {
  */
 class GrpcDataPointValueProvider : public IDataPointValueProvider {
 public:
-    explicit GrpcDataPointValueProvider(sdv::databroker::v1::Datapoint datapoint);
+    /**
+     * @brief Construct a provider reading from the passed data point, which needs to outlive the
+     *        provider. The data point is not copied.
+     */
+    explicit GrpcDataPointValueProvider(const sdv::databroker::v1::Datapoint& datapoint);
 
     DataPointValue::Failure  getFailure() const override;
     bool                     getBoolValue() const override;
@@ -58,7 +62,7 @@ protected:
     const sdv::databroker::v1::Datapoint& getDataPoint() const;
 
 private:
-    sdv::databroker::v1::Datapoint m_datapoint;
+    const sdv::databroker::v1::Datapoint* m_datapoint;
 };
 
 } // namespace velocitas::sdv_databroker_v1
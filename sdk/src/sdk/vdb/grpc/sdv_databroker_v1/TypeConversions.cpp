@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2022-2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "TypeConversions.h"
+
+#include "sdk/Exceptions.h"
+#include "sdk/Logger.h"
+#include "sdk/vdb/grpc/sdv_databroker_v1/GrpcDataPointValueProvider.h"
+
+#include <cassert>
+
+namespace velocitas::sdv_databroker_v1 {
+
+namespace {
+
+sdv::databroker::v1::Datapoint_Failure mapToGrpcType(DataPointValue::Failure failure) {
+    switch (failure) {
+    case DataPointValue::Failure::INVALID_VALUE:
+        return sdv::databroker::v1::Datapoint_Failure_INVALID_VALUE;
+    case DataPointValue::Failure::NOT_AVAILABLE:
+        return sdv::databroker::v1::Datapoint_Failure_NOT_AVAILABLE;
+    case DataPointValue::Failure::UNKNOWN_DATAPOINT:
+        return sdv::databroker::v1::Datapoint_Failure_UNKNOWN_DATAPOINT;
+    case DataPointValue::Failure::ACCESS_DENIED:
+        return sdv::databroker::v1::Datapoint_Failure_ACCESS_DENIED;
+    case DataPointValue::Failure::INTERNAL_ERROR:
+        return sdv::databroker::v1::Datapoint_Failure_INTERNAL_ERROR;
+    default:
+        logger().error("Unknown 'DataPointValue::Failure': {}", static_cast<unsigned int>(failure));
+        assert(false);
+        return sdv::databroker::v1::Datapoint_Failure_INTERNAL_ERROR;
+    }
+}
+
+} // namespace
+
+sdv::databroker::v1::Datapoint convertToGrpcDataPoint(const DataPointValue& dataPoint) {
+    sdv::databroker::v1::Datapoint grpcDataPoint{};
+
+    switch (dataPoint.getType()) {
+    case DataPointValue::Type::BOOL: {
+        grpcDataPoint.set_bool_value(dataPoint.getValueAs<bool>());
+        break;
+    }
+    case DataPointValue::Type::BOOL_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<bool>>();
+        grpcDataPoint.mutable_bool_array()->mutable_values()->Assign(array.cbegin(), array.cend());
+        break;
+    }
+    case DataPointValue::Type::DOUBLE: {
+        grpcDataPoint.set_double_value(dataPoint.getValueAs<double>());
+        break;
+    }
+    case DataPointValue::Type::DOUBLE_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<double>>();
+        grpcDataPoint.mutable_double_array()->mutable_values()->Assign(array.cbegin(),
+                                                                       array.cend());
+        break;
+    }
+    case DataPointValue::Type::FLOAT: {
+        grpcDataPoint.set_float_value(dataPoint.getValueAs<float>());
+        break;
+    }
+    case DataPointValue::Type::FLOAT_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<float>>();
+        grpcDataPoint.mutable_float_array()->mutable_values()->Assign(array.cbegin(), array.cend());
+        break;
+    }
+    case DataPointValue::Type::INT8: {
+        grpcDataPoint.set_int32_value(dataPoint.getValueAs<int8_t>());
+        break;
+    }
+    case DataPointValue::Type::INT8_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<int8_t>>();
+        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
+        break;
+    }
+    case DataPointValue::Type::INT16: {
+        grpcDataPoint.set_int32_value(dataPoint.getValueAs<int16_t>());
+        break;
+    }
+    case DataPointValue::Type::INT16_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<int16_t>>();
+        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
+        break;
+    }
+    case DataPointValue::Type::INT32: {
+        grpcDataPoint.set_int32_value(dataPoint.getValueAs<int32_t>());
+        break;
+    }
+    case DataPointValue::Type::INT32_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<int32_t>>();
+        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
+        break;
+    }
+    case DataPointValue::Type::INT64: {
+        grpcDataPoint.set_int64_value(dataPoint.getValueAs<int64_t>());
+        break;
+    }
+    case DataPointValue::Type::INT64_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<int64_t>>();
+        grpcDataPoint.mutable_int64_array()->mutable_values()->Assign(array.cbegin(), array.cend());
+        break;
+    }
+    case DataPointValue::Type::STRING: {
+        grpcDataPoint.set_string_value(dataPoint.getValueAs<std::string>());
+        break;
+    }
+    case DataPointValue::Type::STRING_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<std::string>>();
+        grpcDataPoint.mutable_string_array()->mutable_values()->Assign(array.cbegin(),
+                                                                       array.cend());
+        break;
+    }
+    case DataPointValue::Type::UINT8: {
+        grpcDataPoint.set_int32_value(dataPoint.getValueAs<uint8_t>());
+        break;
+    }
+    case DataPointValue::Type::UINT8_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<uint8_t>>();
+        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
+        break;
+    }
+    case DataPointValue::Type::UINT16: {
+        grpcDataPoint.set_int32_value(dataPoint.getValueAs<uint16_t>());
+        break;
+    }
+    case DataPointValue::Type::UINT16_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<uint16_t>>();
+        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
+        break;
+    }
+    case DataPointValue::Type::UINT32: {
+        grpcDataPoint.set_uint32_value(dataPoint.getValueAs<uint32_t>());
+        break;
+    }
+    case DataPointValue::Type::UINT32_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<uint32_t>>();
+        grpcDataPoint.mutable_uint32_array()->mutable_values()->Assign(array.cbegin(),
+                                                                       array.cend());
+        break;
+    }
+    case DataPointValue::Type::UINT64: {
+        grpcDataPoint.set_uint64_value(dataPoint.getValueAs<uint64_t>());
+        break;
+    }
+    case DataPointValue::Type::UINT64_ARRAY: {
+        const auto& array = dataPoint.getValueAs<std::vector<uint64_t>>();
+        grpcDataPoint.mutable_uint64_array()->mutable_values()->Assign(array.cbegin(),
+                                                                       array.cend());
+        break;
+    }
+    default:
+        throw InvalidTypeException("");
+    }
+
+    return grpcDataPoint;
+}
+
+DataPointValue convertDataPointToInternal(InternedPath                          name,
+                                          const sdv::databroker::v1::Datapoint& grpcDataPoint) {
+    GrpcDataPointValueProvider valueProvider{grpcDataPoint};
+
+    switch (grpcDataPoint.value_case()) {
+    case sdv::databroker::v1::Datapoint::ValueCase::kFailureValue:
+        return DataPointValue(DataPointValue::Type::INVALID, name, valueProvider.getTimestamp(),
+                              valueProvider.getFailure());
+    case sdv::databroker::v1::Datapoint::ValueCase::kStringValue:
+        return TypedDataPointValue<std::string>(name, valueProvider.getStringValue(),
+                                                valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kBoolValue:
+        return TypedDataPointValue<bool>(name, valueProvider.getBoolValue(),
+                                         valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kInt32Value:
+        return TypedDataPointValue<int32_t>(name, valueProvider.getInt32Value(),
+                                            valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kInt64Value:
+        return TypedDataPointValue<int64_t>(name, valueProvider.getInt64Value(),
+                                            valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kUint32Value:
+        return TypedDataPointValue<uint32_t>(name, valueProvider.getUint32Value(),
+                                             valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kUint64Value:
+        return TypedDataPointValue<uint64_t>(name, valueProvider.getUint64Value(),
+                                             valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kFloatValue:
+        return TypedDataPointValue<float>(name, valueProvider.getFloatValue(),
+                                          valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kDoubleValue:
+        return TypedDataPointValue<double>(name, valueProvider.getDoubleValue(),
+                                           valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kStringArray:
+        return TypedDataPointValue<std::vector<std::string>>(
+            name, valueProvider.getStringArrayValue(), valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kBoolArray:
+        return TypedDataPointValue<std::vector<bool>>(
+            name, valueProvider.getBoolArrayValue(), valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kInt32Array:
+        return TypedDataPointValue<std::vector<int32_t>>(
+            name, valueProvider.getInt32ArrayValue(), valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kInt64Array:
+        return TypedDataPointValue<std::vector<int64_t>>(
+            name, valueProvider.getInt64ArrayValue(), valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kUint32Array:
+        return TypedDataPointValue<std::vector<uint32_t>>(
+            name, valueProvider.getUint32ArrayValue(), valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kUint64Array:
+        return TypedDataPointValue<std::vector<uint64_t>>(
+            name, valueProvider.getUint64ArrayValue(), valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kFloatArray:
+        return TypedDataPointValue<std::vector<float>>(
+            name, valueProvider.getFloatArrayValue(), valueProvider.getTimestamp());
+    case sdv::databroker::v1::Datapoint::ValueCase::kDoubleArray:
+        return TypedDataPointValue<std::vector<double>>(
+            name, valueProvider.getDoubleArrayValue(), valueProvider.getTimestamp());
+    default:
+        throw RpcException("Unknown value case!");
+    }
+}
+
+} // namespace velocitas::sdv_databroker_v1
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) 2022-2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_SDV_DATABROKER_V1_TYPECONVERSIONS_H
+#define VEHICLE_APP_SDK_VDB_GRPC_SDV_DATABROKER_V1_TYPECONVERSIONS_H
+
+#include "sdv/databroker/v1/types.grpc.pb.h"
+
+#include "sdk/DataPointValue.h"
+
+namespace velocitas::sdv_databroker_v1 {
+
+sdv::databroker::v1::Datapoint convertToGrpcDataPoint(const DataPointValue& dataPoint);
+
+DataPointValue convertDataPointToInternal(InternedPath                          name,
+                                          const sdv::databroker::v1::Datapoint& grpcDataPoint);
+
+} // namespace velocitas::sdv_databroker_v1
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_SDV_DATABROKER_V1_TYPECONVERSIONS_H
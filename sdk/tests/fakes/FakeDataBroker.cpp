@@ -0,0 +1,878 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "FakeDataBroker.h"
+
+#include "kuksa/val/v2/val.grpc.pb.h"
+#include "sdv/databroker/v1/broker.grpc.pb.h"
+
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
+
+#include <fmt/core.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <algorithm>
+#include <deque>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+// NOLINTBEGIN(runtime/string)
+const std::string GET_VALUES{"kuksa.val.v2.VAL/GetValues"};
+const std::string SUBSCRIBE_BY_ID{"kuksa.val.v2.VAL/SubscribeById"};
+const std::string BATCH_ACTUATE{"kuksa.val.v2.VAL/BatchActuate"};
+const std::string LIST_METADATA{"kuksa.val.v2.VAL/ListMetadata"};
+const std::string GET_SERVER_INFO{"kuksa.val.v2.VAL/GetServerInfo"};
+const std::string GET_DATAPOINTS{"sdv.databroker.v1.Broker/GetDatapoints"};
+const std::string SET_DATAPOINTS{"sdv.databroker.v1.Broker/SetDatapoints"};
+const std::string SUBSCRIBE{"sdv.databroker.v1.Broker/Subscribe"};
+// NOLINTEND(runtime/string)
+
+// Interval in which waiting subscription streams check whether the client cancelled the call
+constexpr std::chrono::milliseconds CANCELLATION_CHECK_INTERVAL{50};
+constexpr std::chrono::seconds      SHUTDOWN_TIMEOUT{1};
+
+google::protobuf::Timestamp getCurrentTimestamp() {
+    const auto sinceEpoch = std::chrono::system_clock::now().time_since_epoch();
+    const auto seconds    = std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch);
+    google::protobuf::Timestamp timestamp;
+    timestamp.set_seconds(seconds.count());
+    timestamp.set_nanos(static_cast<int32_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch - seconds).count()));
+    return timestamp;
+}
+
+google::protobuf::Timestamp convertToGrpcTimestamp(const Timestamp& timestamp) {
+    if (timestamp == Timestamp{}) {
+        return getCurrentTimestamp();
+    }
+    google::protobuf::Timestamp grpcTimestamp;
+    grpcTimestamp.set_seconds(timestamp.seconds);
+    grpcTimestamp.set_nanos(timestamp.nanos);
+    return grpcTimestamp;
+}
+
+/**
+ * @brief Value of the passed type derived from the counter of the generated update. Arrays
+ *        carry a single element.
+ *
+ * @throw std::invalid_argument if values of the passed type cannot be generated.
+ */
+kuksa::val::v2::Value createGeneratedValue(kuksa::val::v2::DataType dataType, uint64_t counter) {
+    // small enough to fit any numeric type
+    const auto            number = counter % 100;
+    kuksa::val::v2::Value value;
+    switch (dataType) {
+    case kuksa::val::v2::DATA_TYPE_STRING:
+        value.set_string(std::to_string(counter));
+        break;
+    case kuksa::val::v2::DATA_TYPE_BOOLEAN:
+        value.set_bool_((counter % 2) == 1);
+        break;
+    case kuksa::val::v2::DATA_TYPE_INT8:
+    case kuksa::val::v2::DATA_TYPE_INT16:
+    case kuksa::val::v2::DATA_TYPE_INT32:
+        value.set_int32(static_cast<int32_t>(number));
+        break;
+    case kuksa::val::v2::DATA_TYPE_INT64:
+        value.set_int64(static_cast<int64_t>(number));
+        break;
+    case kuksa::val::v2::DATA_TYPE_UINT8:
+    case kuksa::val::v2::DATA_TYPE_UINT16:
+    case kuksa::val::v2::DATA_TYPE_UINT32:
+        value.set_uint32(static_cast<uint32_t>(number));
+        break;
+    case kuksa::val::v2::DATA_TYPE_UINT64:
+        value.set_uint64(number);
+        break;
+    case kuksa::val::v2::DATA_TYPE_FLOAT:
+        value.set_float_(static_cast<float>(number));
+        break;
+    case kuksa::val::v2::DATA_TYPE_DOUBLE:
+        value.set_double_(static_cast<double>(number));
+        break;
+    case kuksa::val::v2::DATA_TYPE_STRING_ARRAY:
+        value.mutable_string_array()->add_values(std::to_string(counter));
+        break;
+    case kuksa::val::v2::DATA_TYPE_BOOLEAN_ARRAY:
+        value.mutable_bool_array()->add_values((counter % 2) == 1);
+        break;
+    case kuksa::val::v2::DATA_TYPE_INT8_ARRAY:
+    case kuksa::val::v2::DATA_TYPE_INT16_ARRAY:
+    case kuksa::val::v2::DATA_TYPE_INT32_ARRAY:
+        value.mutable_int32_array()->add_values(static_cast<int32_t>(number));
+        break;
+    case kuksa::val::v2::DATA_TYPE_INT64_ARRAY:
+        value.mutable_int64_array()->add_values(static_cast<int64_t>(number));
+        break;
+    case kuksa::val::v2::DATA_TYPE_UINT8_ARRAY:
+    case kuksa::val::v2::DATA_TYPE_UINT16_ARRAY:
+    case kuksa::val::v2::DATA_TYPE_UINT32_ARRAY:
+        value.mutable_uint32_array()->add_values(static_cast<uint32_t>(number));
+        break;
+    case kuksa::val::v2::DATA_TYPE_UINT64_ARRAY:
+        value.mutable_uint64_array()->add_values(number);
+        break;
+    case kuksa::val::v2::DATA_TYPE_FLOAT_ARRAY:
+        value.mutable_float_array()->add_values(static_cast<float>(number));
+        break;
+    case kuksa::val::v2::DATA_TYPE_DOUBLE_ARRAY:
+        value.mutable_double_array()->add_values(static_cast<double>(number));
+        break;
+    default:
+        throw std::invalid_argument(
+            fmt::format("Cannot generate values of data type {}", static_cast<int>(dataType)));
+    }
+    return value;
+}
+
+sdv::databroker::v1::Datapoint convertToV1DataPoint(const kuksa::val::v2::Datapoint& dataPoint) {
+    sdv::databroker::v1::Datapoint v1DataPoint;
+    *v1DataPoint.mutable_timestamp() = dataPoint.timestamp();
+    const auto& value                = dataPoint.value();
+    switch (value.typed_value_case()) {
+    case kuksa::val::v2::Value::kString:
+        v1DataPoint.set_string_value(value.string());
+        break;
+    case kuksa::val::v2::Value::kBool:
+        v1DataPoint.set_bool_value(value.bool_());
+        break;
+    case kuksa::val::v2::Value::kInt32:
+        v1DataPoint.set_int32_value(value.int32());
+        break;
+    case kuksa::val::v2::Value::kInt64:
+        v1DataPoint.set_int64_value(value.int64());
+        break;
+    case kuksa::val::v2::Value::kUint32:
+        v1DataPoint.set_uint32_value(value.uint32());
+        break;
+    case kuksa::val::v2::Value::kUint64:
+        v1DataPoint.set_uint64_value(value.uint64());
+        break;
+    case kuksa::val::v2::Value::kFloat:
+        v1DataPoint.set_float_value(value.float_());
+        break;
+    case kuksa::val::v2::Value::kDouble:
+        v1DataPoint.set_double_value(value.double_());
+        break;
+    case kuksa::val::v2::Value::kStringArray:
+        *v1DataPoint.mutable_string_array()->mutable_values() = value.string_array().values();
+        break;
+    case kuksa::val::v2::Value::kBoolArray:
+        *v1DataPoint.mutable_bool_array()->mutable_values() = value.bool_array().values();
+        break;
+    case kuksa::val::v2::Value::kInt32Array:
+        *v1DataPoint.mutable_int32_array()->mutable_values() = value.int32_array().values();
+        break;
+    case kuksa::val::v2::Value::kInt64Array:
+        *v1DataPoint.mutable_int64_array()->mutable_values() = value.int64_array().values();
+        break;
+    case kuksa::val::v2::Value::kUint32Array:
+        *v1DataPoint.mutable_uint32_array()->mutable_values() = value.uint32_array().values();
+        break;
+    case kuksa::val::v2::Value::kUint64Array:
+        *v1DataPoint.mutable_uint64_array()->mutable_values() = value.uint64_array().values();
+        break;
+    case kuksa::val::v2::Value::kFloatArray:
+        *v1DataPoint.mutable_float_array()->mutable_values() = value.float_array().values();
+        break;
+    case kuksa::val::v2::Value::kDoubleArray:
+        *v1DataPoint.mutable_double_array()->mutable_values() = value.double_array().values();
+        break;
+    default:
+        v1DataPoint.set_failure_value(sdv::databroker::v1::Datapoint_Failure_NOT_AVAILABLE);
+        break;
+    }
+    return v1DataPoint;
+}
+
+std::optional<kuksa::val::v2::Value>
+convertFromV1DataPoint(const sdv::databroker::v1::Datapoint& v1DataPoint) {
+    kuksa::val::v2::Value value;
+    switch (v1DataPoint.value_case()) {
+    case sdv::databroker::v1::Datapoint::kStringValue:
+        value.set_string(v1DataPoint.string_value());
+        break;
+    case sdv::databroker::v1::Datapoint::kBoolValue:
+        value.set_bool_(v1DataPoint.bool_value());
+        break;
+    case sdv::databroker::v1::Datapoint::kInt32Value:
+        value.set_int32(v1DataPoint.int32_value());
+        break;
+    case sdv::databroker::v1::Datapoint::kInt64Value:
+        value.set_int64(v1DataPoint.int64_value());
+        break;
+    case sdv::databroker::v1::Datapoint::kUint32Value:
+        value.set_uint32(v1DataPoint.uint32_value());
+        break;
+    case sdv::databroker::v1::Datapoint::kUint64Value:
+        value.set_uint64(v1DataPoint.uint64_value());
+        break;
+    case sdv::databroker::v1::Datapoint::kFloatValue:
+        value.set_float_(v1DataPoint.float_value());
+        break;
+    case sdv::databroker::v1::Datapoint::kDoubleValue:
+        value.set_double_(v1DataPoint.double_value());
+        break;
+    case sdv::databroker::v1::Datapoint::kStringArray:
+        *value.mutable_string_array()->mutable_values() = v1DataPoint.string_array().values();
+        break;
+    case sdv::databroker::v1::Datapoint::kBoolArray:
+        *value.mutable_bool_array()->mutable_values() = v1DataPoint.bool_array().values();
+        break;
+    case sdv::databroker::v1::Datapoint::kInt32Array:
+        *value.mutable_int32_array()->mutable_values() = v1DataPoint.int32_array().values();
+        break;
+    case sdv::databroker::v1::Datapoint::kInt64Array:
+        *value.mutable_int64_array()->mutable_values() = v1DataPoint.int64_array().values();
+        break;
+    case sdv::databroker::v1::Datapoint::kUint32Array:
+        *value.mutable_uint32_array()->mutable_values() = v1DataPoint.uint32_array().values();
+        break;
+    case sdv::databroker::v1::Datapoint::kUint64Array:
+        *value.mutable_uint64_array()->mutable_values() = v1DataPoint.uint64_array().values();
+        break;
+    case sdv::databroker::v1::Datapoint::kFloatArray:
+        *value.mutable_float_array()->mutable_values() = v1DataPoint.float_array().values();
+        break;
+    case sdv::databroker::v1::Datapoint::kDoubleArray:
+        *value.mutable_double_array()->mutable_values() = v1DataPoint.double_array().values();
+        break;
+    default:
+        return std::nullopt;
+    }
+    return value;
+}
+
+bool isWithinBranch(const std::string& path, const std::string& branch) {
+    return branch.empty() || path == branch ||
+           ((path.size() > branch.size()) && (path.compare(0, branch.size(), branch) == 0) &&
+            (path[branch.size()] == '.'));
+}
+
+} // namespace
+
+struct FakeDataBroker::Update {
+    std::vector<std::pair<size_t, kuksa::val::v2::Datapoint>> m_values;
+};
+
+/**
+ * @brief One open subscription stream. Updates are queued by the publishing thread and written
+ *        by the thread serving the stream.
+ */
+class FakeDataBroker::Subscription {
+public:
+    Subscription(std::vector<size_t> signalIndices, size_t numSignals)
+        : m_signalIndices(std::move(signalIndices))
+        , m_isSubscribed(numSignals, false) {
+        for (const auto index : m_signalIndices) {
+            m_isSubscribed[index] = true;
+        }
+    }
+
+    [[nodiscard]] const std::vector<size_t>& getSignalIndices() const { return m_signalIndices; }
+
+    [[nodiscard]] bool isInterestedIn(const Update& update) const {
+        return std::any_of(update.m_values.cbegin(), update.m_values.cend(),
+                           [this](const auto& value) { return m_isSubscribed[value.first]; });
+    }
+
+    /**
+     * @brief Queue the passed update.
+     *
+     * @return false if the oldest queued update had to be dropped.
+     */
+    bool push(const std::shared_ptr<const Update>& update) {
+        std::lock_guard lock(m_mutex);
+        if (m_endStatus) {
+            return true;
+        }
+        bool isDropping = m_pendingUpdates.size() >= MAX_PENDING_UPDATES;
+        if (isDropping) {
+            m_pendingUpdates.pop_front();
+        }
+        m_pendingUpdates.push_back(update);
+        m_updatesAvailable.notify_one();
+        return !isDropping;
+    }
+
+    void end(const grpc::Status& status) {
+        std::lock_guard lock(m_mutex);
+        if (!m_endStatus) {
+            m_endStatus = status;
+            m_updatesAvailable.notify_one();
+        }
+    }
+
+    /**
+     * @brief Write the queued updates to the stream until the subscription is ended or
+     *        cancelled by the client.
+     *
+     * @param addValue Adds a value, passed as signal index and data point, to a response.
+     * @return The status to end the stream with.
+     */
+    template <typename TResponse, typename TAddValue>
+    grpc::Status serve(grpc::ServerContext& context, grpc::ServerWriter<TResponse>& writer,
+                       TAddValue addValue) {
+        std::deque<std::shared_ptr<const Update>> updates;
+        while (true) {
+            if (auto endStatus = waitForUpdates(context, updates)) {
+                return *endStatus;
+            }
+            for (const auto& update : updates) {
+                TResponse response;
+                for (const auto& [index, dataPoint] : update->m_values) {
+                    if (m_isSubscribed[index]) {
+                        addValue(response, index, dataPoint);
+                    }
+                }
+                if (!writer.Write(response)) {
+                    return grpc::Status(grpc::StatusCode::CANCELLED, "Stream closed by client");
+                }
+            }
+            updates.clear();
+        }
+    }
+
+private:
+    std::optional<grpc::Status> waitForUpdates(grpc::ServerContext&                       context,
+                                               std::deque<std::shared_ptr<const Update>>& updates) {
+        std::unique_lock lock(m_mutex);
+        while (!m_endStatus && m_pendingUpdates.empty()) {
+            if (context.IsCancelled()) {
+                return grpc::Status(grpc::StatusCode::CANCELLED, "Subscription cancelled");
+            }
+            m_updatesAvailable.wait_for(lock, CANCELLATION_CHECK_INTERVAL);
+        }
+        if (m_endStatus) {
+            return m_endStatus;
+        }
+        updates.swap(m_pendingUpdates);
+        return std::nullopt;
+    }
+
+    const std::vector<size_t>                 m_signalIndices;
+    std::vector<bool>                         m_isSubscribed;
+    std::mutex                                m_mutex;
+    std::condition_variable                   m_updatesAvailable;
+    std::deque<std::shared_ptr<const Update>> m_pendingUpdates;
+    std::optional<grpc::Status>               m_endStatus;
+};
+
+class FakeDataBroker::ValService final : public kuksa::val::v2::VAL::Service {
+public:
+    explicit ValService(FakeDataBroker& broker)
+        : m_broker(&broker) {}
+
+    grpc::Status GetValues(grpc::ServerContext* context,
+                           const kuksa::val::v2::GetValuesRequest* request,
+                           kuksa::val::v2::GetValuesResponse*      response) override {
+        std::ignore = context;
+        if (auto status = m_broker->beginCall(GET_VALUES, true); !status.ok()) {
+            return status;
+        }
+        std::lock_guard lock(m_broker->m_mutex);
+        for (const auto& signalId : request->signal_ids()) {
+            const auto index = findSignal(signalId);
+            if (index == NOT_FOUND) {
+                return getSignalNotFoundStatus(signalId);
+            }
+            *response->add_data_points() = m_broker->m_values[index];
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SubscribeById(grpc::ServerContext*                                  context,
+                               const kuksa::val::v2::SubscribeByIdRequest*           request,
+                               grpc::ServerWriter<kuksa::val::v2::SubscribeByIdResponse>* writer)
+        override {
+        if (auto status = m_broker->beginCall(SUBSCRIBE_BY_ID, false); !status.ok()) {
+            return status;
+        }
+        std::vector<size_t> signalIndices;
+        for (const auto signalId : request->signal_ids()) {
+            const auto index = m_broker->findSignal(signalId);
+            if (index == NOT_FOUND) {
+                return grpc::Status(grpc::StatusCode::NOT_FOUND,
+                                    fmt::format("Signal with id {} not found", signalId));
+            }
+            signalIndices.push_back(index);
+        }
+
+        auto subscription = m_broker->addSubscription(std::move(signalIndices));
+        auto status       = subscription->serve(
+            *context, *writer,
+            [](kuksa::val::v2::SubscribeByIdResponse& response, size_t index,
+               const kuksa::val::v2::Datapoint& dataPoint) {
+                (*response.mutable_entries())[static_cast<int32_t>(index + 1)] = dataPoint;
+            });
+        m_broker->removeSubscription(subscription);
+        return status;
+    }
+
+    grpc::Status BatchActuate(grpc::ServerContext*                       context,
+                              const kuksa::val::v2::BatchActuateRequest* request,
+                              kuksa::val::v2::BatchActuateResponse*      response) override {
+        std::ignore = context;
+        std::ignore = response;
+        if (auto status = m_broker->beginCall(BATCH_ACTUATE, true); !status.ok()) {
+            return status;
+        }
+        std::vector<std::pair<size_t, kuksa::val::v2::Datapoint>> values;
+        for (const auto& actuateRequest : request->actuate_requests()) {
+            const auto index = findSignal(actuateRequest.signal_id());
+            if (index == NOT_FOUND) {
+                return getSignalNotFoundStatus(actuateRequest.signal_id());
+            }
+            if (m_broker->m_catalog[index].m_entryType != kuksa::val::v2::ENTRY_TYPE_ACTUATOR) {
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                    fmt::format("Signal {} is not an actuator",
+                                                m_broker->m_catalog[index].m_path));
+            }
+            kuksa::val::v2::Datapoint dataPoint;
+            *dataPoint.mutable_timestamp() = getCurrentTimestamp();
+            *dataPoint.mutable_value()     = actuateRequest.value();
+            values.emplace_back(index, std::move(dataPoint));
+        }
+        {
+            std::lock_guard lock(m_broker->m_mutex);
+            if (!m_broker->m_isProviderAvailable && !values.empty()) {
+                return grpc::Status(
+                    grpc::StatusCode::UNAVAILABLE,
+                    fmt::format("Provider for vss_id {} not available", values.front().first + 1));
+            }
+        }
+        m_broker->applyValues(std::move(values));
+        return grpc::Status::OK;
+    }
+
+    grpc::Status ListMetadata(grpc::ServerContext*                       context,
+                              const kuksa::val::v2::ListMetadataRequest* request,
+                              kuksa::val::v2::ListMetadataResponse*      response) override {
+        std::ignore = context;
+        if (auto status = m_broker->beginCall(LIST_METADATA, true); !status.ok()) {
+            return status;
+        }
+        const auto& catalog = m_broker->m_catalog;
+        for (size_t index = 0; index < catalog.size(); ++index) {
+            if (isWithinBranch(catalog[index].m_path, request->root())) {
+                auto& metadata = *response->add_metadata();
+                metadata.set_id(static_cast<int32_t>(index + 1));
+                metadata.set_data_type(catalog[index].m_dataType);
+                metadata.set_entry_type(catalog[index].m_entryType);
+            }
+        }
+        if (response->metadata().empty()) {
+            return grpc::Status(grpc::StatusCode::NOT_FOUND,
+                                fmt::format("Specified root {} not found", request->root()));
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status GetServerInfo(grpc::ServerContext*                        context,
+                               const kuksa::val::v2::GetServerInfoRequest* request,
+                               kuksa::val::v2::GetServerInfoResponse*      response) override {
+        std::ignore = context;
+        std::ignore = request;
+        if (auto status = m_broker->beginCall(GET_SERVER_INFO, true); !status.ok()) {
+            return status;
+        }
+        response->set_name("fake-databroker");
+        response->set_version("0.0.0");
+        return grpc::Status::OK;
+    }
+
+private:
+    [[nodiscard]] size_t findSignal(const kuksa::val::v2::SignalID& signalId) const {
+        return (signalId.signal_case() == kuksa::val::v2::SignalID::kId)
+                   ? m_broker->findSignal(signalId.id())
+                   : m_broker->findSignal(signalId.path());
+    }
+
+    static grpc::Status getSignalNotFoundStatus(const kuksa::val::v2::SignalID& signalId) {
+        return grpc::Status(grpc::StatusCode::NOT_FOUND,
+                            (signalId.signal_case() == kuksa::val::v2::SignalID::kId)
+                                ? fmt::format("Signal with id {} not found", signalId.id())
+                                : fmt::format("Signal {} not found", signalId.path()));
+    }
+
+    FakeDataBroker* m_broker;
+};
+
+class FakeDataBroker::BrokerService final : public sdv::databroker::v1::Broker::Service {
+public:
+    explicit BrokerService(FakeDataBroker& broker)
+        : m_broker(&broker) {}
+
+    grpc::Status GetDatapoints(grpc::ServerContext*                             context,
+                               const sdv::databroker::v1::GetDatapointsRequest* request,
+                               sdv::databroker::v1::GetDatapointsReply*         response) override {
+        std::ignore = context;
+        if (auto status = m_broker->beginCall(GET_DATAPOINTS, true); !status.ok()) {
+            return status;
+        }
+        auto&           dataPoints = *response->mutable_datapoints();
+        std::lock_guard lock(m_broker->m_mutex);
+        for (const auto& path : request->datapoints()) {
+            const auto index = m_broker->findSignal(path);
+            if (index == NOT_FOUND) {
+                dataPoints[path].set_failure_value(
+                    sdv::databroker::v1::Datapoint_Failure_UNKNOWN_DATAPOINT);
+            } else {
+                dataPoints[path] = convertToV1DataPoint(m_broker->m_values[index]);
+            }
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SetDatapoints(grpc::ServerContext*                             context,
+                               const sdv::databroker::v1::SetDatapointsRequest* request,
+                               sdv::databroker::v1::SetDatapointsReply*         response) override {
+        std::ignore = context;
+        if (auto status = m_broker->beginCall(SET_DATAPOINTS, true); !status.ok()) {
+            return status;
+        }
+        auto& errors = *response->mutable_errors();
+        std::vector<std::pair<size_t, kuksa::val::v2::Datapoint>> values;
+        for (const auto& [path, v1DataPoint] : request->datapoints()) {
+            const auto index = m_broker->findSignal(path);
+            if (index == NOT_FOUND) {
+                errors[path] = sdv::databroker::v1::UNKNOWN_DATAPOINT;
+                continue;
+            }
+            auto value = convertFromV1DataPoint(v1DataPoint);
+            if (!value) {
+                errors[path] = sdv::databroker::v1::INVALID_TYPE;
+                continue;
+            }
+            kuksa::val::v2::Datapoint dataPoint;
+            *dataPoint.mutable_timestamp() = v1DataPoint.has_timestamp() ? v1DataPoint.timestamp()
+                                                                         : getCurrentTimestamp();
+            *dataPoint.mutable_value()     = std::move(*value);
+            values.emplace_back(index, std::move(dataPoint));
+        }
+        m_broker->applyValues(std::move(values));
+        return grpc::Status::OK;
+    }
+
+    grpc::Status Subscribe(grpc::ServerContext*                                     context,
+                           const sdv::databroker::v1::SubscribeRequest*             request,
+                           grpc::ServerWriter<sdv::databroker::v1::SubscribeReply>* writer)
+        override {
+        if (auto status = m_broker->beginCall(SUBSCRIBE, false); !status.ok()) {
+            return status;
+        }
+        std::vector<size_t> signalIndices;
+        try {
+            for (const auto& path : kuksa_val_v2::parseQuery(request->query())) {
+                const auto index = m_broker->findSignal(path);
+                if (index == NOT_FOUND) {
+                    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                        fmt::format("Unknown field: {}", path));
+                }
+                signalIndices.push_back(index);
+            }
+        } catch (const std::exception& e) {
+            // The fake does not support WHERE clauses
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, e.what());
+        }
+
+        auto subscription = m_broker->addSubscription(std::move(signalIndices));
+        auto status       = subscription->serve(
+            *context, *writer,
+            [this](sdv::databroker::v1::SubscribeReply& response, size_t index,
+                   const kuksa::val::v2::Datapoint& dataPoint) {
+                (*response.mutable_fields())[m_broker->m_catalog[index].m_path] =
+                    convertToV1DataPoint(dataPoint);
+            });
+        m_broker->removeSubscription(subscription);
+        return status;
+    }
+
+private:
+    FakeDataBroker* m_broker;
+};
+
+FakeDataBroker::FakeDataBroker(std::vector<FakeSignal> catalog)
+    : m_catalog(std::move(catalog))
+    , m_values(m_catalog.size()) {
+    for (size_t index = 0; index < m_catalog.size(); ++index) {
+        if (!m_signalIndices.emplace(m_catalog[index].m_path, index).second) {
+            throw std::invalid_argument(
+                fmt::format("Signal {} listed twice in catalog", m_catalog[index].m_path));
+        }
+    }
+}
+
+FakeDataBroker::~FakeDataBroker() {
+    stopUpdates();
+    stop();
+}
+
+void FakeDataBroker::start() {
+    if (m_server) {
+        return;
+    }
+    // services cannot be registered at multiple servers, hence they are created per start
+    m_valService    = std::make_unique<ValService>(*this);
+    m_brokerService = std::make_unique<BrokerService>(*this);
+
+    int                 selectedPort = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(fmt::format("127.0.0.1:{}", m_port), grpc::InsecureServerCredentials(),
+                             &selectedPort);
+    builder.RegisterService(m_valService.get());
+    builder.RegisterService(m_brokerService.get());
+    m_server = builder.BuildAndStart();
+    if (!m_server || (selectedPort == 0)) {
+        m_server.reset();
+        throw std::runtime_error(fmt::format("Cannot start fake databroker on port {}", m_port));
+    }
+    m_port = selectedPort;
+}
+
+void FakeDataBroker::stop() {
+    if (!m_server) {
+        return;
+    }
+    disconnectSubscriptions(grpc::StatusCode::UNAVAILABLE);
+    m_server->Shutdown(std::chrono::system_clock::now() + SHUTDOWN_TIMEOUT);
+    m_server->Wait();
+    m_server.reset();
+    m_valService.reset();
+    m_brokerService.reset();
+}
+
+std::string FakeDataBroker::getAddress() const { return fmt::format("127.0.0.1:{}", m_port); }
+
+void FakeDataBroker::setValues(const std::vector<DataPointValue>& values) {
+    std::vector<std::pair<size_t, kuksa::val::v2::Datapoint>> dataPoints;
+    dataPoints.reserve(values.size());
+    for (const auto& value : values) {
+        const auto index = findSignal(value.getPath());
+        if (index == NOT_FOUND) {
+            throw std::invalid_argument(
+                fmt::format("Signal {} is not in the catalog", value.getPath()));
+        }
+        kuksa::val::v2::Datapoint dataPoint;
+        *dataPoint.mutable_timestamp() = convertToGrpcTimestamp(value.getTimestamp());
+        if (value.isValid()) {
+            *dataPoint.mutable_value() = kuksa_val_v2::convertToGrpcValue(value);
+        }
+        dataPoints.emplace_back(index, std::move(dataPoint));
+    }
+    applyValues(std::move(dataPoints));
+}
+
+void FakeDataBroker::startUpdates(const std::vector<std::string>& paths,
+                                  double                          updatesPerSecond) {
+    if (updatesPerSecond <= 0.0) {
+        throw std::invalid_argument("The update rate needs to be positive");
+    }
+    std::vector<size_t> signalIndices;
+    signalIndices.reserve(paths.size());
+    for (const auto& path : paths) {
+        const auto index = findSignal(path);
+        if (index == NOT_FOUND) {
+            throw std::invalid_argument(fmt::format("Signal {} is not in the catalog", path));
+        }
+        // fail early on data types values cannot be generated for
+        std::ignore = createGeneratedValue(m_catalog[index].m_dataType, 0);
+        signalIndices.push_back(index);
+    }
+
+    stopUpdates();
+    m_isGeneratorRunning = true;
+    m_generatorThread    = std::thread([this, signalIndices = std::move(signalIndices),
+                                     updatesPerSecond]() {
+        generateUpdates(signalIndices, updatesPerSecond);
+    });
+}
+
+void FakeDataBroker::stopUpdates() {
+    {
+        std::lock_guard lock(m_generatorMutex);
+        m_isGeneratorRunning = false;
+    }
+    m_generatorStopped.notify_all();
+    if (m_generatorThread.joinable()) {
+        m_generatorThread.join();
+    }
+}
+
+void FakeDataBroker::generateUpdates(std::vector<size_t> signalIndices, double updatesPerSecond) {
+    const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / updatesPerSecond));
+    // Updates are scheduled at fixed points in time, i.e. updates falling behind are caught up
+    // as fast as possible
+    auto     nextUpdate = std::chrono::steady_clock::now();
+    uint64_t counter    = 0;
+
+    std::unique_lock lock(m_generatorMutex);
+    while (!m_generatorStopped.wait_until(lock, nextUpdate,
+                                          [this]() { return !m_isGeneratorRunning; })) {
+        lock.unlock();
+        const auto timestamp = getCurrentTimestamp();
+        std::vector<std::pair<size_t, kuksa::val::v2::Datapoint>> values;
+        values.reserve(signalIndices.size());
+        for (const auto index : signalIndices) {
+            kuksa::val::v2::Datapoint dataPoint;
+            *dataPoint.mutable_timestamp() = timestamp;
+            *dataPoint.mutable_value() = createGeneratedValue(m_catalog[index].m_dataType, counter);
+            values.emplace_back(index, std::move(dataPoint));
+        }
+        applyValues(std::move(values));
+        ++counter;
+        ++m_numGeneratedUpdates;
+        nextUpdate += period;
+        lock.lock();
+    }
+}
+
+void FakeDataBroker::setLatency(std::chrono::microseconds latency) {
+    std::lock_guard lock(m_mutex);
+    m_latency = latency;
+}
+
+void FakeDataBroker::injectError(const std::string& method, grpc::StatusCode code,
+                                 size_t numCalls, const std::string& message) {
+    std::lock_guard lock(m_mutex);
+    m_injectedErrors[method] = InjectedError{grpc::Status(code, message), numCalls};
+}
+
+void FakeDataBroker::clearInjectedErrors() {
+    std::lock_guard lock(m_mutex);
+    m_injectedErrors.clear();
+}
+
+void FakeDataBroker::setProviderAvailable(bool isAvailable) {
+    std::lock_guard lock(m_mutex);
+    m_isProviderAvailable = isAvailable;
+}
+
+void FakeDataBroker::disconnectSubscriptions(grpc::StatusCode code) {
+    const grpc::Status status(code, "Subscription disconnected by fake databroker");
+    std::lock_guard    lock(m_mutex);
+    for (const auto& subscription : m_subscriptions) {
+        subscription->end(status);
+    }
+}
+
+bool FakeDataBroker::waitForSubscriptions(size_t                    numSubscriptions,
+                                          std::chrono::milliseconds timeout) const {
+    std::unique_lock lock(m_mutex);
+    return m_subscriptionsChanged.wait_for(lock, timeout, [this, numSubscriptions]() {
+        return m_subscriptions.size() >= numSubscriptions;
+    });
+}
+
+size_t FakeDataBroker::getNumCalls(const std::string& method) const {
+    std::lock_guard lock(m_mutex);
+    const auto      iter = m_numCalls.find(method);
+    return (iter != m_numCalls.end()) ? iter->second : 0;
+}
+
+size_t FakeDataBroker::getNumSubscriptions() const {
+    std::lock_guard lock(m_mutex);
+    return m_subscriptions.size();
+}
+
+grpc::Status FakeDataBroker::beginCall(const std::string& method, bool isUnary) {
+    std::chrono::microseconds latency{0};
+    grpc::Status              status;
+    {
+        std::lock_guard lock(m_mutex);
+        ++m_numCalls[method];
+        if (isUnary) {
+            latency = m_latency;
+        }
+        auto iter = m_injectedErrors.find(method);
+        if (iter != m_injectedErrors.end()) {
+            status = iter->second.m_status;
+            if ((iter->second.m_numCalls != ALL_CALLS) && (--iter->second.m_numCalls == 0)) {
+                m_injectedErrors.erase(iter);
+            }
+        }
+    }
+    if (latency.count() > 0) {
+        std::this_thread::sleep_for(latency);
+    }
+    return status;
+}
+
+size_t FakeDataBroker::findSignal(const std::string& path) const {
+    const auto iter = m_signalIndices.find(path);
+    return (iter != m_signalIndices.end()) ? iter->second : NOT_FOUND;
+}
+
+size_t FakeDataBroker::findSignal(int32_t signalId) const {
+    return ((signalId > 0) && (static_cast<size_t>(signalId) <= m_catalog.size()))
+               ? static_cast<size_t>(signalId - 1)
+               : NOT_FOUND;
+}
+
+void FakeDataBroker::applyValues(
+    std::vector<std::pair<size_t, kuksa::val::v2::Datapoint>>&& values) {
+    if (values.empty()) {
+        return;
+    }
+    auto update = std::make_shared<Update>();
+
+    std::lock_guard lock(m_mutex);
+    for (const auto& [index, dataPoint] : values) {
+        m_values[index] = dataPoint;
+    }
+    update->m_values = std::move(values);
+    for (const auto& subscription : m_subscriptions) {
+        if (subscription->isInterestedIn(*update) && !subscription->push(update)) {
+            ++m_numDroppedUpdates;
+        }
+    }
+}
+
+std::shared_ptr<FakeDataBroker::Subscription>
+FakeDataBroker::addSubscription(std::vector<size_t> signalIndices) {
+    std::sort(signalIndices.begin(), signalIndices.end());
+    signalIndices.erase(std::unique(signalIndices.begin(), signalIndices.end()),
+                        signalIndices.end());
+    auto subscription = std::make_shared<Subscription>(std::move(signalIndices), m_catalog.size());
+
+    std::lock_guard lock(m_mutex);
+    // like the databroker, start with the current values of all subscribed signals
+    auto initialValues = std::make_shared<Update>();
+    for (const auto index : subscription->getSignalIndices()) {
+        initialValues->m_values.emplace_back(index, m_values[index]);
+    }
+    subscription->push(initialValues);
+    m_subscriptions.push_back(subscription);
+    m_subscriptionsChanged.notify_all();
+    return subscription;
+}
+
+void FakeDataBroker::removeSubscription(const std::shared_ptr<Subscription>& subscription) {
+    std::lock_guard lock(m_mutex);
+    m_subscriptions.erase(std::remove(m_subscriptions.begin(), m_subscriptions.end(), subscription),
+                          m_subscriptions.end());
+    m_subscriptionsChanged.notify_all();
+}
+
+} // namespace velocitas
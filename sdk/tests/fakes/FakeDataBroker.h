@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_TESTS_FAKES_FAKEDATABROKER_H
+#define VEHICLE_APP_SDK_TESTS_FAKES_FAKEDATABROKER_H
+
+#include "kuksa/val/v2/types.pb.h"
+#include "sdk/DataPointValue.h"
+
+#include <grpcpp/support/status.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace grpc {
+class Server;
+} // namespace grpc
+
+namespace velocitas {
+
+/**
+ * @brief A signal of the catalog served by the FakeDataBroker.
+ */
+struct FakeSignal {
+    std::string               m_path;
+    kuksa::val::v2::DataType  m_dataType{kuksa::val::v2::DATA_TYPE_FLOAT};
+    kuksa::val::v2::EntryType m_entryType{kuksa::val::v2::ENTRY_TYPE_SENSOR};
+};
+
+/**
+ * @brief In-process databroker serving the kuksa.val.v2 VAL and the sdv.databroker.v1 Broker
+ *        service on a localhost port, to test and benchmark the broker clients end-to-end without
+ *        a databroker container.
+ *
+ *        The fake serves a fixed catalog of signals and supports the calls used by the SDK:
+ *        kuksa.val.v2 GetValues, SubscribeById, BatchActuate, ListMetadata and GetServerInfo as
+ *        well as sdv.databroker.v1 GetDatapoints, SetDatapoints and Subscribe. Subscription
+ *        queries containing WHERE clauses are not supported.
+ *        Actuation requests are applied to the signal values right away, i.e. the fake acts as
+ *        provider of all actuators as long as setProviderAvailable(false) is not called.
+ *
+ *        Faults can be injected per call: a latency added to all unary calls, error codes returned
+ *        by the next n calls of a method, and the disconnect of all open subscription streams.
+ *        Values change either by setValues() or by the update generator, which updates a set of
+ *        signals at a fixed rate and stamps each value with the time of its generation.
+ *
+ *        Methods are addressed by their full name, e.g. "kuksa.val.v2.VAL/GetValues" or
+ *        "sdv.databroker.v1.Broker/Subscribe".
+ */
+class FakeDataBroker {
+public:
+    static constexpr size_t ALL_CALLS = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief Number of updates buffered per subscription stream for a slow client. Beyond, the
+     *        oldest updates are dropped.
+     */
+    static constexpr size_t MAX_PENDING_UPDATES = 1000;
+
+    /**
+     * @brief Create a fake serving the passed catalog. The signals get the ids 1..n in catalog
+     *        order and have no value initially.
+     */
+    explicit FakeDataBroker(std::vector<FakeSignal> catalog);
+    ~FakeDataBroker();
+
+    FakeDataBroker(const FakeDataBroker&)            = delete;
+    FakeDataBroker(FakeDataBroker&&)                 = delete;
+    FakeDataBroker& operator=(const FakeDataBroker&) = delete;
+    FakeDataBroker& operator=(FakeDataBroker&&)      = delete;
+
+    /**
+     * @brief Start serving on a localhost port. The port is picked on the first start and reused
+     *        by later starts, so clients can reconnect after stop().
+     *
+     * @throw std::runtime_error if the server cannot be started.
+     */
+    void start();
+
+    /**
+     * @brief Stop serving: Open subscription streams are ended with UNAVAILABLE and further
+     *        calls fail to connect until the next start().
+     */
+    void stop();
+
+    /**
+     * @brief Address of the fake, e.g. "127.0.0.1:43215". Valid after the first start().
+     */
+    [[nodiscard]] std::string getAddress() const;
+
+    /**
+     * @brief Set the values of catalog signals and notify the subscribers about them. Values
+     *        without timestamp get the current time.
+     *
+     * @throw std::invalid_argument if a value refers to a signal not in the catalog.
+     */
+    void setValues(const std::vector<DataPointValue>& values);
+
+    /**
+     * @brief Start updating all of the passed signals updatesPerSecond times per second, the
+     *        values being derived from a counter incremented per update. Replaces an update
+     *        generator running before.
+     *
+     * @throw std::invalid_argument if a path refers to a signal not in the catalog.
+     */
+    void startUpdates(const std::vector<std::string>& paths, double updatesPerSecond);
+
+    /**
+     * @brief Stop the update generator.
+     */
+    void stopUpdates();
+
+    /**
+     * @brief Set the latency added to each unary call before it is answered.
+     */
+    void setLatency(std::chrono::microseconds latency);
+
+    /**
+     * @brief Let the next numCalls calls of the passed method fail with the passed status.
+     */
+    void injectError(const std::string& method, grpc::StatusCode code,
+                     size_t numCalls = ALL_CALLS, const std::string& message = "injected error");
+
+    /**
+     * @brief Remove all errors injected via injectError().
+     */
+    void clearInjectedErrors();
+
+    /**
+     * @brief Set whether the provider of the actuators is available. If not, BatchActuate fails
+     *        with UNAVAILABLE and the message used by the databroker in this case.
+     */
+    void setProviderAvailable(bool isAvailable);
+
+    /**
+     * @brief End all open subscription streams with the passed status.
+     */
+    void disconnectSubscriptions(grpc::StatusCode code = grpc::StatusCode::UNAVAILABLE);
+
+    /**
+     * @brief Wait until at least the passed number of subscription streams is open.
+     *
+     * @return true if the number was reached within the timeout.
+     */
+    bool waitForSubscriptions(size_t numSubscriptions, std::chrono::milliseconds timeout) const;
+
+    [[nodiscard]] size_t   getNumCalls(const std::string& method) const;
+    [[nodiscard]] size_t   getNumSubscriptions() const;
+
+    /**
+     * @brief Number of updates by the update generator, each covering all of its signals.
+     */
+    [[nodiscard]] uint64_t getNumGeneratedUpdates() const { return m_numGeneratedUpdates; }
+    [[nodiscard]] uint64_t getNumDroppedUpdates() const { return m_numDroppedUpdates; }
+
+private:
+    class ValService;
+    class BrokerService;
+    class Subscription;
+    struct Update;
+
+    /**
+     * @brief Account the call of the passed method and apply the latency and errors injected
+     *        for it.
+     */
+    grpc::Status beginCall(const std::string& method, bool isUnary);
+
+    [[nodiscard]] size_t findSignal(const std::string& path) const;
+    [[nodiscard]] size_t findSignal(int32_t signalId) const;
+
+    void applyValues(std::vector<std::pair<size_t, kuksa::val::v2::Datapoint>>&& values);
+
+    std::shared_ptr<Subscription> addSubscription(std::vector<size_t> signalIndices);
+    void removeSubscription(const std::shared_ptr<Subscription>& subscription);
+
+    void generateUpdates(std::vector<size_t> signalIndices, double updatesPerSecond);
+
+    static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+    struct InjectedError {
+        grpc::Status m_status;
+        size_t       m_numCalls;
+    };
+
+    const std::vector<FakeSignal>           m_catalog;
+    std::unordered_map<std::string, size_t> m_signalIndices;
+    std::unique_ptr<ValService>             m_valService;
+    std::unique_ptr<BrokerService>          m_brokerService;
+    std::unique_ptr<grpc::Server>           m_server;
+    int                                     m_port{0};
+
+    mutable std::mutex                         m_mutex;
+    mutable std::condition_variable            m_subscriptionsChanged;
+    std::vector<kuksa::val::v2::Datapoint>     m_values;
+    std::vector<std::shared_ptr<Subscription>> m_subscriptions;
+    std::map<std::string, size_t>              m_numCalls;
+    std::map<std::string, InjectedError>       m_injectedErrors;
+    std::chrono::microseconds                  m_latency{0};
+    bool                                       m_isProviderAvailable{true};
+
+    std::thread             m_generatorThread;
+    std::mutex              m_generatorMutex;
+    std::condition_variable m_generatorStopped;
+    bool                    m_isGeneratorRunning{false};
+
+    std::atomic<uint64_t> m_numGeneratedUpdates{0};
+    std::atomic<uint64_t> m_numDroppedUpdates{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_TESTS_FAKES_FAKEDATABROKER_H
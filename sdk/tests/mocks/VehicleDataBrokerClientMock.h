@@ -25,6 +25,8 @@ namespace velocitas {
 
 class VehicleDataBrokerClientMock : public IVehicleDataBrokerClient {
 public:
+    using IVehicleDataBrokerClient::getDatapoints;
+
     MOCK_METHOD(AsyncResultPtr_t<DataPointReply>, getDatapoints,
                 (const std::vector<std::string>& datapoints));
 
@@ -32,6 +34,8 @@ public:
                 (const std::vector<std::unique_ptr<DataPointValue>>& datapoints));
 
     MOCK_METHOD(AsyncSubscriptionPtr_t<DataPointReply>, subscribe, (const std::string& query));
+
+    MOCK_METHOD(void, flush, ());
 };
 
 } // namespace velocitas
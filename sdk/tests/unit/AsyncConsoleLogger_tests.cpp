@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/AsyncConsoleLogger.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+std::string readAll(std::FILE* stream) {
+    std::rewind(stream);
+    std::string content;
+    char        chunk[256]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    while (const auto numRead = std::fread(chunk, 1, sizeof(chunk), stream)) {
+        content.append(chunk, numRead);
+    }
+    return content;
+}
+
+size_t countOccurrences(const std::string& content, const std::string& pattern) {
+    size_t count = 0;
+    for (auto pos = content.find(pattern); pos != std::string::npos;
+         pos      = content.find(pattern, pos + pattern.size())) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+class Test_AsyncConsoleLogger : public ::testing::Test {
+protected:
+    void SetUp() override { m_stream = std::tmpfile(); }
+    void TearDown() override { std::fclose(m_stream); }
+
+    std::FILE* m_stream{};
+};
+
+TEST_F(Test_AsyncConsoleLogger, flush_messagesLogged_allWrittenInOrder) {
+    AsyncConsoleLogger cut(16, AsyncConsoleLogger::OverflowPolicy::BLOCK, m_stream);
+
+    cut.info("first");
+    cut.error("second");
+    cut.flush();
+
+    const auto content = readAll(m_stream);
+    const auto first   = content.find("INFO  : first");
+    const auto second  = content.find("ERROR : second");
+    ASSERT_NE(std::string::npos, first);
+    ASSERT_NE(std::string::npos, second);
+    EXPECT_LT(first, second);
+}
+
+TEST_F(Test_AsyncConsoleLogger, destructor_pendingMessages_written) {
+    {
+        AsyncConsoleLogger cut(16, AsyncConsoleLogger::OverflowPolicy::BLOCK, m_stream);
+        cut.debug("pending");
+    }
+
+    EXPECT_EQ(1, countOccurrences(readAll(m_stream), "DEBUG : pending"));
+}
+
+TEST_F(Test_AsyncConsoleLogger, blockPolicy_bufferExceededByConcurrentLoggers_noMessageLost) {
+    constexpr int NUM_THREADS             = 4;
+    constexpr int NUM_MESSAGES_PER_THREAD = 500;
+
+    {
+        AsyncConsoleLogger       cut(4, AsyncConsoleLogger::OverflowPolicy::BLOCK, m_stream);
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < NUM_THREADS; ++thread) {
+            threads.emplace_back([&cut]() {
+                for (int index = 0; index < NUM_MESSAGES_PER_THREAD; ++index) {
+                    cut.warn("message");
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(0, cut.getNumDroppedMessages());
+    }
+
+    EXPECT_EQ(NUM_THREADS * NUM_MESSAGES_PER_THREAD,
+              countOccurrences(readAll(m_stream), "WARN  : message"));
+}
+
+TEST_F(Test_AsyncConsoleLogger, dropPolicy_bufferExceeded_dropsReported) {
+    constexpr int NUM_MESSAGES = 10000;
+
+    uint64_t numDropped = 0;
+    {
+        AsyncConsoleLogger cut(2, AsyncConsoleLogger::OverflowPolicy::DROP, m_stream);
+        for (int index = 0; index < NUM_MESSAGES; ++index) {
+            cut.info("message");
+        }
+        numDropped = cut.getNumDroppedMessages();
+    }
+
+    const auto content = readAll(m_stream);
+    EXPECT_EQ(NUM_MESSAGES - numDropped, countOccurrences(content, "INFO  : message"));
+    if (numDropped > 0) {
+        EXPECT_NE(std::string::npos, content.find("log messages dropped"));
+    }
+}
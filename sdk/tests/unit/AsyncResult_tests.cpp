@@ -66,3 +66,80 @@ TEST(Test_AsyncResult, onResult_whileAwaiting_throws) {
     asyncResult.insertResult(4);
     thread.join();
 }
+
+TEST(Test_AsyncResult, await_withError_throwsAsyncException) {
+    AsyncResult<int> asyncResult;
+    asyncResult.insertError(Status("some error"));
+    EXPECT_THROW(asyncResult.await(), AsyncException);
+}
+
+TEST(Test_AsyncResult, onResult_resultAlreadyInserted_handlerCalledImmediately) {
+    int              receivedResult{-1};
+    AsyncResult<int> asyncResult;
+    asyncResult.insertResult(10);
+    asyncResult.onResult([&receivedResult](int result) { receivedResult = result; });
+
+    EXPECT_EQ(receivedResult, 10);
+}
+
+TEST(Test_AsyncResult, onError_errorAlreadyInserted_handlerCalledImmediately) {
+    std::string      receivedError;
+    AsyncResult<int> asyncResult;
+    asyncResult.insertError(Status("some error"));
+    asyncResult.onError([&receivedError](Status status) { receivedError = status.errorMessage(); });
+
+    EXPECT_EQ("some error", receivedError);
+}
+
+TEST(Test_AsyncResult, isCompleted_beforeAndAfterInsert_reflectsState) {
+    AsyncResult<int> asyncResult;
+    EXPECT_FALSE(asyncResult.isCompleted());
+    asyncResult.insertResult(1);
+    EXPECT_TRUE(asyncResult.isCompleted());
+}
+
+TEST(Test_AsyncResult, map_beforeResultInserted_mappedResultReceivesMappedValue) {
+    AsyncResult<int> asyncResult;
+    auto             mapped =
+        asyncResult.map<std::string>([](const int& value) { return std::to_string(value); });
+    asyncResult.insertResult(42);
+
+    EXPECT_EQ("42", mapped->await());
+}
+
+TEST(Test_AsyncResult, map_afterResultInserted_mappedResultReceivesMappedValue) {
+    AsyncResult<int> asyncResult;
+    asyncResult.insertResult(42);
+    auto mapped = asyncResult.map<int>([](const int& value) { return value * 2; });
+
+    EXPECT_EQ(84, mapped->await());
+}
+
+TEST(Test_AsyncResult, map_errorInserted_mappedResultReceivesError) {
+    AsyncResult<int> asyncResult;
+    auto             mapped = asyncResult.map<int>([](const int& value) { return value; });
+    asyncResult.insertError(Status("some error"));
+
+    EXPECT_THROW(mapped->await(), AsyncException);
+}
+
+TEST(Test_AsyncResult, map_chained_resultPropagatedThroughChain) {
+    AsyncResult<int> asyncResult;
+    auto             incremented = asyncResult.map<int>([](const int& val) { return val + 1; });
+    auto             mapped      = incremented->map<int>([](const int& val) { return val * 10; });
+    asyncResult.insertResult(1);
+
+    EXPECT_EQ(20, mapped->await());
+}
+
+TEST(Test_AsyncResult, onResult_concurrentInsert_handlerCalledExactlyOnce) {
+    for (int i = 0; i < 1000; ++i) {
+        auto            asyncResult = std::make_shared<AsyncResult<int>>();
+        std::atomic_int numCalls{0};
+        std::thread     producer([asyncResult]() { asyncResult->insertResult(1); });
+        asyncResult->onResult([&numCalls](int) { ++numCalls; });
+        producer.join();
+
+        EXPECT_EQ(1, numCalls);
+    }
+}
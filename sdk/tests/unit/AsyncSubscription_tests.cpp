@@ -15,8 +15,14 @@
  */
 
 #include "sdk/AsyncResult.h"
+#include "sdk/DataPointReply.h"
 
+#include <atomic>
 #include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using namespace velocitas;
 
@@ -42,3 +48,178 @@ TEST(Test_AsyncSubcription, next_noBufferedItems_blocksUntilItemsInserted) {
     EXPECT_EQ(asyncSubscription.next(), INT_RESULT);
     thread.join();
 }
+
+TEST(Test_AsyncSubcription, next_moreItemsThanInitialBufferSize_returnsItemsInOrder) {
+    AsyncSubscription<int> asyncSubscription;
+    for (int i = 0; i < 100; ++i) {
+        asyncSubscription.insertNewItem(int{i});
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(asyncSubscription.next(), i);
+    }
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_bufferFullDropOldest_oldestItemDropped) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.setBufferCapacity(2, OverflowPolicy::DROP_OLDEST);
+    asyncSubscription.insertNewItem(1);
+    asyncSubscription.insertNewItem(2);
+    asyncSubscription.insertNewItem(3);
+
+    EXPECT_EQ(asyncSubscription.next(), 2);
+    EXPECT_EQ(asyncSubscription.next(), 3);
+    EXPECT_EQ(1, asyncSubscription.getNumDroppedItems());
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_bufferFullDropNewest_newItemDropped) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.setBufferCapacity(2, OverflowPolicy::DROP_NEWEST);
+    asyncSubscription.insertNewItem(1);
+    asyncSubscription.insertNewItem(2);
+    asyncSubscription.insertNewItem(3);
+
+    EXPECT_EQ(asyncSubscription.next(), 1);
+    EXPECT_EQ(asyncSubscription.next(), 2);
+    EXPECT_EQ(1, asyncSubscription.getNumDroppedItems());
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_bufferFullCoalesceLatest_newestItemReplaced) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.setBufferCapacity(2, OverflowPolicy::COALESCE_LATEST);
+    asyncSubscription.insertNewItem(1);
+    asyncSubscription.insertNewItem(2);
+    asyncSubscription.insertNewItem(3);
+    asyncSubscription.insertNewItem(4);
+
+    EXPECT_EQ(asyncSubscription.next(), 1);
+    EXPECT_EQ(asyncSubscription.next(), 4);
+    EXPECT_EQ(0, asyncSubscription.getNumDroppedItems());
+    EXPECT_EQ(2, asyncSubscription.getNumCoalescedItems());
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_bufferFullBlockProducer_blocksUntilItemConsumed) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.setBufferCapacity(1, OverflowPolicy::BLOCK_PRODUCER);
+    asyncSubscription.insertNewItem(1);
+
+    std::atomic_bool secondInserted{false};
+    std::thread      producer([&asyncSubscription, &secondInserted]() {
+        asyncSubscription.insertNewItem(2);
+        secondInserted = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    EXPECT_FALSE(secondInserted);
+    EXPECT_EQ(asyncSubscription.next(), 1);
+    EXPECT_EQ(asyncSubscription.next(), 2);
+    producer.join();
+    EXPECT_TRUE(secondInserted);
+    EXPECT_EQ(0, asyncSubscription.getNumDroppedItems());
+}
+
+TEST(Test_AsyncSubcription, wouldBlockProducer_bufferFullBlockProducer_trueUntilItemConsumed) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.setBufferCapacity(1, OverflowPolicy::BLOCK_PRODUCER);
+    EXPECT_FALSE(asyncSubscription.wouldBlockProducer());
+
+    asyncSubscription.insertNewItem(1);
+    EXPECT_TRUE(asyncSubscription.wouldBlockProducer());
+
+    asyncSubscription.next();
+    EXPECT_FALSE(asyncSubscription.wouldBlockProducer());
+}
+
+TEST(Test_AsyncSubcription, cancel_producerBlockedOnFullBuffer_producerReleased) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.setBufferCapacity(1, OverflowPolicy::BLOCK_PRODUCER);
+    asyncSubscription.insertNewItem(1);
+
+    std::thread producer([&asyncSubscription]() { asyncSubscription.insertNewItem(2); });
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    asyncSubscription.cancel();
+
+    producer.join();
+}
+
+TEST(Test_AsyncSubcription, insertError_producerBlockedOnFullBuffer_producerReleased) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.setBufferCapacity(1, OverflowPolicy::BLOCK_PRODUCER);
+    asyncSubscription.onError([](const Status&) {});
+    asyncSubscription.insertNewItem(1);
+
+    std::thread producer([&asyncSubscription]() { asyncSubscription.insertNewItem(2); });
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    asyncSubscription.insertError(Status("some error"));
+
+    producer.join();
+    EXPECT_EQ(asyncSubscription.next(), 1);
+}
+
+TEST(Test_AsyncSubcription, next_errorInserted_throwsAsyncException) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.insertError(Status("some error"));
+
+    EXPECT_THROW(asyncSubscription.next(), AsyncException);
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_coalesceDataPointReplies_latestValuePerPathKept) {
+    AsyncSubscription<DataPointReply> asyncSubscription;
+    asyncSubscription.setBufferCapacity(1, OverflowPolicy::COALESCE_LATEST);
+    asyncSubscription.insertNewItem(
+        DataPointReply({{"A", std::make_shared<TypedDataPointValue<int32_t>>("A", 1)},
+                        {"B", std::make_shared<TypedDataPointValue<int32_t>>("B", 1)}}));
+    asyncSubscription.insertNewItem(
+        DataPointReply({{"B", std::make_shared<TypedDataPointValue<int32_t>>("B", 2)}}));
+
+    auto reply = asyncSubscription.next();
+    EXPECT_EQ("1", reply.getUntyped("A")->getValueAsString());
+    EXPECT_EQ("2", reply.getUntyped("B")->getValueAsString());
+    EXPECT_EQ(1, asyncSubscription.getNumCoalescedItems());
+}
+
+TEST(Test_AsyncSubcription, addSignals_noChangeHandler_throws) {
+    AsyncSubscription<DataPointReply> asyncSubscription;
+
+    EXPECT_THROW(asyncSubscription.addSignals({"A"}), std::runtime_error);
+    EXPECT_THROW(asyncSubscription.removeSignals({"A"}), std::runtime_error);
+}
+
+TEST(Test_AsyncSubcription, addAndRemoveSignals_changeHandlerSet_handlerCalledWithChange) {
+    using SignalSetChange_t = std::pair<std::vector<std::string>, std::vector<std::string>>;
+    AsyncSubscription<DataPointReply> asyncSubscription;
+    std::vector<SignalSetChange_t>    changes;
+    asyncSubscription.setSignalSetChangeHandler(
+        [&changes](const auto& addedSignalPaths, const auto& removedSignalPaths) {
+            changes.emplace_back(addedSignalPaths, removedSignalPaths);
+        });
+
+    asyncSubscription.addSignals({"A", "B"});
+    asyncSubscription.removeSignals({"C"});
+
+    ASSERT_EQ(2, changes.size());
+    EXPECT_EQ(std::vector<std::string>({"A", "B"}), changes[0].first);
+    EXPECT_TRUE(changes[0].second.empty());
+    EXPECT_TRUE(changes[1].first.empty());
+    EXPECT_EQ(std::vector<std::string>({"C"}), changes[1].second);
+}
+
+TEST(Test_AsyncSubcription, setObserver_itemsAndErrorInsertedBefore_observedAndStillBuffered) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.insertNewItem(1);
+    asyncSubscription.insertNewItem(2);
+    asyncSubscription.insertError(Status("failed"));
+    std::vector<int>         observedItems;
+    std::vector<std::string> observedErrors;
+
+    asyncSubscription.setObserver(
+        [&observedItems](const int& item) { observedItems.push_back(item); },
+        [&observedErrors](const Status& status) {
+            observedErrors.push_back(status.errorMessage());
+        });
+    asyncSubscription.insertNewItem(3);
+
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), observedItems);
+    EXPECT_EQ(std::vector<std::string>({"failed"}), observedErrors);
+    EXPECT_THROW(asyncSubscription.next(), AsyncException);
+}
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Coroutines.h"
+
+#include <atomic>
+#include <future>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+
+namespace {
+constexpr auto DEFAULT_TIMEOUT = 10s;
+
+Task<int> awaitResult(AsyncResultPtr_t<int> result) { co_return co_await result; }
+
+Task<int> addOne(AsyncResultPtr_t<int> result) {
+    const auto value = co_await awaitResult(std::move(result));
+    co_return value + 1;
+}
+
+Task<> forwardTo(Task<int> task, std::promise<int>& promise) {
+    try {
+        promise.set_value(co_await std::move(task));
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+    }
+}
+} // namespace
+
+TEST(Test_Coroutines, coAwait_resultInsertedLater_resumesWithValue) {
+    auto              result = std::make_shared<AsyncResult<int>>();
+    std::promise<int> promise;
+    spawn(forwardTo(awaitResult(result), promise));
+
+    result->insertResult(42);
+    auto future = promise.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ(42, future.get());
+}
+
+TEST(Test_Coroutines, coAwait_resultAlreadyAvailable_continuesWithValue) {
+    auto result = std::make_shared<AsyncResult<int>>();
+    result->insertResult(7);
+    std::promise<int> promise;
+    spawn(forwardTo(addOne(result), promise));
+
+    auto future = promise.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ(8, future.get());
+}
+
+TEST(Test_Coroutines, coAwait_errorInserted_throwsAsyncException) {
+    auto              result = std::make_shared<AsyncResult<int>>();
+    std::promise<int> promise;
+    spawn(forwardTo(addOne(result), promise));
+
+    result->insertError(Status("some error"));
+    auto future = promise.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_THROW(future.get(), AsyncException);
+}
+
+TEST(Test_Coroutines, spawn_manyPendingTasksOnSingleThread_allComplete) {
+    constexpr int NUM_TASKS = 1000;
+
+    auto executor = std::make_shared<ThreadPool>(1);
+
+    std::vector<AsyncResultPtr_t<int>> results;
+    std::atomic_int                    sum{0};
+    std::atomic_int                    numCompleted{0};
+    std::promise<void>                 allCompleted;
+    for (int i = 0; i < NUM_TASKS; ++i) {
+        results.push_back(std::make_shared<AsyncResult<int>>());
+        spawn(
+            [](AsyncResultPtr_t<int> result, std::atomic_int& sum, std::atomic_int& numCompleted,
+               std::promise<void>& allCompleted) -> Task<> {
+                sum += co_await result;
+                if (++numCompleted == NUM_TASKS) {
+                    allCompleted.set_value();
+                }
+            }(results.back(), sum, numCompleted, allCompleted),
+            executor);
+    }
+
+    for (auto& result : results) {
+        result->insertResult(1);
+    }
+    EXPECT_EQ(std::future_status::ready, allCompleted.get_future().wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ(NUM_TASKS, sum);
+}
+
+TEST(Test_Coroutines, subscriptionStream_itemsInserted_yieldedInOrder) {
+    auto                         subscription = std::make_shared<AsyncSubscription<int>>();
+    AsyncSubscriptionStream<int> stream{subscription};
+
+    std::promise<std::vector<int>> promise;
+    spawn([](AsyncSubscriptionStream<int>&   stream,
+             std::promise<std::vector<int>>& promise) -> Task<> {
+        std::vector<int> items;
+        for (int i = 0; i < 3; ++i) {
+            items.push_back(co_await stream.next());
+        }
+        promise.set_value(items);
+    }(stream, promise));
+
+    subscription->insertNewItem(1);
+    subscription->insertNewItem(2);
+    subscription->insertNewItem(3);
+
+    auto future = promise.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), future.get());
+}
+
+TEST(Test_Coroutines, subscriptionStream_errorInserted_throwsAsyncException) {
+    auto                         subscription = std::make_shared<AsyncSubscription<int>>();
+    AsyncSubscriptionStream<int> stream{subscription};
+
+    std::promise<void> promise;
+    spawn([](AsyncSubscriptionStream<int>& stream, std::promise<void>& promise) -> Task<> {
+        try {
+            co_await stream.next();
+        } catch (const AsyncException&) {
+            promise.set_value();
+        }
+    }(stream, promise));
+
+    subscription->insertError(Status("some error"));
+
+    EXPECT_EQ(std::future_status::ready, promise.get_future().wait_for(DEFAULT_TIMEOUT));
+}
@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/DataPointReply.h"
+
+#include "sdk/DataPoint.h"
+#include "sdk/Exceptions.h"
+
+#include <gtest/gtest.h>
+
+using namespace velocitas;
+
+namespace {
+std::shared_ptr<DataPointValue> createValue(const std::string& path, int32_t value) {
+    return std::make_shared<TypedDataPointValue<int32_t>>(path, value);
+}
+} // namespace
+
+TEST(Test_DataPointReply, defaultConstructed_isEmpty) {
+    DataPointReply cut;
+    EXPECT_TRUE(cut.empty());
+    EXPECT_THROW(cut.getUntyped("A"), InvalidValueException);
+}
+
+TEST(Test_DataPointReply, constructedFromMap_containsAllValues) {
+    auto valueA = createValue("A", 1);
+    auto valueB = createValue("B", 2);
+
+    DataPointReply cut(DataPointMap_t{{"B", valueB}, {"A", valueA}});
+
+    EXPECT_FALSE(cut.empty());
+    EXPECT_EQ(*valueA, *cut.getUntyped("A"));
+    EXPECT_EQ(*valueB, *cut.getUntyped("B"));
+    EXPECT_THROW(cut.getUntyped("C"), InvalidValueException);
+}
+
+TEST(Test_DataPointReply, constructedFromValues_lastValueOfPathWins) {
+    std::vector<DataPointValue> values{TypedDataPointValue<int32_t>("B", 1),
+                                       TypedDataPointValue<int32_t>("A", 2),
+                                       TypedDataPointValue<int32_t>("B", 3)};
+
+    DataPointReply cut(std::move(values));
+
+    EXPECT_EQ(std::vector<std::string>({"A", "B"}), cut.getLayout()->getPaths());
+    EXPECT_EQ("2", cut.getUntyped("A")->getValueAsString());
+    EXPECT_EQ("3", cut.getUntyped("B")->getValueAsString());
+}
+
+TEST(Test_DataPointReply, constructedFromLayout_sharesValues) {
+    auto layout = std::make_shared<const DataPointLayout>(std::vector<std::string>{"B", "A"});
+    auto values = std::make_shared<const DataPointValues_t>(
+        DataPointValues_t{TypedDataPointValue<int32_t>("A", 1), std::nullopt});
+
+    DataPointReply cut(layout, values);
+    DataPointReply copy(cut);
+
+    EXPECT_EQ(&*(*values)[0], copy.getUntyped("A").get());
+    EXPECT_THROW(copy.getUntyped("B"), InvalidValueException);
+    EXPECT_EQ(3, values.use_count());
+}
+
+TEST(Test_DataPointReply, getUntyped_keepsValuesAlive) {
+    std::shared_ptr<DataPointValue> value;
+    {
+        DataPointReply cut(DataPointMap_t{{"A", createValue("A", 1)}});
+        value = cut.getUntyped("A");
+    }
+    EXPECT_EQ("1", value->getValueAsString());
+}
+
+TEST(Test_DataPointReply, get_returnsTypedValue) {
+    DataPointInt32 dataPoint("A");
+    DataPointReply cut(DataPointMap_t{{"A", createValue("A", 42)}});
+
+    EXPECT_EQ(42, cut.get(dataPoint)->value());
+    EXPECT_EQ(42, cut.get(dataPoint, cut.getHandle("A"))->value());
+}
+
+TEST(Test_DataPointReply, get_wrongType_returnsNullptr) {
+    DataPointFloat dataPoint("A");
+    DataPointReply cut(DataPointMap_t{{"A", createValue("A", 42)}});
+
+    EXPECT_EQ(nullptr, cut.get(dataPoint));
+}
+
+TEST(Test_DataPointReply, get_invalidValue_returnsTypedValueWithFailure) {
+    DataPointFloat dataPoint("A");
+    DataPointReply cut(DataPointMap_t{
+        {"A", std::make_shared<DataPointValue>(DataPointValue::Type::INVALID, "A", Timestamp{},
+                                               DataPointValue::Failure::NOT_AVAILABLE)}});
+
+    auto value = cut.get(dataPoint);
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE, value->getFailure());
+    EXPECT_THROW(std::ignore = value->value(), InvalidValueException);
+}
+
+TEST(Test_DataPointReply, getHandle_validForAllRepliesOfSameLayout) {
+    auto layout = std::make_shared<const DataPointLayout>(std::vector<std::string>{"A", "B"});
+
+    DataPointReply reply1(layout, std::make_shared<const DataPointValues_t>(DataPointValues_t{
+                                      std::nullopt, TypedDataPointValue<int32_t>("B", 1)}));
+    DataPointReply reply2(layout, std::make_shared<const DataPointValues_t>(DataPointValues_t{
+                                      std::nullopt, TypedDataPointValue<int32_t>("B", 2)}));
+
+    const auto handle = reply1.getHandle("B");
+    EXPECT_EQ("1", reply1.getUntyped(handle)->getValueAsString());
+    EXPECT_EQ("2", reply2.getUntyped(handle)->getValueAsString());
+    EXPECT_EQ(DataPointReply::INVALID_HANDLE, reply1.getHandle("C"));
+    EXPECT_THROW(reply1.getUntyped(DataPointReply::INVALID_HANDLE), InvalidValueException);
+    EXPECT_THROW(reply1.getUntyped(reply1.getHandle("A")), InvalidValueException);
+}
+
+TEST(Test_DataPointLayout, constructor_sortsAndRemovesDuplicates) {
+    DataPointLayout cut({"C", "A", "B", "A"});
+
+    EXPECT_EQ(std::vector<std::string>({"A", "B", "C"}), cut.getPaths());
+    EXPECT_EQ(1, cut.findHandle("B"));
+    EXPECT_EQ(DataPointLayout::INVALID_HANDLE, cut.findHandle("D"));
+}
+
+TEST(Test_DataPointReply, merge_sameLayoutNewerContainsAllValues_takesNewerValues) {
+    auto layout      = std::make_shared<const DataPointLayout>(std::vector<std::string>{"A", "B"});
+    auto newerValues = std::make_shared<const DataPointValues_t>(DataPointValues_t{
+        TypedDataPointValue<int32_t>("A", 2), TypedDataPointValue<int32_t>("B", 3)});
+
+    DataPointReply cut(layout, std::make_shared<const DataPointValues_t>(DataPointValues_t{
+                                   TypedDataPointValue<int32_t>("A", 1), std::nullopt}));
+    cut.merge(DataPointReply(layout, newerValues));
+
+    EXPECT_EQ("2", cut.getUntyped("A")->getValueAsString());
+    EXPECT_EQ("3", cut.getUntyped("B")->getValueAsString());
+    EXPECT_EQ(2, newerValues.use_count());
+}
+
+TEST(Test_DataPointReply, merge_sameLayoutNewerMissesValues_keepsOlderValuesWithoutModifyingNewer) {
+    auto layout      = std::make_shared<const DataPointLayout>(std::vector<std::string>{"A", "B"});
+    auto newerValues = std::make_shared<const DataPointValues_t>(
+        DataPointValues_t{std::nullopt, TypedDataPointValue<int32_t>("B", 3)});
+
+    DataPointReply cut(layout, std::make_shared<const DataPointValues_t>(DataPointValues_t{
+                                   TypedDataPointValue<int32_t>("A", 1),
+                                   TypedDataPointValue<int32_t>("B", 2)}));
+    cut.merge(DataPointReply(layout, newerValues));
+
+    EXPECT_EQ("1", cut.getUntyped("A")->getValueAsString());
+    EXPECT_EQ("3", cut.getUntyped("B")->getValueAsString());
+    EXPECT_FALSE((*newerValues)[0].has_value());
+}
+
+TEST(Test_DataPointReply, merge_differentLayouts_containsValuesOfBoth) {
+    DataPointReply cut(DataPointMap_t{{"A", createValue("A", 1)}, {"B", createValue("B", 2)}});
+    cut.merge(DataPointReply(DataPointMap_t{{"B", createValue("B", 3)}}));
+
+    EXPECT_EQ("1", cut.getUntyped("A")->getValueAsString());
+    EXPECT_EQ("3", cut.getUntyped("B")->getValueAsString());
+}
+
+TEST(Test_DataPointReply, coalescingSubscription_deliversLatestValues) {
+    AsyncSubscription<DataPointReply> subscription;
+    subscription.setBufferCapacity(1, OverflowPolicy::COALESCE_LATEST);
+
+    subscription.insertNewItem(DataPointReply(DataPointMap_t{{"A", createValue("A", 1)}}));
+    subscription.insertNewItem(DataPointReply(DataPointMap_t{{"B", createValue("B", 2)}}));
+    subscription.insertNewItem(DataPointReply(DataPointMap_t{{"A", createValue("A", 3)}}));
+
+    auto reply = subscription.next();
+    EXPECT_EQ("3", reply.getUntyped("A")->getValueAsString());
+    EXPECT_EQ("2", reply.getUntyped("B")->getValueAsString());
+    EXPECT_EQ(2, subscription.getNumCoalescedItems());
+}
+
+TEST(Test_DataPointLayout, findHandleById_matchesFindHandle) {
+    DataPointLayout cut({"C", "A", "B"});
+
+    auto& registry = PathRegistry::getInstance();
+    for (const auto& path : cut.getPaths()) {
+        EXPECT_EQ(cut.findHandle(path), cut.findHandleById(registry.find(path)));
+    }
+    EXPECT_EQ(DataPointLayout::INVALID_HANDLE,
+              cut.findHandleById(registry.intern("Not.Part.Of.Layout")));
+}
@@ -214,3 +214,34 @@ TEST(Test_TypedDataPointValue, ctorWithValue__allMembersSetCorrectly) {
     checkTypedDataPointValueCtor<std::vector<double>>({-9.87654321, 0.0, 0.1, 1.23456789});
     checkTypedDataPointValueCtor<std::vector<std::string>>({"", "hello", "world", "!"});
 }
+
+TEST(Test_TypedDataPointValue, getValueAs__matchingType_returnsValue) {
+    const DataPointValue cut = TypedDataPointValue<std::string>("some.path", "hello");
+
+    EXPECT_EQ("hello", cut.getValueAs<std::string>());
+    EXPECT_THROW(std::ignore = cut.getValueAs<int32_t>(), InvalidTypeException);
+}
+
+TEST(Test_TypedDataPointValue, getValueAs__invalidValue_throws) {
+    const DataPointValue cut =
+        TypedDataPointValue<float>("some.path", DataPointValue::Failure::NOT_AVAILABLE);
+
+    EXPECT_THROW(std::ignore = cut.getValueAs<float>(), InvalidValueException);
+}
+
+TEST(Test_TypedDataPointValue, ctorFromUntyped__keepsAllMembers) {
+    const DataPointValue untyped = TypedDataPointValue<uint16_t>("some.path", 42, Timestamp{1, 2});
+
+    TypedDataPointValue<uint16_t> cut(untyped);
+
+    EXPECT_EQ(untyped, cut);
+    EXPECT_EQ(42, cut.value());
+    EXPECT_THROW(TypedDataPointValue<int16_t>{untyped}, InvalidTypeException);
+}
+
+TEST(Test_TypedDataPointValue, equality__comparesValues) {
+    EXPECT_EQ(TypedDataPointValue<int32_t>("some.path", 1),
+              TypedDataPointValue<int32_t>("some.path", 1));
+    EXPECT_NE(TypedDataPointValue<int32_t>("some.path", 1),
+              TypedDataPointValue<int32_t>("some.path", 2));
+}
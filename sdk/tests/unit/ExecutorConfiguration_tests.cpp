@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/ExecutorConfiguration.h"
+
+#include "TestBaseUsingEnvVars.h"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace velocitas;
+
+class Test_ExecutorConfiguration : public TestUsingEnvVars {
+protected:
+    void TearDown() override {
+        std::remove(CONFIG_FILE_PATH);
+        TestUsingEnvVars::TearDown();
+    }
+
+    void writeConfigFile(const std::string& content) {
+        std::ofstream(CONFIG_FILE_PATH) << content;
+        setEnvVar("SDV_EXECUTOR_CONFIG_PATH", CONFIG_FILE_PATH);
+    }
+
+    static constexpr char const* CONFIG_FILE_PATH = "executor_config_test.json";
+};
+
+TEST_F(Test_ExecutorConfiguration, getExecutorConfig_noConfigFile_builtInDefaults) {
+    unsetEnvVar("SDV_EXECUTOR_CONFIG_PATH");
+
+    EXPECT_EQ(2, getExecutorConfig(executors::DEFAULT).m_numWorkerThreads);
+    EXPECT_EQ(1, getExecutorConfig(executors::SDK_INTERNAL).m_numWorkerThreads);
+    EXPECT_EQ(1, getExecutorConfig(executors::PUBSUB).m_numWorkerThreads);
+    EXPECT_TRUE(getExecutorConfig(executors::DEFAULT).m_cpuAffinity.empty());
+    EXPECT_EQ(ThreadPoolConfig::SchedulingPolicy::DEFAULT,
+              getExecutorConfig(executors::DEFAULT).m_schedulingPolicy);
+}
+
+TEST_F(Test_ExecutorConfiguration, getExecutorConfig_configuredExecutor_valuesFromFile) {
+    writeConfigFile(R"({"executors": {"myExecutor": {"numWorkerThreads": 4, "cpuAffinity": [0, 2],
+                        "schedulingPolicy": "RR", "schedulingPriority": 5}}})");
+
+    const auto config = getExecutorConfig("myExecutor");
+    EXPECT_EQ(4, config.m_numWorkerThreads);
+    EXPECT_EQ((std::vector<int>{0, 2}), config.m_cpuAffinity);
+    EXPECT_EQ(ThreadPoolConfig::SchedulingPolicy::ROUND_ROBIN, config.m_schedulingPolicy);
+    EXPECT_EQ(5, config.m_schedulingPriority);
+}
+
+TEST_F(Test_ExecutorConfiguration, getExecutorConfig_partialConfig_builtInDefaultsForMissingKeys) {
+    writeConfigFile(R"({"executors": {"sdk.internal": {"cpuAffinity": [1]}}})");
+
+    const auto config = getExecutorConfig(executors::SDK_INTERNAL);
+    EXPECT_EQ(1, config.m_numWorkerThreads);
+    EXPECT_EQ((std::vector<int>{1}), config.m_cpuAffinity);
+}
+
+TEST_F(Test_ExecutorConfiguration, getExecutorConfig_invalidValues_ignored) {
+    writeConfigFile(R"({"executors": {"default": {"numWorkerThreads": 0,
+                        "schedulingPolicy": "unknown"}}})");
+
+    const auto config = getExecutorConfig(executors::DEFAULT);
+    EXPECT_EQ(2, config.m_numWorkerThreads);
+    EXPECT_EQ(ThreadPoolConfig::SchedulingPolicy::DEFAULT, config.m_schedulingPolicy);
+}
+
+TEST_F(Test_ExecutorConfiguration, getExecutorConfig_malformedFile_builtInDefaults) {
+    writeConfigFile("{ this is not json");
+
+    EXPECT_EQ(2, getExecutorConfig(executors::DEFAULT).m_numWorkerThreads);
+}
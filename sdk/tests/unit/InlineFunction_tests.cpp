@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/InlineFunction.h"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace velocitas;
+
+TEST(Test_InlineFunction, defaultConstructed_isEmpty) {
+    InlineFunction<void()> function;
+    EXPECT_FALSE(function);
+    EXPECT_THROW(function(), std::bad_function_call);
+}
+
+TEST(Test_InlineFunction, emptyStdFunction_isEmpty) {
+    InlineFunction<void()> function{std::function<void()>()};
+    EXPECT_FALSE(function);
+}
+
+TEST(Test_InlineFunction, smallLambda_invokedWithArguments) {
+    int                           offset = 5;
+    InlineFunction<int(int, int)> function{[offset](int a, int b) { return a + b + offset; }};
+    ASSERT_TRUE(function);
+    EXPECT_EQ(8, function(1, 2));
+}
+
+TEST(Test_InlineFunction, bigLambda_invoked) {
+    std::array<int, 64> values{};
+    values[63] = 7;
+
+    InlineFunction<int()> function{[values]() { return values[63]; }};
+    EXPECT_EQ(7, function());
+}
+
+TEST(Test_InlineFunction, moveConstruct_callableMovedAndCapturesKeptAlive) {
+    auto                   counter = std::make_shared<int>(0);
+    InlineFunction<void()> function{[counter]() { ++*counter; }};
+    EXPECT_EQ(2, counter.use_count());
+
+    InlineFunction<void()> movedTo{std::move(function)};
+    EXPECT_FALSE(function); // NOLINT
+    movedTo();
+    EXPECT_EQ(1, *counter);
+    EXPECT_EQ(2, counter.use_count());
+}
+
+TEST(Test_InlineFunction, reset_capturesReleased) {
+    auto                   counter = std::make_shared<int>(0);
+    InlineFunction<void()> function{[counter]() { ++*counter; }};
+    function.reset();
+    EXPECT_FALSE(function);
+    EXPECT_EQ(1, counter.use_count());
+}
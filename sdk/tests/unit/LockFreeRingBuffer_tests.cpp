@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/LockFreeRingBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+TEST(Test_LockFreeRingBuffer, constructor_capacityRoundedUpToPowerOfTwo) {
+    EXPECT_EQ(8, LockFreeRingBuffer<int>(5).capacity());
+    EXPECT_EQ(8, LockFreeRingBuffer<int>(8).capacity());
+    EXPECT_EQ(2, LockFreeRingBuffer<int>(0).capacity());
+}
+
+TEST(Test_LockFreeRingBuffer, tryPop_afterPushes_itemsInFifoOrder) {
+    LockFreeRingBuffer<int> buffer(4);
+    int                     item = 0;
+    EXPECT_FALSE(buffer.tryPop(item));
+
+    // wrap around several times
+    for (int value = 0; value < 10; ++value) {
+        EXPECT_TRUE(buffer.tryPush(int{value}));
+        EXPECT_TRUE(buffer.tryPush(int{value + 100}));
+        EXPECT_TRUE(buffer.tryPop(item));
+        EXPECT_EQ(value, item);
+        EXPECT_TRUE(buffer.tryPop(item));
+        EXPECT_EQ(value + 100, item);
+    }
+    EXPECT_FALSE(buffer.tryPop(item));
+}
+
+TEST(Test_LockFreeRingBuffer, tryPush_full_failsWithoutMovingItem) {
+    LockFreeRingBuffer<std::string> buffer(2);
+    EXPECT_TRUE(buffer.tryPush("a"));
+    EXPECT_TRUE(buffer.tryPush("b"));
+
+    std::string item = "c";
+    EXPECT_FALSE(buffer.tryPush(std::move(item)));
+    EXPECT_EQ("c", item); // NOLINT(bugprone-use-after-move)
+
+    EXPECT_TRUE(buffer.tryPop(item));
+    EXPECT_EQ("a", item);
+    EXPECT_TRUE(buffer.tryPush("c"));
+}
+
+TEST(Test_LockFreeRingBuffer, tryPush_concurrentProducers_allItemsPoppedOnce) {
+    constexpr int NUM_PRODUCERS          = 4;
+    constexpr int NUM_ITEMS_PER_PRODUCER = 10000;
+
+    LockFreeRingBuffer<int>  buffer(64);
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < NUM_PRODUCERS; ++producer) {
+        producers.emplace_back([&buffer, producer]() {
+            for (int index = 0; index < NUM_ITEMS_PER_PRODUCER; ++index) {
+                while (!buffer.tryPush(producer * NUM_ITEMS_PER_PRODUCER + index)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> lastIndexOfProducer(NUM_PRODUCERS, -1);
+    std::vector<int> numPopped(NUM_PRODUCERS, 0);
+    for (int count = 0; count < NUM_PRODUCERS * NUM_ITEMS_PER_PRODUCER;) {
+        int item = 0;
+        if (!buffer.tryPop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto producer = item / NUM_ITEMS_PER_PRODUCER;
+        const auto index    = item % NUM_ITEMS_PER_PRODUCER;
+        // the items of each producer keep their order
+        EXPECT_EQ(lastIndexOfProducer[producer] + 1, index);
+        lastIndexOfProducer[producer] = index;
+        ++numPopped[producer];
+        ++count;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_EQ(std::vector<int>(NUM_PRODUCERS, NUM_ITEMS_PER_PRODUCER), numPopped);
+}
@@ -64,6 +64,8 @@ public:
         logger().setLoggerImplementation(std::move(stringLogger));
     }
 
+    void TearDown() override { logger().setLevel(LogLevel::DEBUG); }
+
     StringLogger* m_stringLogger{};
 };
 
@@ -214,3 +216,24 @@ TEST_F(Test_Logger, debug_withArguments_correctMessageLoggedOnCorrectLevel) {
     EXPECT_EQ(m_stringLogger->getLogLevel(), StringLogger::LogLevel::Debug);
     EXPECT_EQ(m_stringLogger->getLogMessage(), "Foo, 1337, 9.312");
 }
+
+TEST_F(Test_Logger, setLevel_messagesBelowLevel_droppedWithoutFormatting) {
+    logger().setLevel(LogLevel::WARN);
+
+    logger().info("Hello World");
+    // Would throw if the message got formatted
+    EXPECT_NO_THROW(logger().debug("Hello World {} {}", "Next missing"));
+    EXPECT_EQ(m_stringLogger->getLogLevel(), StringLogger::LogLevel::Unknown);
+    EXPECT_FALSE(logger().isEnabled(LogLevel::INFO));
+
+    logger().warn("Hello {}", "World");
+    EXPECT_EQ(m_stringLogger->getLogLevel(), StringLogger::LogLevel::Warn);
+    EXPECT_EQ(m_stringLogger->getLogMessage(), "Hello World");
+}
+
+TEST_F(Test_Logger, setLevel_off_nothingLogged) {
+    logger().setLevel(LogLevel::OFF);
+
+    logger().error("Hello World");
+    EXPECT_EQ(m_stringLogger->getLogLevel(), StringLogger::LogLevel::Unknown);
+}
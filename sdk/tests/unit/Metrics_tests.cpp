@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Metrics.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace velocitas;
+
+namespace {
+
+std::string readFile(const std::string& path) {
+    std::ifstream     file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+std::string readSocket(const std::string& path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    path.copy(address.sun_path, sizeof(address.sun_path) - 1);
+    std::string content;
+    // the exporter might not listen yet
+    for (int attempt = 0; attempt < 100; ++attempt) {
+        const int clientSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (::connect(clientSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            char chunk[256]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+            ssize_t numRead = 0;
+            while ((numRead = ::read(clientSocket, chunk, sizeof(chunk))) > 0) {
+                content.append(chunk, numRead);
+            }
+            ::close(clientSocket);
+            break;
+        }
+        ::close(clientSocket);
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    return content;
+}
+
+} // namespace
+
+TEST(Test_Histogram, getBucketIndex_consecutiveBuckets_boundsConsistent) {
+    for (size_t index = 0; index + 1 < Histogram::NUM_BUCKETS; ++index) {
+        const auto lowerBound = Histogram::getBucketLowerBound(index);
+        const auto upperBound = Histogram::getBucketLowerBound(index + 1);
+        ASSERT_LT(lowerBound, upperBound);
+        EXPECT_EQ(index, Histogram::getBucketIndex(lowerBound));
+        EXPECT_EQ(index, Histogram::getBucketIndex(upperBound - 1));
+    }
+    EXPECT_EQ(Histogram::NUM_BUCKETS - 1, Histogram::getBucketIndex(UINT64_MAX));
+}
+
+TEST(Test_Histogram, getQuantile_recordedValues_withinRelativeError) {
+    Histogram cut;
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        cut.record(value * 1000);
+    }
+
+    const auto snapshot = cut.getSnapshot();
+    EXPECT_EQ(1000, snapshot.m_count);
+    EXPECT_EQ(500500000, snapshot.m_sum);
+    const auto maxError = 1.0 / Histogram::SUB_BUCKET_COUNT;
+    EXPECT_NEAR(500000, snapshot.getQuantile(0.5), 500000 * maxError);
+    EXPECT_NEAR(990000, snapshot.getQuantile(0.99), 990000 * maxError);
+    EXPECT_GE(snapshot.getQuantile(1.0), 1000000);
+    EXPECT_EQ(0, Histogram().getSnapshot().getQuantile(0.5));
+}
+
+TEST(Test_MetricsRegistry, getCounter_sameNameAndLabels_sameInstance) {
+    MetricsRegistry cut;
+
+    auto& counter = cut.getCounter("test_total", "help", {{"a", "1"}});
+    counter.increment(3);
+
+    EXPECT_EQ(&counter, &cut.getCounter("test_total", "help", {{"a", "1"}}));
+    EXPECT_NE(&counter, &cut.getCounter("test_total", "help", {{"a", "2"}}));
+    EXPECT_EQ(3, cut.getCounter("test_total", "help", {{"a", "1"}}).get());
+}
+
+TEST(Test_MetricsRegistry, getGauge_nameUsedByCounter_throws) {
+    MetricsRegistry cut;
+    std::ignore = cut.getCounter("test", "help");
+
+    EXPECT_THROW(std::ignore = cut.getGauge("test", "help"), std::invalid_argument);
+}
+
+TEST(Test_MetricsRegistry, getSnapshot_gaugeCallback_invokedUntilRemoved) {
+    MetricsRegistry cut;
+    int64_t         value = 42;
+    cut.setGaugeCallback("test_queue", "help", {}, [&value]() { return value; });
+
+    auto snapshot = cut.getSnapshot();
+    ASSERT_EQ(1, snapshot.size());
+    EXPECT_EQ(MetricSnapshot::Type::GAUGE, snapshot[0].m_type);
+    EXPECT_EQ(42, snapshot[0].m_value);
+
+    cut.setGaugeCallback("test_queue", "help", {}, nullptr);
+    EXPECT_TRUE(cut.getSnapshot().empty());
+}
+
+TEST(Test_MetricsRegistry, toPrometheusText_allTypes_exposition) {
+    MetricsRegistry cut;
+    cut.getCounter("test_total", "Some counter", {{"method", "a\"b"}}).increment(2);
+    cut.getGauge("test_depth", "Some gauge").set(-1);
+    auto& histogram =
+        cut.getHistogram("test_seconds", "Some histogram", {}, Histogram::NANOSECONDS_PER_SECOND);
+    histogram.record(1);
+    histogram.record(1);
+    histogram.record(9);
+
+    EXPECT_EQ("# HELP test_depth Some gauge\n"
+              "# TYPE test_depth gauge\n"
+              "test_depth -1\n"
+              "# HELP test_seconds Some histogram\n"
+              "# TYPE test_seconds histogram\n"
+              "test_seconds_bucket{le=\"1e-09\"} 2\n"
+              "test_seconds_bucket{le=\"9e-09\"} 3\n"
+              "test_seconds_bucket{le=\"+Inf\"} 3\n"
+              "test_seconds_sum 1.1e-08\n"
+              "test_seconds_count 3\n"
+              "# HELP test_total Some counter\n"
+              "# TYPE test_total counter\n"
+              "test_total{method=\"a\\\"b\"} 2\n",
+              cut.toPrometheusText());
+}
+
+TEST(Test_MetricsRegistry, toPrometheusText_namesSharingPrefix_groupedByName) {
+    MetricsRegistry cut;
+    cut.getCounter("test", "help", {{"a", "1"}});
+    cut.getCounter("test_more", "help");
+    cut.getCounter("test", "help", {{"a", "2"}});
+
+    const auto text = cut.toPrometheusText();
+
+    EXPECT_LT(text.find("test{a=\"2\"}"), text.find("# HELP test_more"));
+}
+
+TEST(Test_MetricsExporter, fileTarget_writtenPeriodically) {
+    MetricsRegistry cut;
+    auto&           counter = cut.getCounter("test_total", "help");
+    const auto      path    = ::testing::TempDir() + "metrics_test.prom";
+    std::remove(path.c_str());
+
+    {
+        MetricsExporter exporter(cut, path, std::chrono::milliseconds{10});
+        for (int attempt = 0; (attempt < 100) && readFile(path).empty(); ++attempt) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+        EXPECT_NE(std::string::npos, readFile(path).find("test_total 0\n"));
+        counter.increment();
+    }
+
+    // written once more when stopping the exporter
+    EXPECT_NE(std::string::npos, readFile(path).find("test_total 1\n"));
+    std::remove(path.c_str());
+}
+
+TEST(Test_MetricsExporter, socketTarget_servedPerConnection) {
+    MetricsRegistry cut;
+    cut.getCounter("test_total", "help").increment(5);
+    const auto path = ::testing::TempDir() + "metrics_test.sock";
+
+    MetricsExporter exporter(cut, "unix:" + path);
+
+    EXPECT_NE(std::string::npos, readSocket(path).find("test_total 5\n"));
+    cut.getCounter("test_total", "help").increment();
+    EXPECT_NE(std::string::npos, readSocket(path).find("test_total 6\n"));
+}
@@ -35,3 +35,14 @@ TEST(Test_Node, constructor_withParent_isLeaf) {
     EXPECT_EQ(node.getParent(), &nodeRoot);
     EXPECT_EQ(node.getPath(), "root.foo");
 }
+
+TEST(Test_Node, getPathId_samePathInDifferentTrees_sameId) {
+    Node nodeRoot{"root"};
+    Node node{"foo", &nodeRoot};
+    Node otherRoot{"root"};
+    Node otherNode{"foo", &otherRoot};
+
+    EXPECT_EQ(node.getPathId(), otherNode.getPathId());
+    EXPECT_NE(node.getPathId(), nodeRoot.getPathId());
+    EXPECT_EQ(PathRegistry::getInstance().getPath(node.getPathId()), "root.foo");
+}
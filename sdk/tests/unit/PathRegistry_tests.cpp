@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2022-2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/PathRegistry.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+TEST(Test_PathRegistry, intern_samePathTwice_returnsSameId) {
+    PathRegistry cut;
+
+    const auto pathId = cut.intern("Vehicle.Speed");
+
+    EXPECT_EQ(pathId, cut.intern(std::string("Vehicle.Speed")));
+    EXPECT_NE(pathId, cut.intern("Vehicle.Cabin"));
+    EXPECT_EQ(2, cut.size());
+}
+
+TEST(Test_PathRegistry, find_unknownPath_returnsInvalidIdWithoutInterning) {
+    PathRegistry cut;
+
+    EXPECT_EQ(PathRegistry::INVALID_ID, cut.find("Vehicle.Speed"));
+    EXPECT_EQ(0, cut.size());
+}
+
+TEST(Test_PathRegistry, getPath_returnsStableView) {
+    PathRegistry cut;
+
+    const auto pathId = cut.intern("Vehicle.Speed");
+    const auto path   = cut.getPath(pathId);
+    for (int i = 0; i < 1000; ++i) {
+        cut.intern("Vehicle.Signal" + std::to_string(i));
+    }
+
+    EXPECT_EQ("Vehicle.Speed", path);
+    EXPECT_EQ(path.data(), cut.getPath(pathId).data());
+    EXPECT_TRUE(cut.getPath(PathRegistry::INVALID_ID).empty());
+}
+
+TEST(Test_PathRegistry, intern_concurrently_assignsOneIdPerPath) {
+    PathRegistry cut;
+
+    const int                numThreads = 4;
+    const int                numPaths   = 200;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&cut]() {
+            for (int i = 0; i < numPaths; ++i) {
+                cut.intern("Vehicle.Signal" + std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numPaths, cut.size());
+    for (int i = 0; i < numPaths; ++i) {
+        const auto path = "Vehicle.Signal" + std::to_string(i);
+        EXPECT_EQ(path, cut.getPath(cut.find(path)));
+    }
+}
+
+TEST(Test_PathRegistry, internPath_samePathTwice_sharesStorage) {
+    PathRegistry cut;
+
+    const auto path = cut.internPath("Vehicle.Speed");
+
+    EXPECT_EQ("Vehicle.Speed", path.str());
+    EXPECT_EQ(cut.intern("Vehicle.Speed"), path.getId());
+    EXPECT_EQ(&path.str(), &cut.internPath(std::string("Vehicle.Speed")).str());
+    EXPECT_NE(path, cut.internPath("Vehicle.Cabin"));
+}
+
+TEST(Test_InternedPath, defaultConstructed_isEmpty) {
+    const InternedPath path;
+
+    EXPECT_TRUE(path.str().empty());
+    EXPECT_EQ(PathRegistry::INVALID_ID, path.getId());
+}
+
+TEST(Test_InternedPath, constructFromString_equalToSamePath) {
+    EXPECT_EQ(InternedPath("Vehicle.Speed"), InternedPath(std::string("Vehicle.Speed")));
+    EXPECT_EQ("Vehicle.Speed", InternedPath("Vehicle.Speed").str());
+}
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/RingBuffer.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace velocitas;
+
+TEST(Test_RingBuffer, pushAndPop_interleavedAcrossWrapAround_fifoOrder) {
+    RingBuffer<int> buffer(4);
+    int             nextToPush = 0;
+    int             nextToPop  = 0;
+    for (int round = 0; round < 10; ++round) {
+        buffer.push_back(int{nextToPush++});
+        buffer.push_back(int{nextToPush++});
+        buffer.push_back(int{nextToPush++});
+        EXPECT_EQ(nextToPop++, buffer.pop_front());
+        EXPECT_EQ(nextToPop++, buffer.pop_front());
+    }
+    EXPECT_EQ(10, buffer.size());
+    EXPECT_EQ(nextToPop, buffer.front());
+    EXPECT_EQ(nextToPush - 1, buffer.back());
+    while (!buffer.empty()) {
+        EXPECT_EQ(nextToPop++, buffer.pop_front());
+    }
+}
+
+TEST(Test_RingBuffer, indexOperator_acrossWrapAround_itemsInFifoOrder) {
+    RingBuffer<int> buffer(4);
+    for (int item = 0; item < 6; ++item) {
+        buffer.push_back(int{item});
+    }
+    buffer.pop_front();
+    buffer.pop_front();
+    buffer.push_back(6);
+
+    ASSERT_EQ(5, buffer.size());
+    for (size_t index = 0; index < buffer.size(); ++index) {
+        EXPECT_EQ(static_cast<int>(index) + 2, buffer[index]);
+    }
+}
+
+TEST(Test_RingBuffer, popFront_itemHoldingResource_resourceReleasedFromStorage) {
+    RingBuffer<std::shared_ptr<int>> buffer;
+    auto                             resource = std::make_shared<int>(1);
+    buffer.push_back(std::shared_ptr<int>(resource));
+    buffer.pop_front();
+
+    EXPECT_EQ(1, resource.use_count());
+}
+
+TEST(Test_RingBuffer, clear_filledBuffer_empty) {
+    RingBuffer<int> buffer;
+    buffer.push_back(1);
+    buffer.push_back(2);
+    buffer.clear();
+
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(0, buffer.size());
+}
+
+TEST(Test_RingBuffer, pushBack_moveOnlyItemWithoutDefaultConstructor_growsAndKeepsOrder) {
+    struct Item {
+        explicit Item(int value)
+            : m_value(std::make_unique<int>(value)) {}
+        std::unique_ptr<int> m_value;
+    };
+    RingBuffer<Item> buffer(1);
+    buffer.push_back(Item(1));
+    buffer.push_back(Item(2));
+
+    EXPECT_EQ(1, *buffer.pop_front().m_value);
+    EXPECT_EQ(2, *buffer.pop_front().m_value);
+}
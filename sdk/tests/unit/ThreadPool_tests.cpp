@@ -18,7 +18,9 @@
 
 #include <atomic>
 #include <exception>
+#include <future>
 #include <gtest/gtest.h>
+#include <vector>
 
 using namespace velocitas;
 using namespace std::chrono_literals;
@@ -140,8 +142,32 @@ TEST_F(Test_ThreadPool, getInstance_multipleCalls_returnsSameInstance) {
     EXPECT_EQ(pool1, pool2);
 }
 
+TEST_F(Test_ThreadPool, getInstance_defaultExecutor_returnsDefaultInstance) {
+    EXPECT_EQ(ThreadPool::getInstance(), ThreadPool::getInstance(executors::DEFAULT));
+}
+
+TEST_F(Test_ThreadPool, getInstance_differentExecutorNames_returnsDifferentInstances) {
+    auto internalPool = ThreadPool::getInstance(executors::SDK_INTERNAL);
+    EXPECT_NE(nullptr, internalPool);
+    EXPECT_NE(ThreadPool::getInstance(), internalPool);
+    EXPECT_EQ(internalPool, ThreadPool::getInstance(executors::SDK_INTERNAL));
+}
+
 TEST_F(Test_ThreadPool, callThreadPoolCtr_success) { EXPECT_NO_THROW(ThreadPool()); }
 
+TEST_F(Test_ThreadPool, callThreadPoolCtr_withConfig_configuredNumberOfWorkers) {
+    ThreadPoolConfig config;
+    config.m_numWorkerThreads = 3;
+    config.m_cpuAffinity      = {0};
+
+    ThreadPool pool(config);
+    EXPECT_EQ(3, pool.getNumWorkerThreads());
+
+    std::promise<void> executed;
+    pool.enqueue(Job::create([&executed]() { executed.set_value(); }));
+    EXPECT_EQ(std::future_status::ready, executed.get_future().wait_for(DEFAULT_TIMEOUT));
+}
+
 TEST_F(Test_ThreadPool, enqueue_firstJob_jobExecuting) {
     auto job = std::make_shared<FakeJob>();
     ASSERT_EQ(FakeJob::Initialized, job->getExecutionState());
@@ -242,3 +268,99 @@ TEST_F(Test_ThreadPool, jobThrows_executing_workerNotTerminated) {
     // It should be still possible to get jobs executed on all (initial) workers
     EXPECT_TRUE(occupyAllWorkers());
 }
+
+TEST_F(Test_ThreadPool, enqueue_delayedJob_notExecutedBeforeDue) {
+    std::promise<Timepoint> executed;
+    const auto              enqueued = Clock::now();
+    m_pool->enqueue(Job::create([&executed]() { executed.set_value(Clock::now()); }, 50ms));
+
+    auto executedAt = executed.get_future();
+    ASSERT_EQ(std::future_status::ready, executedAt.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_GE(executedAt.get() - enqueued, 50ms);
+}
+
+TEST_F(Test_ThreadPool, enqueue_multipleDelayedJobs_executedInOrderOfDueTime) {
+    std::mutex         orderMutex;
+    std::vector<int>   order;
+    std::promise<void> allExecuted;
+    auto               addToOrder = [&](int value) {
+        std::lock_guard lock(orderMutex);
+        order.push_back(value);
+        if (order.size() == 3) {
+            allExecuted.set_value();
+        }
+    };
+    m_pool->enqueue(Job::create([&addToOrder]() { addToOrder(3); }, 60ms));
+    m_pool->enqueue(Job::create([&addToOrder]() { addToOrder(1); }, 20ms));
+    m_pool->enqueue(Job::create([&addToOrder]() { addToOrder(2); }, 40ms));
+
+    ASSERT_EQ(std::future_status::ready, allExecuted.get_future().wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), order);
+}
+
+TEST_F(Test_ThreadPool, enqueue_delayedJobWhileAllWorkersOccupied_executedOnceWorkerIsFree) {
+    ASSERT_TRUE(occupyAllWorkers());
+    std::promise<void> executed;
+    m_pool->enqueue(Job::create([&executed]() { executed.set_value(); }, 10ms));
+
+    auto executedFuture = executed.get_future();
+    EXPECT_EQ(std::future_status::timeout, executedFuture.wait_for(30ms));
+    ASSERT_TRUE(finishJob(m_fakeJobs.front()));
+    EXPECT_EQ(std::future_status::ready, executedFuture.wait_for(DEFAULT_TIMEOUT));
+}
+
+TEST_F(Test_ThreadPool, enqueueFromWorker_workerStillBusy_jobStolenByIdleWorker) {
+    auto blockingJob = std::make_shared<FakeJob>();
+    m_fakeJobs.push(blockingJob);
+    auto stolenJob = std::make_shared<FakeJob>();
+    m_fakeJobs.push(stolenJob);
+
+    m_pool->enqueue(Job::create([this, blockingJob, stolenJob]() {
+        // lands in the local queue of this worker which is then blocked
+        m_pool->enqueue(stolenJob);
+        blockingJob->execute();
+    }));
+
+    ASSERT_TRUE(blockingJob->waitForExecution());
+    EXPECT_TRUE(stolenJob->waitForExecution());
+}
+
+TEST_F(Test_ThreadPool, enqueue_manyJobsFromMultipleThreads_allExecuted) {
+    constexpr int NUM_PRODUCERS         = 4;
+    constexpr int NUM_JOBS_PER_PRODUCER = 1000;
+
+    std::atomic_int    numExecuted{0};
+    std::promise<void> allExecuted;
+    auto               job = [&numExecuted, &allExecuted]() {
+        if (++numExecuted == NUM_PRODUCERS * NUM_JOBS_PER_PRODUCER) {
+            allExecuted.set_value();
+        }
+    };
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < NUM_PRODUCERS; ++i) {
+        producers.emplace_back([this, &job]() {
+            for (int j = 0; j < NUM_JOBS_PER_PRODUCER; ++j) {
+                m_pool->enqueue(Job::create(job));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_EQ(std::future_status::ready, allExecuted.get_future().wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ(NUM_PRODUCERS * NUM_JOBS_PER_PRODUCER, numExecuted);
+}
+
+TEST_F(Test_ThreadPool, releaseLastReferenceWithinOwnJob_poolDestroyedCleanly) {
+    std::promise<void> released;
+    auto               pool = std::make_shared<ThreadPool>(1);
+    pool->enqueue(Job::create([pool, &released]() mutable {
+        pool.reset();
+        released.set_value();
+    }));
+    pool.reset();
+
+    EXPECT_EQ(std::future_status::ready, released.get_future().wait_for(DEFAULT_TIMEOUT));
+}
@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/grpc/GrpcCall.h"
+
+#include "kuksa/val/v2/val.pb.h"
+
+#include <gtest/gtest.h>
+
+using namespace velocitas;
+
+using GetValuesCall_t =
+    GrpcSingleResponseCall<kuksa::val::v2::GetValuesRequest, kuksa::val::v2::GetValuesResponse>;
+
+TEST(Test_GrpcCall, singleResponseCall_defaultConstructed_messagesOnSameArena) {
+    GetValuesCall_t cut;
+
+    ASSERT_NE(nullptr, cut.getResponse().GetArena());
+    EXPECT_EQ(cut.getResponse().GetArena(), cut.getRequest().GetArena());
+}
+
+TEST(Test_GrpcCall, singleResponseCall_requestPassed_requestKeptOffArena) {
+    kuksa::val::v2::GetValuesRequest request;
+    request.add_signal_ids()->set_id(42);
+
+    GetValuesCall_t cut(std::move(request));
+
+    EXPECT_EQ(nullptr, cut.getRequest().GetArena());
+    EXPECT_EQ(42, cut.getRequest().signal_ids(0).id());
+    EXPECT_NE(nullptr, cut.getResponse().GetArena());
+}
+
+TEST(Test_GrpcCall, createGrpcArenaOptions_initialBlockPassed_blockUsed) {
+    std::vector<char> block(getGrpcArenaBlockSize());
+
+    const auto options = createGrpcArenaOptions(&block);
+
+    EXPECT_EQ(block.data(), options.initial_block);
+    EXPECT_EQ(block.size(), options.initial_block_size);
+    EXPECT_EQ(getGrpcArenaBlockSize(), options.start_block_size);
+    EXPECT_LE(options.start_block_size, options.max_block_size);
+}
@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+
+#include "sdk/DataPointReply.h"
+
+#include "VehicleDataBrokerClientMock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace velocitas;
+using ::testing::_;
+using ::testing::Return;
+
+namespace {
+
+AsyncResultPtr_t<DataPointReply> makeResult(std::vector<DataPointValue>&& values) {
+    auto result = std::make_shared<AsyncResult<DataPointReply>>();
+    result->insertResult(DataPointReply(std::move(values)));
+    return result;
+}
+
+} // namespace
+
+TEST(Test_IVehicleDataBrokerClient, getPreparedDatapoints_defaultImplementation_layoutOfSet) {
+    VehicleDataBrokerClientMock client;
+    const auto                  signalSet = client.prepareSignalSet({"Vehicle.B", "Vehicle.A"});
+    // the reply lacks one of the signals, hence its layout differs from the one of the set
+    EXPECT_CALL(client, getDatapoints(_))
+        .WillOnce(Return(makeResult({TypedDataPointValue<int32_t>("Vehicle.B", 2)})));
+
+    const auto reply = client.getPreparedDatapoints(signalSet)->await();
+
+    EXPECT_EQ(signalSet->getLayout(), reply.getLayout());
+    EXPECT_EQ(2, reply.getUntyped("Vehicle.B")->getValueAs<int32_t>());
+    EXPECT_EQ(nullptr, reply.findUntyped(reply.getHandle("Vehicle.A")));
+}
@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/ReadCacheClient.h"
+
+#include "sdk/DataPointReply.h"
+
+#include "VehicleDataBrokerClientMock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace velocitas;
+using ::testing::_;
+using ::testing::Return;
+
+namespace {
+
+using Paths_t = std::vector<std::string>;
+
+DataPointReply makeReply(const std::map<std::string, int32_t>& values) {
+    DataPointMap_t dataPoints;
+    for (const auto& [path, value] : values) {
+        dataPoints.emplace(path, std::make_shared<TypedDataPointValue<int32_t>>(path, value));
+    }
+    return DataPointReply(std::move(dataPoints));
+}
+
+AsyncResultPtr_t<DataPointReply> makeResult(const std::map<std::string, int32_t>& values) {
+    auto result = std::make_shared<AsyncResult<DataPointReply>>();
+    result->insertResult(makeReply(values));
+    return result;
+}
+
+int32_t getValue(const DataPointReply& reply, const std::string& path) {
+    return reply.getUntyped(path)->getValueAs<int32_t>();
+}
+
+constexpr auto LONG_AGO = std::chrono::hours{1};
+
+} // namespace
+
+class Test_ReadCacheClient : public ::testing::Test {
+protected:
+    std::shared_ptr<ReadCacheClient> createCut(ReadPolicy defaultPolicy = ReadPolicy::fresh()) {
+        return std::make_shared<ReadCacheClient>(m_clientMock, defaultPolicy);
+    }
+
+    std::shared_ptr<VehicleDataBrokerClientMock> m_clientMock{
+        std::make_shared<VehicleDataBrokerClientMock>()};
+};
+
+TEST_F(Test_ReadCacheClient, getDatapoints_valueYoungEnough_servedFromCache) {
+    auto cut = createCut(ReadPolicy::maxAge(LONG_AGO));
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A"}))
+        .WillOnce(Return(makeResult({{"Vehicle.A", 1}})));
+
+    EXPECT_EQ(1, getValue(cut->getDatapoints({"Vehicle.A"})->await(), "Vehicle.A"));
+    EXPECT_EQ(1, getValue(cut->getDatapoints({"Vehicle.A"})->await(), "Vehicle.A"));
+
+    EXPECT_EQ(1, cut->getNumHits());
+    EXPECT_EQ(1, cut->getNumMisses());
+}
+
+TEST_F(Test_ReadCacheClient, getDatapoints_freshPolicy_alwaysRead) {
+    auto cut = createCut(ReadPolicy::maxAge(LONG_AGO));
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A"}))
+        .WillOnce(Return(makeResult({{"Vehicle.A", 1}})))
+        .WillOnce(Return(makeResult({{"Vehicle.A", 2}})));
+
+    EXPECT_EQ(1, getValue(cut->getDatapoints({"Vehicle.A"})->await(), "Vehicle.A"));
+    EXPECT_EQ(2, getValue(cut->getDatapoints({"Vehicle.A"}, ReadPolicy::fresh())->await(),
+                          "Vehicle.A"));
+
+    EXPECT_EQ(0, cut->getNumHits());
+    EXPECT_EQ(2, cut->getNumMisses());
+}
+
+TEST_F(Test_ReadCacheClient, getDatapoints_partiallyCached_onlyMissingSignalsRead) {
+    auto cut = createCut();
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A"}))
+        .WillOnce(Return(makeResult({{"Vehicle.A", 1}})));
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.B"}))
+        .WillOnce(Return(makeResult({{"Vehicle.B", 2}})));
+
+    std::ignore = cut->getDatapoints({"Vehicle.A"})->await();
+    const auto reply =
+        cut->getDatapoints({"Vehicle.B", "Vehicle.A"}, ReadPolicy::maxAge(LONG_AGO))->await();
+
+    EXPECT_EQ(2, reply.getLayout()->size());
+    EXPECT_EQ(1, getValue(reply, "Vehicle.A"));
+    EXPECT_EQ(2, getValue(reply, "Vehicle.B"));
+    EXPECT_EQ(1, cut->getNumHits());
+    EXPECT_EQ(2, cut->getNumMisses());
+}
+
+TEST_F(Test_ReadCacheClient, getDatapoints_cacheOnlyWithoutValue_notAvailableWithoutRequest) {
+    auto cut = createCut();
+    EXPECT_CALL(*m_clientMock, getDatapoints(_)).Times(0);
+
+    const auto reply = cut->getDatapoints({"Vehicle.A"}, ReadPolicy::cacheOnly())->await();
+
+    const auto value = reply.getUntyped("Vehicle.A");
+    EXPECT_FALSE(value->isValid());
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE, value->getFailure());
+    EXPECT_EQ(1, cut->getNumMisses());
+}
+
+TEST_F(Test_ReadCacheClient, getDatapoints_activeSubscription_servedFromCacheRegardlessOfAge) {
+    auto cut          = createCut(ReadPolicy::maxAge(std::chrono::milliseconds{0}));
+    auto subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
+    EXPECT_CALL(*m_clientMock, subscribe("SELECT Vehicle.A")).WillOnce(Return(subscription));
+    EXPECT_CALL(*m_clientMock, getDatapoints(_)).Times(0);
+
+    auto appSubscription = cut->subscribe("SELECT Vehicle.A");
+    subscription->insertNewItem(makeReply({{"Vehicle.A", 1}}));
+    subscription->insertNewItem(makeReply({{"Vehicle.A", 2}}));
+
+    EXPECT_EQ(1, getValue(appSubscription->next(), "Vehicle.A"));
+    EXPECT_EQ(2, getValue(cut->getDatapoints({"Vehicle.A"})->await(), "Vehicle.A"));
+    EXPECT_EQ(1, cut->getNumHits());
+}
+
+TEST_F(Test_ReadCacheClient, getDatapoints_conflatingSubscriptionTooSlow_read) {
+    auto cut          = createCut(ReadPolicy::maxAge(std::chrono::milliseconds{0}));
+    auto subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
+    subscription->setMaxDeliveryDelay(std::chrono::milliseconds{100});
+    EXPECT_CALL(*m_clientMock, subscribe("SELECT Vehicle.A")).WillOnce(Return(subscription));
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A"}))
+        .WillOnce(Return(makeResult({{"Vehicle.A", 2}})));
+
+    auto appSubscription = cut->subscribe("SELECT Vehicle.A");
+    subscription->insertNewItem(makeReply({{"Vehicle.A", 1}}));
+
+    EXPECT_EQ(2, getValue(cut->getDatapoints({"Vehicle.A"})->await(), "Vehicle.A"));
+    EXPECT_EQ(1, getValue(cut->getDatapoints({"Vehicle.A"}, ReadPolicy::maxAge(LONG_AGO))->await(),
+                          "Vehicle.A"));
+}
+
+TEST_F(Test_ReadCacheClient, getPreparedDatapoints_valuesYoungEnough_servedFromCacheInLayoutOfSet) {
+    auto cut = createCut(ReadPolicy::maxAge(LONG_AGO));
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A", "Vehicle.B"}))
+        .WillOnce(Return(makeResult({{"Vehicle.A", 1}, {"Vehicle.B", 2}})));
+    const auto signalSet = cut->prepareSignalSet({"Vehicle.B", "Vehicle.A"});
+
+    std::ignore      = cut->getPreparedDatapoints(signalSet)->await();
+    const auto reply = cut->getPreparedDatapoints(signalSet)->await();
+
+    EXPECT_EQ(signalSet->getLayout(), reply.getLayout());
+    EXPECT_EQ(1, getValue(reply, "Vehicle.A"));
+    EXPECT_EQ(2, getValue(reply, "Vehicle.B"));
+    EXPECT_EQ(2, cut->getNumHits());
+    EXPECT_EQ(2, cut->getNumMisses());
+}
+
+TEST_F(Test_ReadCacheClient, getDatapoints_knownValuesDeliveredOnSubscribe_servedFromCache) {
+    auto cut          = createCut(ReadPolicy::cacheOnly());
+    auto subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
+    // The client hands out values known from other subscriptions right away
+    subscription->insertNewItem(makeReply({{"Vehicle.A", 1}}));
+    EXPECT_CALL(*m_clientMock, subscribe("SELECT Vehicle.A")).WillOnce(Return(subscription));
+
+    auto appSubscription = cut->subscribe("SELECT Vehicle.A");
+
+    EXPECT_EQ(1, getValue(cut->getDatapoints({"Vehicle.A"})->await(), "Vehicle.A"));
+    EXPECT_EQ(1, getValue(appSubscription->next(), "Vehicle.A"));
+}
+
+TEST_F(Test_ReadCacheClient, getDatapoints_subscriptionCancelled_valueAged) {
+    auto cut          = createCut(ReadPolicy::maxAge(std::chrono::milliseconds{0}));
+    auto subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
+    EXPECT_CALL(*m_clientMock, subscribe(_)).WillOnce(Return(subscription));
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A"}))
+        .WillOnce(Return(makeResult({{"Vehicle.A", 2}})));
+
+    std::ignore = cut->subscribe("SELECT Vehicle.A");
+    subscription->insertNewItem(makeReply({{"Vehicle.A", 1}}));
+    subscription->cancel();
+
+    EXPECT_EQ(2, getValue(cut->getDatapoints({"Vehicle.A"})->await(), "Vehicle.A"));
+    EXPECT_EQ(2, getValue(cut->getDatapoints({"Vehicle.A"}, ReadPolicy::cacheOnly())->await(),
+                          "Vehicle.A"));
+}
+
+TEST_F(Test_ReadCacheClient, getDatapoints_conditionalSubscription_notConsideredUpToDate) {
+    auto cut          = createCut(ReadPolicy::maxAge(std::chrono::milliseconds{0}));
+    auto subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
+    EXPECT_CALL(*m_clientMock, subscribe(_)).WillOnce(Return(subscription));
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A"}))
+        .WillOnce(Return(makeResult({{"Vehicle.A", 0}})));
+
+    auto appSubscription = cut->subscribe("SELECT Vehicle.A WHERE Vehicle.A > 0");
+    subscription->insertNewItem(makeReply({{"Vehicle.A", 1}}));
+
+    EXPECT_EQ(0, getValue(cut->getDatapoints({"Vehicle.A"})->await(), "Vehicle.A"));
+}
@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/ReadCoalescingClient.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/Exceptions.h"
+#include "sdk/vdb/ReadCacheClient.h"
+
+#include "VehicleDataBrokerClientMock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace velocitas;
+using ::testing::Return;
+
+namespace {
+
+using Paths_t = std::vector<std::string>;
+
+DataPointReply makeReply(const std::map<std::string, int32_t>& values) {
+    DataPointMap_t dataPoints;
+    for (const auto& [path, value] : values) {
+        dataPoints.emplace(path, std::make_shared<TypedDataPointValue<int32_t>>(path, value));
+    }
+    return DataPointReply(std::move(dataPoints));
+}
+
+int32_t getValue(const DataPointReply& reply, const std::string& path) {
+    return reply.getUntyped(path)->getValueAs<int32_t>();
+}
+
+} // namespace
+
+class Test_ReadCoalescingClient : public ::testing::Test {
+protected:
+    std::shared_ptr<VehicleDataBrokerClientMock> m_clientMock{
+        std::make_shared<VehicleDataBrokerClientMock>()};
+};
+
+TEST_F(Test_ReadCoalescingClient, getDatapoints_overlappingReadInFlight_onlyMissingSignalsRead) {
+    auto cut         = std::make_shared<ReadCoalescingClient>(m_clientMock, std::nullopt);
+    auto firstReply  = std::make_shared<AsyncResult<DataPointReply>>();
+    auto secondReply = std::make_shared<AsyncResult<DataPointReply>>();
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A", "Vehicle.B"}))
+        .WillOnce(Return(firstReply));
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.C"})).WillOnce(Return(secondReply));
+
+    auto firstResult  = cut->getDatapoints({"Vehicle.A", "Vehicle.B"});
+    auto secondResult = cut->getDatapoints({"Vehicle.C", "Vehicle.B"});
+    firstReply->insertResult(makeReply({{"Vehicle.A", 1}, {"Vehicle.B", 2}}));
+    secondReply->insertResult(makeReply({{"Vehicle.C", 3}}));
+
+    const auto first = firstResult->await();
+    EXPECT_EQ(2, first.getLayout()->size());
+    EXPECT_EQ(1, getValue(first, "Vehicle.A"));
+    EXPECT_EQ(2, getValue(first, "Vehicle.B"));
+    const auto second = secondResult->await();
+    EXPECT_EQ(2, second.getLayout()->size());
+    EXPECT_EQ(2, getValue(second, "Vehicle.B"));
+    EXPECT_EQ(3, getValue(second, "Vehicle.C"));
+}
+
+TEST_F(Test_ReadCoalescingClient, getDatapoints_previousReadFinished_readAgain) {
+    auto cut        = std::make_shared<ReadCoalescingClient>(m_clientMock, std::nullopt);
+    auto firstReply = std::make_shared<AsyncResult<DataPointReply>>();
+    firstReply->insertResult(makeReply({{"Vehicle.A", 1}}));
+    auto secondReply = std::make_shared<AsyncResult<DataPointReply>>();
+    secondReply->insertResult(makeReply({{"Vehicle.A", 2}}));
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A"}))
+        .WillOnce(Return(firstReply))
+        .WillOnce(Return(secondReply));
+
+    EXPECT_EQ(1, getValue(cut->getDatapoints({"Vehicle.A"})->await(), "Vehicle.A"));
+    EXPECT_EQ(2, getValue(cut->getDatapoints({"Vehicle.A"})->await(), "Vehicle.A"));
+}
+
+TEST_F(Test_ReadCoalescingClient, getDatapoints_sharedReadFails_allWaitersGetError) {
+    auto cut   = std::make_shared<ReadCoalescingClient>(m_clientMock, std::nullopt);
+    auto reply = std::make_shared<AsyncResult<DataPointReply>>();
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A"})).WillOnce(Return(reply));
+
+    auto firstResult  = cut->getDatapoints({"Vehicle.A"});
+    auto secondResult = cut->getDatapoints({"Vehicle.A"});
+    reply->insertError(Status("unavailable"));
+
+    EXPECT_THROW(firstResult->await(), AsyncException);
+    EXPECT_THROW(secondResult->await(), AsyncException);
+}
+
+TEST_F(Test_ReadCoalescingClient, flush_readsWithinWindow_readInOneRequest) {
+    auto cut =
+        std::make_shared<ReadCoalescingClient>(m_clientMock, std::chrono::milliseconds{100});
+    auto reply = std::make_shared<AsyncResult<DataPointReply>>();
+    reply->insertResult(makeReply({{"Vehicle.A", 1}, {"Vehicle.B", 2}}));
+    EXPECT_CALL(*m_clientMock, getDatapoints(Paths_t{"Vehicle.A", "Vehicle.B"}))
+        .WillOnce(Return(reply));
+    EXPECT_CALL(*m_clientMock, flush());
+
+    auto firstResult  = cut->getDatapoints({"Vehicle.A"});
+    auto secondResult = cut->getDatapoints({"Vehicle.B"});
+    cut->flush();
+
+    EXPECT_EQ(1, getValue(firstResult->await(), "Vehicle.A"));
+    EXPECT_EQ(2, getValue(secondResult->await(), "Vehicle.B"));
+}
+
+TEST_F(Test_ReadCoalescingClient, getDatapoints_withPolicy_policyForwardedToWrappedClient) {
+    auto cache = std::make_shared<ReadCacheClient>(m_clientMock, ReadPolicy::fresh());
+    auto cut   = std::make_shared<ReadCoalescingClient>(cache, std::nullopt);
+    EXPECT_CALL(*m_clientMock, getDatapoints(::testing::_)).Times(0);
+
+    const auto reply = cut->getDatapoints({"Vehicle.A"}, ReadPolicy::cacheOnly())->await();
+
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE,
+              reply.getUntyped("Vehicle.A")->getFailure());
+}
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/WriteCoalescingClient.h"
+
+#include "sdk/DataPointValue.h"
+#include "sdk/Exceptions.h"
+
+#include "VehicleDataBrokerClientMock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace velocitas;
+using ::testing::_;
+using ::testing::Pointee;
+using ::testing::Return;
+using ::testing::UnorderedElementsAre;
+
+using SetErrorMap_t = IVehicleDataBrokerClient::SetErrorMap_t;
+
+namespace {
+
+std::vector<std::unique_ptr<DataPointValue>> makeValues(const std::string& path, float value) {
+    std::vector<std::unique_ptr<DataPointValue>> values;
+    values.emplace_back(std::make_unique<TypedDataPointValue<float>>(path, value));
+    return values;
+}
+
+AsyncResultPtr_t<SetErrorMap_t> makeResult(SetErrorMap_t errorMap) {
+    auto result = std::make_shared<AsyncResult<SetErrorMap_t>>();
+    result->insertResult(std::move(errorMap));
+    return result;
+}
+
+} // namespace
+
+class Test_WriteCoalescingClient : public ::testing::Test {
+protected:
+    void SetUp() override { EXPECT_CALL(*m_clientMock, flush()).Times(::testing::AnyNumber()); }
+
+    std::shared_ptr<VehicleDataBrokerClientMock> m_clientMock{
+        std::make_shared<VehicleDataBrokerClientMock>()};
+};
+
+TEST_F(Test_WriteCoalescingClient, flush_samePathWrittenTwice_lastValueSentInOneRequest) {
+    auto cut = std::make_shared<WriteCoalescingClient>(m_clientMock, std::nullopt);
+    EXPECT_CALL(*m_clientMock,
+                setDatapoints(UnorderedElementsAre(
+                    Pointee(TypedDataPointValue<float>("Vehicle.A", 2.F)),
+                    Pointee(TypedDataPointValue<float>("Vehicle.B", 3.F)))))
+        .WillOnce(Return(makeResult({{"Vehicle.B", "read only"}})));
+
+    auto firstResult = cut->setDatapoints(makeValues("Vehicle.A", 1.F));
+    auto values      = makeValues("Vehicle.A", 2.F);
+    values.emplace_back(std::make_unique<TypedDataPointValue<float>>("Vehicle.B", 3.F));
+    auto secondResult = cut->setDatapoints(values);
+    cut->flush();
+
+    EXPECT_TRUE(firstResult->await().empty());
+    EXPECT_EQ((SetErrorMap_t{{"Vehicle.B", "read only"}}), secondResult->await());
+}
+
+TEST_F(Test_WriteCoalescingClient, flush_requestFails_allWritersGetError) {
+    auto cut          = std::make_shared<WriteCoalescingClient>(m_clientMock, std::nullopt);
+    auto failedResult = std::make_shared<AsyncResult<SetErrorMap_t>>();
+    failedResult->insertError(Status("unavailable"));
+    EXPECT_CALL(*m_clientMock, setDatapoints(_)).WillOnce(Return(failedResult));
+
+    auto firstResult  = cut->setDatapoints(makeValues("Vehicle.A", 1.F));
+    auto secondResult = cut->setDatapoints(makeValues("Vehicle.B", 1.F));
+    cut->flush();
+
+    EXPECT_THROW(firstResult->await(), AsyncException);
+    EXPECT_THROW(secondResult->await(), AsyncException);
+}
+
+TEST_F(Test_WriteCoalescingClient, flush_nothingWritten_nothingSent) {
+    auto cut = std::make_shared<WriteCoalescingClient>(m_clientMock, std::nullopt);
+    EXPECT_CALL(*m_clientMock, setDatapoints(_)).Times(0);
+
+    cut->flush();
+}
+
+TEST_F(Test_WriteCoalescingClient, setDatapoints_windowElapsed_sentWithoutFlush) {
+    auto cut = std::make_shared<WriteCoalescingClient>(m_clientMock, std::chrono::milliseconds{1});
+    EXPECT_CALL(*m_clientMock, setDatapoints(UnorderedElementsAre(
+                                   Pointee(TypedDataPointValue<float>("Vehicle.A", 1.F)))))
+        .WillOnce(Return(makeResult({})));
+
+    EXPECT_TRUE(cut->setDatapoints(makeValues("Vehicle.A", 1.F))->await().empty());
+}
+
+TEST_F(Test_WriteCoalescingClient, getDatapoints_forwardedToClient) {
+    auto cut   = std::make_shared<WriteCoalescingClient>(m_clientMock, std::nullopt);
+    auto reply = std::make_shared<AsyncResult<DataPointReply>>();
+    EXPECT_CALL(*m_clientMock, getDatapoints(std::vector<std::string>{"Vehicle.A"}))
+        .WillOnce(Return(reply));
+
+    EXPECT_EQ(reply, cut->getDatapoints({"Vehicle.A"}));
+}
+
+TEST_F(Test_WriteCoalescingClient, setPreparedDatapoints_sameSignalHeldBack_sentBefore) {
+    auto cut       = std::make_shared<WriteCoalescingClient>(m_clientMock, std::nullopt);
+    auto signalSet = cut->prepareSignalSet({"Vehicle.A"});
+
+    ::testing::InSequence sequence;
+    EXPECT_CALL(*m_clientMock, setDatapoints(UnorderedElementsAre(
+                                   Pointee(TypedDataPointValue<float>("Vehicle.A", 1.F)))))
+        .WillOnce(Return(makeResult({})));
+    EXPECT_CALL(*m_clientMock, setDatapoints(UnorderedElementsAre(
+                                   Pointee(TypedDataPointValue<float>("Vehicle.A", 2.F)))))
+        .WillOnce(Return(makeResult({})));
+
+    auto heldBackResult = cut->setDatapoints(makeValues("Vehicle.A", 1.F));
+    auto preparedResult = cut->setPreparedDatapoints(signalSet, makeValues("Vehicle.A", 2.F));
+
+    EXPECT_TRUE(heldBackResult->await().empty());
+    EXPECT_TRUE(preparedResult->await().empty());
+}
+
+TEST_F(Test_WriteCoalescingClient, setPreparedDatapoints_otherSignalHeldBack_stillHeldBack) {
+    auto cut       = std::make_shared<WriteCoalescingClient>(m_clientMock, std::nullopt);
+    auto signalSet = cut->prepareSignalSet({"Vehicle.B"});
+
+    ::testing::InSequence sequence;
+    EXPECT_CALL(*m_clientMock, setDatapoints(UnorderedElementsAre(
+                                   Pointee(TypedDataPointValue<float>("Vehicle.B", 2.F)))))
+        .WillOnce(Return(makeResult({})));
+    EXPECT_CALL(*m_clientMock, setDatapoints(UnorderedElementsAre(
+                                   Pointee(TypedDataPointValue<float>("Vehicle.A", 1.F)))))
+        .WillOnce(Return(makeResult({})));
+
+    auto heldBackResult = cut->setDatapoints(makeValues("Vehicle.A", 1.F));
+    std::ignore         = cut->setPreparedDatapoints(signalSet, makeValues("Vehicle.B", 2.F));
+    EXPECT_FALSE(heldBackResult->isCompleted());
+
+    cut->flush();
+    EXPECT_TRUE(heldBackResult->await().empty());
+}
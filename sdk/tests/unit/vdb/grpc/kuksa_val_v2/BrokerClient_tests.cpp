@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/kuksa_val_v2/BrokerClient.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/Exceptions.h"
+
+#include "FakeDataBroker.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+// NOLINTBEGIN(runtime/string)
+const std::string SPEED{"Vehicle.Speed"};
+const std::string SEAT{"Vehicle.Cabin.Seat.Position"};
+const std::string UNKNOWN{"Vehicle.Unknown"};
+const std::string BATCH_ACTUATE{"kuksa.val.v2.VAL/BatchActuate"};
+const std::string LIST_METADATA{"kuksa.val.v2.VAL/ListMetadata"};
+const std::string SUBSCRIBE_BY_ID{"kuksa.val.v2.VAL/SubscribeById"};
+// NOLINTEND(runtime/string)
+
+std::vector<std::unique_ptr<DataPointValue>> makeSeatPosition(uint32_t position) {
+    std::vector<std::unique_ptr<DataPointValue>> values;
+    values.emplace_back(std::make_unique<TypedDataPointValue<uint32_t>>(SEAT, position));
+    return values;
+}
+
+} // namespace
+
+class Test_kuksa_val_v2_BrokerClient : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_broker.start();
+        m_cut = std::make_unique<kuksa_val_v2::BrokerClient>(m_broker.getAddress(),
+                                                             "vehicledatabroker");
+    }
+
+    void TearDown() override {
+        // end open subscription streams before the client goes away
+        m_broker.stop();
+        m_cut.reset();
+    }
+
+    FakeDataBroker m_broker{
+        {FakeSignal{SPEED, kuksa::val::v2::DATA_TYPE_FLOAT},
+         FakeSignal{SEAT, kuksa::val::v2::DATA_TYPE_UINT32, kuksa::val::v2::ENTRY_TYPE_ACTUATOR}}};
+    std::unique_ptr<kuksa_val_v2::BrokerClient> m_cut;
+};
+
+TEST_F(Test_kuksa_val_v2_BrokerClient, getDatapoints_knownAndUnknownSignals_valuesAndFailures) {
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 42.0F)});
+
+    const auto reply = m_cut->getDatapoints({SPEED, SEAT, UNKNOWN})->await();
+
+    EXPECT_EQ(42.0F, reply.getUntyped(SPEED)->getValueAs<float>());
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE, reply.getUntyped(SEAT)->getFailure());
+    EXPECT_EQ(DataPointValue::Failure::UNKNOWN_DATAPOINT, reply.getUntyped(UNKNOWN)->getFailure());
+}
+
+TEST_F(Test_kuksa_val_v2_BrokerClient, getDatapoints_listMetadataFailedOnce_nextCallSucceeds) {
+    m_broker.injectError(LIST_METADATA, grpc::StatusCode::INTERNAL, 1);
+
+    EXPECT_THROW(m_cut->getDatapoints({SPEED})->await(), AsyncException);
+    EXPECT_NO_THROW(m_cut->getDatapoints({SPEED})->await());
+}
+
+TEST_F(Test_kuksa_val_v2_BrokerClient, setDatapoints_actuator_valueApplied) {
+    const auto errors = m_cut->setDatapoints(makeSeatPosition(500))->await();
+
+    EXPECT_TRUE(errors.empty());
+    EXPECT_EQ(500, m_cut->getDatapoints({SEAT})->await().getUntyped(SEAT)->getValueAs<uint32_t>());
+}
+
+TEST_F(Test_kuksa_val_v2_BrokerClient, setDatapoints_providerUnavailable_throwsAsyncException) {
+    m_broker.setProviderAvailable(false);
+
+    EXPECT_THROW(m_cut->setDatapoints(makeSeatPosition(500))->await(), AsyncException);
+    EXPECT_EQ(1, m_broker.getNumCalls(BATCH_ACTUATE));
+}
+
+TEST_F(Test_kuksa_val_v2_BrokerClient, subscribe_valuesChanged_updatesReceived) {
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 1.0F)});
+
+    auto subscription = m_cut->subscribe("SELECT Vehicle.Speed");
+    EXPECT_EQ(1.0F, subscription->next().getUntyped(SPEED)->getValueAs<float>());
+
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 2.0F)});
+    EXPECT_EQ(2.0F, subscription->next().getUntyped(SPEED)->getValueAs<float>());
+}
+
+TEST_F(Test_kuksa_val_v2_BrokerClient, subscribe_streamDisconnected_resubscribes) {
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 1.0F)});
+    auto subscription = m_cut->subscribe("SELECT Vehicle.Speed");
+    EXPECT_TRUE(subscription->next().getUntyped(SPEED)->isValid());
+
+    m_broker.disconnectSubscriptions();
+
+    // invalidated until the subscription is re-established, then the current value is delivered
+    EXPECT_FALSE(subscription->next().getUntyped(SPEED)->isValid());
+    EXPECT_EQ(1.0F, subscription->next().getUntyped(SPEED)->getValueAs<float>());
+    EXPECT_EQ(2, m_broker.getNumCalls(SUBSCRIBE_BY_ID));
+}
+
+TEST_F(Test_kuksa_val_v2_BrokerClient, subscribe_generatedUpdates_receivedInOrder) {
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, -1.0F)});
+    auto subscription = m_cut->subscribe("SELECT Vehicle.Speed");
+    auto previous     = subscription->next().getUntyped(SPEED)->getValueAs<float>();
+
+    m_broker.startUpdates({SPEED}, 1000.0);
+    for (int i = 0; i < 10; ++i) {
+        const auto value = subscription->next().getUntyped(SPEED)->getValueAs<float>();
+        EXPECT_LT(previous, value);
+        previous = value;
+    }
+    m_broker.stopUpdates();
+}
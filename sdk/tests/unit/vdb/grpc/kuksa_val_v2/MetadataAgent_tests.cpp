@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/kuksa_val_v2/Metadata.h"
+
+#include "sdk/vdb/grpc/kuksa_val_v2/BrokerAsyncGrpcFacade.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/MetadataStore.h"
+
+#include "../../../TestBaseUsingEnvVars.h"
+#include "FakeDataBroker.h"
+
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+
+using namespace velocitas;
+using namespace velocitas::kuksa_val_v2;
+
+namespace {
+
+// NOLINTBEGIN(runtime/string)
+const std::string SPEED{"Vehicle.Speed"};
+const std::string LIST_METADATA{"kuksa.val.v2.VAL/ListMetadata"};
+const std::string GET_SERVER_INFO{"kuksa.val.v2.VAL/GetServerInfo"};
+// Version as composed by the agent from the GetServerInfo response of the fake
+const std::string FAKE_VERSION{"fake-databroker 0.0.0 "};
+// NOLINTEND(runtime/string)
+
+constexpr numeric_id_t SPEED_ID{1};
+constexpr numeric_id_t OUTDATED_SPEED_ID{7};
+
+} // namespace
+
+class Test_MetadataAgent : public TestUsingEnvVars {
+protected:
+    void SetUp() override {
+        setEnvVar("SDV_METADATA_CACHE_PATH", CACHE_FILE_PATH);
+        m_broker.start();
+        m_brokerFacade = std::make_shared<BrokerAsyncGrpcFacade>(
+            grpc::CreateChannel(m_broker.getAddress(), grpc::InsecureChannelCredentials()));
+    }
+
+    void TearDown() override {
+        m_broker.stop();
+        std::remove(CACHE_FILE_PATH);
+        TestUsingEnvVars::TearDown();
+    }
+
+    std::shared_ptr<MetadataAgent> createAgent(const std::string& persistedVersion,
+                                               numeric_id_t       persistedId) {
+        MetadataStore(CACHE_FILE_PATH)
+            .save(PersistedMetadata{
+                m_broker.getAddress(), persistedVersion, {{SPEED, persistedId}}});
+        return MetadataAgent::create(m_brokerFacade, m_broker.getAddress());
+    }
+
+    /**
+     * @brief Query the metadata of the speed signal; the returned future holds nullptr if the
+     *        query failed.
+     */
+    static std::future<MetadataPtr_t> querySpeed(MetadataAgent& agent) {
+        auto promise = std::make_shared<std::promise<MetadataPtr_t>>();
+        auto future  = promise->get_future();
+        agent.query(
+            {SPEED},
+            [promise](MetadataList_t&& metadataList) { promise->set_value(metadataList.at(0)); },
+            [promise](const grpc::Status&) { promise->set_value(nullptr); });
+        return future;
+    }
+
+    static MetadataPtr_t await(std::future<MetadataPtr_t>& future) {
+        if (future.wait_for(std::chrono::seconds{5}) != std::future_status::ready) {
+            return nullptr;
+        }
+        return future.get();
+    }
+
+    static bool isAnswered(const std::future<MetadataPtr_t>& future) {
+        return future.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+    }
+
+    bool waitForCalls(const std::string& method, size_t numCalls) const {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (m_broker.getNumCalls(method) < numCalls) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+        return true;
+    }
+
+    static constexpr char const* CACHE_FILE_PATH = "metadata_agent_test_cache.txt";
+
+    FakeDataBroker                         m_broker{{FakeSignal{SPEED}}};
+    std::shared_ptr<BrokerAsyncGrpcFacade> m_brokerFacade;
+};
+
+TEST_F(Test_MetadataAgent, query_preloadedIdOfSameVersion_answeredOnceValidated) {
+    auto agent = createAgent(FAKE_VERSION, SPEED_ID);
+    m_broker.setLatency(std::chrono::milliseconds{200});
+
+    auto result = querySpeed(*agent);
+
+    EXPECT_FALSE(isAnswered(result));
+    const auto metadata = await(result);
+    ASSERT_NE(nullptr, metadata);
+    EXPECT_EQ(SPEED_ID, metadata->m_id);
+    EXPECT_TRUE(metadata->m_isPreloaded);
+    EXPECT_EQ(1, m_broker.getNumCalls(GET_SERVER_INFO));
+    EXPECT_EQ(0, m_broker.getNumCalls(LIST_METADATA));
+}
+
+TEST_F(Test_MetadataAgent, query_preloadedIdOfOtherVersion_discardedAndResolvedFromScratch) {
+    auto       agent      = createAgent("databroker 0.4.0 abcdef", OUTDATED_SPEED_ID);
+    const auto generation = agent->getGeneration();
+
+    auto result = querySpeed(*agent);
+
+    const auto metadata = await(result);
+    ASSERT_NE(nullptr, metadata);
+    EXPECT_EQ(SPEED_ID, metadata->m_id);
+    EXPECT_FALSE(metadata->m_isPreloaded);
+    EXPECT_EQ(nullptr, agent->getByNumericId(OUTDATED_SPEED_ID));
+    EXPECT_EQ(1, m_broker.getNumCalls(LIST_METADATA));
+    // the outdated id was never handed out, hence ids handed out before stay valid
+    EXPECT_EQ(generation, agent->getGeneration());
+}
+
+TEST_F(Test_MetadataAgent, query_validationFails_preloadedIdDiscardedAndValidationRetried) {
+    auto agent = createAgent(FAKE_VERSION, OUTDATED_SPEED_ID);
+    m_broker.injectError(GET_SERVER_INFO, grpc::StatusCode::UNAVAILABLE, 1);
+
+    auto first = querySpeed(*agent);
+
+    const auto metadata = await(first);
+    ASSERT_NE(nullptr, metadata);
+    EXPECT_EQ(SPEED_ID, metadata->m_id);
+    EXPECT_FALSE(metadata->m_isPreloaded);
+    auto second = querySpeed(*agent);
+    EXPECT_NE(nullptr, await(second));
+    // the query is answered from the cache, not waiting for the validation
+    EXPECT_TRUE(waitForCalls(GET_SERVER_INFO, 2));
+}
+
+TEST_F(Test_MetadataAgent, invalidate_preloadedIds_heldBackUntilValidatedAgain) {
+    auto agent = createAgent(FAKE_VERSION, SPEED_ID);
+    auto first = querySpeed(*agent);
+    ASSERT_NE(nullptr, await(first));
+
+    agent->invalidate();
+    m_broker.setLatency(std::chrono::milliseconds{200});
+    auto second = querySpeed(*agent);
+
+    EXPECT_FALSE(isAnswered(second));
+    const auto metadata = await(second);
+    ASSERT_NE(nullptr, metadata);
+    EXPECT_EQ(SPEED_ID, metadata->m_id);
+    EXPECT_EQ(2, m_broker.getNumCalls(GET_SERVER_INFO));
+    EXPECT_EQ(0, m_broker.getNumCalls(LIST_METADATA));
+}
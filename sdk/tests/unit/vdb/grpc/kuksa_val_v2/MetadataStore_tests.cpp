@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/kuksa_val_v2/MetadataStore.h"
+
+#include "../../../TestBaseUsingEnvVars.h"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace velocitas;
+using namespace velocitas::kuksa_val_v2;
+
+class Test_MetadataStore : public TestUsingEnvVars {
+protected:
+    void TearDown() override {
+        std::remove(CACHE_FILE_PATH);
+        TestUsingEnvVars::TearDown();
+    }
+
+    static constexpr char const* CACHE_FILE_PATH = "metadata_cache_test.txt";
+};
+
+TEST_F(Test_MetadataStore, createFromEnvironment_envVarNotSet_noStore) {
+    unsetEnvVar("SDV_METADATA_CACHE_PATH");
+
+    EXPECT_FALSE(MetadataStore::createFromEnvironment().has_value());
+}
+
+TEST_F(Test_MetadataStore, createFromEnvironment_envVarSet_storeWithConfiguredPath) {
+    setEnvVar("SDV_METADATA_CACHE_PATH", CACHE_FILE_PATH);
+
+    const auto store = MetadataStore::createFromEnvironment();
+    ASSERT_TRUE(store.has_value());
+    EXPECT_EQ(CACHE_FILE_PATH, store->getFilePath());
+}
+
+TEST_F(Test_MetadataStore, load_noFile_nothingLoaded) {
+    EXPECT_FALSE(MetadataStore(CACHE_FILE_PATH).load().has_value());
+}
+
+TEST_F(Test_MetadataStore, saveAndLoad_snapshot_identicalSnapshot) {
+    PersistedMetadata snapshot{"localhost:55555",
+                               "databroker 0.5.0 abcdef",
+                               {{"Vehicle.Speed", 12}, {"Vehicle.Cabin.Seat Row", 34}}};
+    MetadataStore     store(CACHE_FILE_PATH);
+
+    ASSERT_TRUE(store.save(snapshot));
+    const auto loaded = store.load();
+
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(snapshot.m_brokerIdentity, loaded->m_brokerIdentity);
+    EXPECT_EQ(snapshot.m_serverVersion, loaded->m_serverVersion);
+    EXPECT_EQ(snapshot.m_idsByPath, loaded->m_idsByPath);
+}
+
+TEST_F(Test_MetadataStore, save_existingFile_replaced) {
+    MetadataStore store(CACHE_FILE_PATH);
+    ASSERT_TRUE(store.save(PersistedMetadata{"broker", "v1", {{"Vehicle.Speed", 1}}}));
+
+    ASSERT_TRUE(store.save(PersistedMetadata{"broker", "v2", {}}));
+    const auto loaded = store.load();
+
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ("v2", loaded->m_serverVersion);
+    EXPECT_TRUE(loaded->m_idsByPath.empty());
+}
+
+TEST_F(Test_MetadataStore, save_olderRevisionViaCopy_newerSnapshotKept) {
+    MetadataStore store(CACHE_FILE_PATH);
+    const auto    copy = store;
+    ASSERT_TRUE(store.save(PersistedMetadata{"broker", "v2", {{"Vehicle.Speed", 2}}, 2}));
+
+    EXPECT_TRUE(copy.save(PersistedMetadata{"broker", "v1", {{"Vehicle.Speed", 1}}, 1}));
+    const auto loaded = store.load();
+
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ("v2", loaded->m_serverVersion);
+    EXPECT_EQ(2, loaded->m_idsByPath.at("Vehicle.Speed"));
+}
+
+TEST_F(Test_MetadataStore, load_wrongHeader_nothingLoaded) {
+    std::ofstream(CACHE_FILE_PATH) << "some other file\nbroker\nv1\n1 Vehicle.Speed\n";
+
+    EXPECT_FALSE(MetadataStore(CACHE_FILE_PATH).load().has_value());
+}
+
+TEST_F(Test_MetadataStore, load_malformedEntry_nothingLoaded) {
+    std::ofstream(CACHE_FILE_PATH) << "velocitas-metadata-cache 1\nbroker\nv1\nVehicle.Speed\n";
+
+    EXPECT_FALSE(MetadataStore(CACHE_FILE_PATH).load().has_value());
+}
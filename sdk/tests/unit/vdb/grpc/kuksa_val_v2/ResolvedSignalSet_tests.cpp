@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2022-2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/vdb/grpc/kuksa_val_v2/ResolvedSignalSet.h"
+
+#include <grpcpp/support/status.h>
+#include <gtest/gtest.h>
+
+using namespace velocitas;
+using namespace velocitas::kuksa_val_v2;
+
+namespace {
+
+// Answers queries immediately, assigning ids by path; "unknown" signals are not known.
+class FakeMetadataAgent : public MetadataAgent {
+public:
+    void query(const SignalPathList_t&                    signalPaths,
+               std::function<void(MetadataList_t&&)>&&    onSuccess,
+               std::function<void(const grpc::Status&)>&& onError) override {
+        ++m_numQueries;
+        if (m_isUnavailable) {
+            onError(grpc::Status(grpc::StatusCode::UNAVAILABLE, ""));
+            return;
+        }
+        MetadataList_t metadataList;
+        for (const auto& path : signalPaths) {
+            const bool isKnown = path.find("unknown") == std::string::npos;
+            metadataList.push_back(std::make_shared<Metadata>(
+                Metadata{path, isKnown ? getId(path) : 0, isKnown}));
+        }
+        onSuccess(std::move(metadataList));
+    }
+
+    void invalidate(grpc::StatusCode /*statusCode*/) override {
+        ++m_generation;
+        m_idOffset += 100;
+    }
+
+    void invalidateIfCurrent(uint64_t generation, grpc::StatusCode statusCode) override {
+        if (generation == m_generation) {
+            invalidate(statusCode);
+        }
+    }
+
+    void discardPreloadedIfCurrent(uint64_t /*generation*/) override {}
+
+    [[nodiscard]] MetadataPtr_t getByNumericId(numeric_id_t /*numericId*/) const override {
+        return {};
+    }
+
+    [[nodiscard]] uint64_t getGeneration() const override { return m_generation; }
+
+    [[nodiscard]] numeric_id_t getId(const std::string& path) const {
+        return m_idOffset + static_cast<numeric_id_t>(path.back() - '0');
+    }
+
+    int          m_numQueries{0};
+    bool         m_isUnavailable{false};
+    uint64_t     m_generation{0};
+    numeric_id_t m_idOffset{0};
+};
+
+SignalSetResolutionPtr_t resolveSync(ResolvedSignalSet& signalSet) {
+    SignalSetResolutionPtr_t result;
+    signalSet.resolve([&result](const auto& resolution) { result = resolution; },
+                      [](const auto& /*status*/) {});
+    return result;
+}
+
+} // namespace
+
+TEST(Test_ResolvedSignalSet, resolve_idsAreOrderedBySlot) {
+    auto agent     = std::make_shared<FakeMetadataAgent>();
+    auto signalSet = std::make_shared<ResolvedSignalSet>(
+        std::vector<std::string>{"Vehicle.B2", "Vehicle.unknown3", "Vehicle.A1"}, agent);
+
+    auto resolution = resolveSync(*signalSet);
+
+    ASSERT_NE(nullptr, resolution);
+    ASSERT_EQ(3, resolution->m_idsBySlot.size());
+    EXPECT_EQ(1, resolution->m_idsBySlot[0]);
+    EXPECT_EQ(2, resolution->m_idsBySlot[1]);
+    EXPECT_FALSE(resolution->m_idsBySlot[2].has_value());
+    EXPECT_EQ(0, resolution->findSlot(1));
+    EXPECT_EQ(1, resolution->findSlot(2));
+    EXPECT_EQ(DataPointLayout::INVALID_HANDLE, resolution->findSlot(0));
+    EXPECT_EQ(DataPointLayout::INVALID_HANDLE, resolution->findSlot(3));
+    EXPECT_EQ(2, resolution->m_numKnownSignals);
+    ASSERT_EQ(2, resolution->m_getValuesRequest.signal_ids_size());
+    EXPECT_EQ(1, resolution->m_getValuesRequest.signal_ids(0).id());
+    EXPECT_EQ(2, resolution->m_getValuesRequest.signal_ids(1).id());
+}
+
+TEST(Test_ResolvedSignalSet, findSlot_widelySpreadIds_slotsFoundBySearch) {
+    SignalSetResolution resolution;
+    resolution.m_sortedSlots = {{-5, 2}, {7, 0}, {1000000, 1}};
+
+    EXPECT_EQ(2, resolution.findSlot(-5));
+    EXPECT_EQ(0, resolution.findSlot(7));
+    EXPECT_EQ(1, resolution.findSlot(1000000));
+    EXPECT_EQ(DataPointLayout::INVALID_HANDLE, resolution.findSlot(8));
+}
+
+TEST(Test_ResolvedSignalSet, resolve_repeatedly_queriesMetadataOnce) {
+    auto agent     = std::make_shared<FakeMetadataAgent>();
+    auto signalSet = std::make_shared<ResolvedSignalSet>(
+        std::vector<std::string>{"Vehicle.A1", "Vehicle.B2"}, agent);
+
+    auto first  = resolveSync(*signalSet);
+    auto second = resolveSync(*signalSet);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1, agent->m_numQueries);
+}
+
+TEST(Test_ResolvedSignalSet, resolve_afterInvalidation_reResolves) {
+    auto agent     = std::make_shared<FakeMetadataAgent>();
+    auto signalSet = std::make_shared<ResolvedSignalSet>(
+        std::vector<std::string>{"Vehicle.A1"}, agent);
+
+    auto first = resolveSync(*signalSet);
+    agent->invalidate(grpc::StatusCode::UNAVAILABLE);
+    auto second = resolveSync(*signalSet);
+
+    EXPECT_EQ(2, agent->m_numQueries);
+    EXPECT_EQ(1, first->m_idsBySlot[0]);
+    EXPECT_EQ(101, second->m_idsBySlot[0]);
+    EXPECT_EQ(agent->getGeneration(), second->m_generation);
+}
+
+TEST(Test_ResolvedSignalSet, resolve_queryFails_reportsError) {
+    auto agent             = std::make_shared<FakeMetadataAgent>();
+    agent->m_isUnavailable = true;
+    auto signalSet         = std::make_shared<ResolvedSignalSet>(
+        std::vector<std::string>{"Vehicle.A1"}, agent);
+
+    bool hasFailed = false;
+    signalSet->resolve([](const auto& /*resolution*/) { FAIL(); },
+                       [&hasFailed](const auto& status) {
+                           EXPECT_EQ(grpc::StatusCode::UNAVAILABLE, status.error_code());
+                           hasFailed = true;
+                       });
+
+    EXPECT_TRUE(hasFailed);
+}
+
+TEST(Test_ResolvedSignalSet, isResolvedBy_onlyOwningAgent) {
+    auto agent     = std::make_shared<FakeMetadataAgent>();
+    auto signalSet = std::make_shared<ResolvedSignalSet>(std::vector<std::string>{"A1"}, agent);
+
+    EXPECT_TRUE(signalSet->isResolvedBy(agent));
+    EXPECT_FALSE(signalSet->isResolvedBy(std::make_shared<FakeMetadataAgent>()));
+}
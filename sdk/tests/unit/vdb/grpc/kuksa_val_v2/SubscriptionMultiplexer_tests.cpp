@@ -0,0 +1,339 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/kuksa_val_v2/SubscriptionMultiplexer.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/Exceptions.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/BrokerAsyncGrpcFacade.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/Metadata.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/MetadataStore.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/ResolvedSignalSet.h"
+
+#include "../../../TestBaseUsingEnvVars.h"
+#include "FakeDataBroker.h"
+
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+using namespace velocitas::kuksa_val_v2;
+
+namespace {
+
+// NOLINTBEGIN(runtime/string)
+const std::string SPEED{"Vehicle.Speed"};
+const std::string SEAT{"Vehicle.Cabin.Seat.Position"};
+const std::string SUBSCRIBE_BY_ID{"kuksa.val.v2.VAL/SubscribeById"};
+const std::string LIST_METADATA{"kuksa.val.v2.VAL/ListMetadata"};
+// Version as composed by the metadata agent from the GetServerInfo response of the fake
+const std::string FAKE_VERSION{"fake-databroker 0.0.0 "};
+// NOLINTEND(runtime/string)
+
+float getSpeed(const DataPointReply& reply) { return reply.getUntyped(SPEED)->getValueAs<float>(); }
+
+uint32_t getSeat(const DataPointReply& reply) {
+    return reply.getUntyped(SEAT)->getValueAs<uint32_t>();
+}
+
+bool waitUntil(const std::function<bool()>& condition) {
+    constexpr auto TIMEOUT = std::chrono::seconds{5};
+    const auto     start   = std::chrono::steady_clock::now();
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() - start > TIMEOUT) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    return true;
+}
+
+} // namespace
+
+class Test_SubscriptionMultiplexer : public TestUsingEnvVars {
+protected:
+    void SetUp() override {
+        m_broker.start();
+        m_brokerFacade  = std::make_shared<BrokerAsyncGrpcFacade>(
+            grpc::CreateChannel(m_broker.getAddress(), grpc::InsecureChannelCredentials()));
+        m_metadataAgent = MetadataAgent::create(m_brokerFacade);
+        m_cut = std::make_shared<SubscriptionMultiplexer>(m_brokerFacade, m_metadataAgent);
+    }
+
+    void TearDown() override {
+        // end open subscription streams before the multiplexer goes away
+        m_broker.stop();
+        m_cut.reset();
+        std::remove(CACHE_FILE_PATH);
+        TestUsingEnvVars::TearDown();
+    }
+
+    /**
+     * @brief Replace the multiplexer by one whose metadata agent preloads the passed id of the
+     *        speed signal from the persistent metadata cache.
+     */
+    void recreateWithPreloadedSpeedId(numeric_id_t speedId) {
+        setEnvVar("SDV_METADATA_CACHE_PATH", CACHE_FILE_PATH);
+        MetadataStore(CACHE_FILE_PATH)
+            .save(PersistedMetadata{m_broker.getAddress(), FAKE_VERSION, {{SPEED, speedId}}});
+        m_metadataAgent = MetadataAgent::create(m_brokerFacade, m_broker.getAddress());
+        m_cut = std::make_shared<SubscriptionMultiplexer>(m_brokerFacade, m_metadataAgent);
+    }
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(std::vector<std::string> signalPaths) {
+        return m_cut->subscribe(
+            std::make_shared<ResolvedSignalSet>(std::move(signalPaths), m_metadataAgent));
+    }
+
+    static constexpr char const* CACHE_FILE_PATH = "multiplexer_test_metadata_cache.txt";
+
+    FakeDataBroker m_broker{
+        {FakeSignal{SPEED, kuksa::val::v2::DATA_TYPE_FLOAT},
+         FakeSignal{SEAT, kuksa::val::v2::DATA_TYPE_UINT32, kuksa::val::v2::ENTRY_TYPE_ACTUATOR}}};
+    std::shared_ptr<BrokerAsyncGrpcFacade>   m_brokerFacade;
+    std::shared_ptr<MetadataAgent>           m_metadataAgent;
+    std::shared_ptr<SubscriptionMultiplexer> m_cut;
+};
+
+TEST_F(Test_SubscriptionMultiplexer, subscribe_signalsCoveredByOtherSubscription_shareOneStream) {
+    m_broker.setValues(
+        {TypedDataPointValue<float>(SPEED, 1.0F), TypedDataPointValue<uint32_t>(SEAT, 10)});
+
+    // merged into one stream or attached to the stream of the first, whatever comes first
+    auto       speedAndSeat = subscribe({SEAT, SPEED});
+    auto       speed        = subscribe({SPEED});
+    const auto initial      = speedAndSeat->next();
+
+    EXPECT_EQ(1.0F, getSpeed(speed->next()));
+    EXPECT_EQ(1.0F, getSpeed(initial));
+    EXPECT_EQ(10, getSeat(initial));
+    EXPECT_EQ(1, m_broker.getNumCalls(SUBSCRIBE_BY_ID));
+    EXPECT_EQ(1, m_cut->getNumUpstreams());
+
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 2.0F)});
+    EXPECT_EQ(2.0F, getSpeed(speed->next()));
+    EXPECT_EQ(2.0F, getSpeed(speedAndSeat->next()));
+}
+
+TEST_F(Test_SubscriptionMultiplexer, subscribe_signalsOfOpenStream_knownValuesDeliveredRightAway) {
+    m_broker.setValues(
+        {TypedDataPointValue<float>(SPEED, 1.0F), TypedDataPointValue<uint32_t>(SEAT, 10)});
+    auto first = subscribe({SPEED, SEAT});
+    first->next();
+
+    auto lateJoiner = subscribe({SEAT});
+
+    EXPECT_EQ(10, getSeat(lateJoiner->next()));
+    EXPECT_EQ(1, m_broker.getNumCalls(SUBSCRIBE_BY_ID));
+    m_broker.setValues({TypedDataPointValue<uint32_t>(SEAT, 20)});
+    EXPECT_EQ(20, getSeat(lateJoiner->next()));
+}
+
+TEST_F(Test_SubscriptionMultiplexer, cancel_subscribersOfStream_detachedAndStreamClosed) {
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 1.0F)});
+    auto cancelled = subscribe({SPEED});
+    auto remaining = subscribe({SPEED});
+    cancelled->next();
+    remaining->next();
+
+    cancelled->cancel();
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 2.0F)});
+    EXPECT_EQ(2.0F, getSpeed(remaining->next()));
+    EXPECT_EQ(1, m_cut->getNumUpstreams());
+
+    // the next update detaches the last subscriber, which closes the stream
+    remaining->cancel();
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 3.0F)});
+    EXPECT_TRUE(waitUntil([this]() { return m_broker.getNumSubscriptions() == 0; }));
+    EXPECT_TRUE(waitUntil([this]() { return m_cut->getNumUpstreams() == 0; }));
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onUpdate_idsOutdated_subscriptionRestarted) {
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 1.0F)});
+    auto subscription = subscribe({SPEED});
+    subscription->next();
+
+    m_metadataAgent->invalidate();
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 2.0F)});
+
+    // the update referring to the outdated ids is dropped, the new stream delivers the value
+    EXPECT_EQ(2.0F, getSpeed(subscription->next()));
+    EXPECT_EQ(2, m_broker.getNumCalls(SUBSCRIBE_BY_ID));
+    EXPECT_EQ(1, m_cut->getNumUpstreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onError_databrokerLostByAllStreams_invalidatedOnce) {
+    m_broker.setValues(
+        {TypedDataPointValue<float>(SPEED, 1.0F), TypedDataPointValue<uint32_t>(SEAT, 10)});
+    auto speed = subscribe({SPEED});
+    speed->next();
+    // not covered by the open stream, hence subscribed via a stream of its own
+    auto seat = subscribe({SEAT});
+    seat->next();
+    ASSERT_EQ(2, m_cut->getNumUpstreams());
+    const auto generation = m_metadataAgent->getGeneration();
+
+    m_broker.disconnectSubscriptions();
+
+    EXPECT_FALSE(speed->next().getUntyped(SPEED)->isValid());
+    EXPECT_EQ(1.0F, getSpeed(speed->next()));
+    EXPECT_FALSE(seat->next().getUntyped(SEAT)->isValid());
+    EXPECT_EQ(10, getSeat(seat->next()));
+    EXPECT_EQ(generation + 1, m_metadataAgent->getGeneration());
+    EXPECT_EQ(4, m_broker.getNumCalls(SUBSCRIBE_BY_ID));
+}
+
+TEST_F(Test_SubscriptionMultiplexer, subscribe_consumerBlocksProducer_otherSubscriberServed) {
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 1.0F)});
+    auto blocking = subscribe({SPEED});
+    auto served   = subscribe({SPEED});
+    blocking->setBufferCapacity(1, OverflowPolicy::BLOCK_PRODUCER);
+    EXPECT_EQ(1.0F, getSpeed(served->next()));
+    EXPECT_EQ(1, m_broker.getNumCalls(SUBSCRIBE_BY_ID));
+
+    // the stream shared with the full subscription keeps delivering
+    for (float speed = 2.0F; speed <= 5.0F; speed += 1.0F) {
+        m_broker.setValues({TypedDataPointValue<float>(SPEED, speed)});
+        EXPECT_EQ(speed, getSpeed(served->next()));
+    }
+
+    // the updates held back meanwhile are conflated
+    EXPECT_EQ(1.0F, getSpeed(blocking->next()));
+    auto speed = getSpeed(blocking->next());
+    while (speed < 5.0F) {
+        const auto next = getSpeed(blocking->next());
+        EXPECT_LT(speed, next);
+        speed = next;
+    }
+    EXPECT_EQ(0, blocking->getNumDroppedItems());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, addSignals_coveredByOtherStream_attachedToIt) {
+    m_broker.setValues(
+        {TypedDataPointValue<float>(SPEED, 1.0F), TypedDataPointValue<uint32_t>(SEAT, 10)});
+    auto seat = subscribe({SEAT});
+    seat->next();
+    auto subscription = subscribe({SPEED});
+    subscription->next();
+    ASSERT_EQ(2, m_cut->getNumUpstreams());
+
+    subscription->addSignals({SEAT});
+
+    // fed by both streams, the values are mapped to the slots of the changed layout
+    auto reply = subscription->next();
+    EXPECT_EQ(2, reply.getLayout()->size());
+    EXPECT_EQ(1.0F, getSpeed(reply));
+    EXPECT_EQ(10, getSeat(reply));
+    m_broker.setValues({TypedDataPointValue<uint32_t>(SEAT, 20)});
+    reply = subscription->next();
+    EXPECT_EQ(1.0F, getSpeed(reply));
+    EXPECT_EQ(20, getSeat(reply));
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 2.0F)});
+    reply = subscription->next();
+    EXPECT_EQ(2.0F, getSpeed(reply));
+    EXPECT_EQ(20, getSeat(reply));
+    EXPECT_EQ(2, m_broker.getNumCalls(SUBSCRIBE_BY_ID));
+}
+
+TEST_F(Test_SubscriptionMultiplexer, removeSignals_lastSignalOfStream_streamClosed) {
+    m_broker.setValues(
+        {TypedDataPointValue<float>(SPEED, 1.0F), TypedDataPointValue<uint32_t>(SEAT, 10)});
+    auto seat = subscribe({SEAT});
+    seat->next();
+    auto subscription = subscribe({SPEED});
+    subscription->next();
+    subscription->addSignals({SEAT});
+    subscription->next();
+
+    subscription->removeSignals({SPEED});
+
+    EXPECT_TRUE(waitUntil([this]() { return m_broker.getNumSubscriptions() == 1; }));
+    EXPECT_TRUE(waitUntil([this]() { return m_cut->getNumUpstreams() == 1; }));
+    m_broker.setValues({TypedDataPointValue<uint32_t>(SEAT, 20)});
+    const auto reply = subscription->next();
+    EXPECT_EQ(1, reply.getLayout()->size());
+    EXPECT_EQ(20, getSeat(reply));
+}
+
+TEST_F(Test_SubscriptionMultiplexer, removeSignals_allSignals_subscriberKeptUntilSignalsAdded) {
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 1.0F)});
+    auto subscription = subscribe({SPEED});
+    subscription->next();
+
+    subscription->removeSignals({SPEED});
+    EXPECT_TRUE(waitUntil([this]() { return m_cut->getNumUpstreams() == 0; }));
+
+    // the idle subscriber is not attached to any stream, but still alive
+    subscription->addSignals({SPEED});
+    EXPECT_EQ(1.0F, getSpeed(subscription->next()));
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 2.0F)});
+    EXPECT_EQ(2.0F, getSpeed(subscription->next()));
+    EXPECT_EQ(1, m_cut->getNumUpstreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, addSignals_removedBefore_knownValueDeliveredAgain) {
+    m_broker.setValues(
+        {TypedDataPointValue<float>(SPEED, 1.0F), TypedDataPointValue<uint32_t>(SEAT, 10)});
+    auto subscription = subscribe({SPEED, SEAT});
+    subscription->next();
+    subscription->removeSignals({SEAT});
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 2.0F)});
+    auto reply = subscription->next();
+    EXPECT_EQ(DataPointLayout::INVALID_HANDLE, reply.getLayout()->findHandle(SEAT));
+
+    subscription->addSignals({SEAT});
+
+    // the stream still carries the signal, hence its known value is delivered right away
+    reply = subscription->next();
+    EXPECT_EQ(2.0F, getSpeed(reply));
+    EXPECT_EQ(10, getSeat(reply));
+    m_broker.setValues({TypedDataPointValue<uint32_t>(SEAT, 20)});
+    EXPECT_EQ(20, getSeat(subscription->next()));
+    EXPECT_EQ(1, m_broker.getNumCalls(SUBSCRIBE_BY_ID));
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onError_preloadedIdRejected_resubscribedWithResolvedIds) {
+    // the id was persisted for the same databroker version, but refers to no signal
+    recreateWithPreloadedSpeedId(7);
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 1.0F)});
+
+    auto subscription = subscribe({SPEED});
+
+    EXPECT_EQ(1.0F, getSpeed(subscription->next()));
+    EXPECT_EQ(2, m_broker.getNumCalls(SUBSCRIBE_BY_ID));
+    EXPECT_EQ(1, m_broker.getNumCalls(LIST_METADATA));
+    EXPECT_EQ(1, m_cut->getNumUpstreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onError_rejectedAgainWithResolvedIds_subscriptionFailed) {
+    recreateWithPreloadedSpeedId(1);
+    m_broker.injectError(SUBSCRIBE_BY_ID, grpc::StatusCode::PERMISSION_DENIED);
+
+    auto subscription = subscribe({SPEED});
+
+    EXPECT_THROW(subscription->next(), AsyncException);
+    EXPECT_EQ(2, m_broker.getNumCalls(SUBSCRIBE_BY_ID));
+    EXPECT_EQ(1, m_broker.getNumCalls(LIST_METADATA));
+}
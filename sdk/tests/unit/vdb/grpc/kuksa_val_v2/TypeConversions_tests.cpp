@@ -158,20 +158,18 @@ template <typename DATA_TYPE> void testValueConversion(const DATA_TYPE& expected
     const auto* const expectedPath      = "some.path";
     const auto        expectedTimestamp = Timestamp{0, 0};
 
-    auto dataPointValue =
-        kuksa_val_v2::convertFromGrpcValue(expectedPath, grpcValue, expectedTimestamp);
-
-    ASSERT_TRUE(dataPointValue);
-    EXPECT_EQ(expectedPath, dataPointValue->getPath());
-    EXPECT_EQ(expectedTimestamp, dataPointValue->getTimestamp());
-    EXPECT_TRUE(dataPointValue->isValid());
-    EXPECT_EQ(DataPointValue::Failure::NONE, dataPointValue->getFailure());
-    EXPECT_TRUE(dataPointValue->wasUpdated());
-
-    auto typedDataPointValue =
-        std::dynamic_pointer_cast<TypedDataPointValue<DATA_TYPE>>(dataPointValue);
-    ASSERT_NE(nullptr, typedDataPointValue);
-    EXPECT_EQ(expectedValue, typedDataPointValue->value());
+    auto dataPointValue = kuksa_val_v2::convertFromGrpcValue(InternedPath(expectedPath), grpcValue,
+                                                             expectedTimestamp);
+
+    EXPECT_EQ(getValueType<DATA_TYPE>(), dataPointValue.getType());
+    EXPECT_EQ(expectedPath, dataPointValue.getPath());
+    EXPECT_EQ(expectedTimestamp, dataPointValue.getTimestamp());
+    EXPECT_TRUE(dataPointValue.isValid());
+    EXPECT_EQ(DataPointValue::Failure::NONE, dataPointValue.getFailure());
+    EXPECT_TRUE(dataPointValue.wasUpdated());
+
+    TypedDataPointValue<DATA_TYPE> typedDataPointValue(dataPointValue);
+    EXPECT_EQ(expectedValue, typedDataPointValue.value());
 }
 
 TEST(Test_TypeConversion, convertFromGrpcValue__allMembersSetCorrectly) {
@@ -16,11 +16,85 @@
 
 #include "sdk/vdb/grpc/sdv_databroker_v1/BrokerClient.h"
 
+#include "sdk/DataPointReply.h"
+
+#include "FakeDataBroker.h"
+
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <vector>
+
 using namespace velocitas;
 
+namespace {
+
+// NOLINTBEGIN(runtime/string)
+const std::string SPEED{"Vehicle.Speed"};
+const std::string UNKNOWN{"Vehicle.Unknown"};
+const std::string GET_DATAPOINTS{"sdv.databroker.v1.Broker/GetDatapoints"};
+// NOLINTEND(runtime/string)
+
+} // namespace
+
 TEST(Test_sdv_databroker_v1_BrokerClient, getDatapoints_noConnection_throwsAsyncException) {
     auto client = sdv_databroker_v1::BrokerClient("vehicledatabroker");
     EXPECT_THROW(client.getDatapoints({})->await(), AsyncException);
 }
+
+class Test_sdv_databroker_v1_BrokerClient_withFakeDataBroker : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_broker.start();
+        m_cut = std::make_unique<sdv_databroker_v1::BrokerClient>(m_broker.getAddress(),
+                                                                  "vehicledatabroker");
+    }
+
+    void TearDown() override {
+        // end open subscription streams before the client goes away
+        m_broker.stop();
+        m_cut.reset();
+    }
+
+    FakeDataBroker m_broker{{FakeSignal{SPEED, kuksa::val::v2::DATA_TYPE_FLOAT}}};
+    std::unique_ptr<sdv_databroker_v1::BrokerClient> m_cut;
+};
+
+TEST_F(Test_sdv_databroker_v1_BrokerClient_withFakeDataBroker, setDatapoints_thenGet_valueRead) {
+    std::vector<std::unique_ptr<DataPointValue>> values;
+    values.emplace_back(std::make_unique<TypedDataPointValue<float>>(SPEED, 42.0F));
+    values.emplace_back(std::make_unique<TypedDataPointValue<float>>(UNKNOWN, 1.0F));
+
+    const auto errors = m_cut->setDatapoints(values)->await();
+    const auto reply  = m_cut->getDatapoints({SPEED})->await();
+
+    EXPECT_EQ(IVehicleDataBrokerClient::SetErrorMap_t({{UNKNOWN, "UNKNOWN_DATAPOINT"}}), errors);
+    EXPECT_EQ(42.0F, reply.getUntyped(SPEED)->getValueAs<float>());
+}
+
+TEST_F(Test_sdv_databroker_v1_BrokerClient_withFakeDataBroker,
+       getDatapoints_injectedError_throwsAsyncException) {
+    m_broker.injectError(GET_DATAPOINTS, grpc::StatusCode::UNAVAILABLE);
+
+    EXPECT_THROW(m_cut->getDatapoints({SPEED})->await(), AsyncException);
+}
+
+TEST_F(Test_sdv_databroker_v1_BrokerClient_withFakeDataBroker, subscribe_valueSet_updateReceived) {
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 1.0F)});
+
+    auto subscription = m_cut->subscribe("SELECT Vehicle.Speed");
+    EXPECT_EQ(1.0F, subscription->next().getUntyped(SPEED)->getValueAs<float>());
+
+    m_broker.setValues({TypedDataPointValue<float>(SPEED, 2.0F)});
+    EXPECT_EQ(2.0F, subscription->next().getUntyped(SPEED)->getValueAs<float>());
+}
+
+TEST_F(Test_sdv_databroker_v1_BrokerClient_withFakeDataBroker,
+       subscribe_streamDisconnected_throwsAsyncException) {
+    auto subscription = m_cut->subscribe("SELECT Vehicle.Speed");
+    std::ignore       = subscription->next();
+
+    m_broker.disconnectSubscriptions();
+
+    EXPECT_THROW(subscription->next(), AsyncException);
+}